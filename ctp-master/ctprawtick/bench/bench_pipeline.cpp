@@ -0,0 +1,247 @@
+// 行情发布链路的微基准：protobuf转换/序列化、SPSC队列、ZMQ inproc发布订阅
+// 运行: bench_pipeline --benchmark_out=bench_pipeline.json --benchmark_out_format=json
+// 或者在构建目录执行 make bench，结果写到构建目录下的bench_pipeline.json
+
+#include <cstring>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <sys/mman.h>
+#include <benchmark/benchmark.h>
+#include <zmq.hpp>
+#include "ProtobufConverter.h"
+#include "MarketTick.h"
+#include "readerwriterqueue.h"
+#include "ShmTickRing.h"
+
+using namespace std;
+
+// 构造一条字段齐全的行情，数值按序号变化避免protobuf按默认值省略字段
+static CThostFtdcDepthMarketDataField makeTick(int seq)
+{
+    CThostFtdcDepthMarketDataField tick;
+    memset(&tick, 0, sizeof(tick));
+    strcpy(tick.TradingDay, "20250805");
+    strcpy(tick.ActionDay, "20250805");
+    snprintf(tick.InstrumentID, sizeof(tick.InstrumentID), "rb%04d", 2510 + seq % 8);
+    strcpy(tick.ExchangeID, "SHFE");
+    snprintf(tick.UpdateTime, sizeof(tick.UpdateTime), "%02d:%02d:%02d", 9 + seq / 3600 % 6, seq / 60 % 60, seq % 60);
+    tick.UpdateMillisec = (seq % 2) * 500;
+
+    double px = 3500 + seq % 100;
+    tick.LastPrice = px;
+    tick.PreSettlementPrice = 3480;
+    tick.PreClosePrice = 3485;
+    tick.PreOpenInterest = 1500000;
+    tick.OpenPrice = 3490;
+    tick.HighestPrice = 3620;
+    tick.LowestPrice = 3470;
+    tick.Volume = 100000 + seq;
+    tick.Turnover = tick.Volume * px * 10;
+    tick.OpenInterest = 1500000 + seq % 1000;
+    tick.UpperLimitPrice = 3758;
+    tick.LowerLimitPrice = 3202;
+    tick.AveragePrice = px * 10;
+
+    double* bids[] = {&tick.BidPrice1, &tick.BidPrice2, &tick.BidPrice3, &tick.BidPrice4, &tick.BidPrice5};
+    double* asks[] = {&tick.AskPrice1, &tick.AskPrice2, &tick.AskPrice3, &tick.AskPrice4, &tick.AskPrice5};
+    int* bidVols[] = {&tick.BidVolume1, &tick.BidVolume2, &tick.BidVolume3, &tick.BidVolume4, &tick.BidVolume5};
+    int* askVols[] = {&tick.AskVolume1, &tick.AskVolume2, &tick.AskVolume3, &tick.AskVolume4, &tick.AskVolume5};
+    for (int level = 0; level < 5; ++level)
+    {
+        *bids[level] = px - level - 1;
+        *asks[level] = px + level + 1;
+        *bidVols[level] = 10 + level + seq % 50;
+        *askVols[level] = 20 + level + seq % 30;
+    }
+    return tick;
+}
+
+// CTP结构转protobuf消息
+static void BM_ConvertToProtobuf(benchmark::State& state)
+{
+    CThostFtdcDepthMarketDataField tick = makeTick(1);
+    string ts = ProtobufConverter::generateLocalTimestamp();
+    for (auto _: state)
+    {
+        ctp::MarketDataMessage msg = ProtobufConverter::convertToProtobuf(tick, ts);
+        benchmark::DoNotOptimize(msg);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConvertToProtobuf);
+
+// protobuf消息序列化
+static void BM_SerializeMarketData(benchmark::State& state)
+{
+    ctp::MarketDataMessage msg = ProtobufConverter::convertToProtobuf(makeTick(1),
+                                                                      ProtobufConverter::generateLocalTimestamp());
+    size_t bytes = 0;
+    for (auto _: state)
+    {
+        string data = ProtobufConverter::serializeToString(msg);
+        bytes += data.size();
+        benchmark::DoNotOptimize(data);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_SerializeMarketData);
+
+// 主线程发布一条行情的完整编码：生成时间戳+转换+序列化
+static void BM_EncodeMarketData(benchmark::State& state)
+{
+    CThostFtdcDepthMarketDataField tick = makeTick(1);
+    for (auto _: state)
+    {
+        ctp::MarketDataMessage msg = ProtobufConverter::convertToProtobuf(tick, ProtobufConverter::generateLocalTimestamp());
+        string data = ProtobufConverter::serializeToString(msg);
+        benchmark::DoNotOptimize(data);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EncodeMarketData);
+
+// 行情队列单线程入队再出队，测队列本身和432字节元素拷贝的开销
+static void BM_QueueEnqueueDequeue(benchmark::State& state)
+{
+    moodycamel::ReaderWriterQueue<MarketTick> queue(4096);
+    MarketTick in;
+    in.data = makeTick(1);
+    in.recvNs = 1;
+    in.recvWallNs = 1;
+    in.dequeueNs = 0;
+    MarketTick out;
+    const int burst = static_cast<int>(state.range(0));
+    for (auto _: state)
+    {
+        for (int i = 0; i < burst; ++i)
+        {
+            queue.try_enqueue(in);
+        }
+        for (int i = 0; i < burst; ++i)
+        {
+            queue.try_dequeue(out);
+        }
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetItemsProcessed(state.iterations() * burst);
+    state.SetBytesProcessed(state.iterations() * burst * sizeof(MarketTick));
+}
+BENCHMARK(BM_QueueEnqueueDequeue)->Arg(1)->Arg(64)->Arg(1024);
+
+// SPI线程入队、主线程出队，与ctpmarket的用法一致
+static void BM_QueueSpsc(benchmark::State& state)
+{
+    static moodycamel::ReaderWriterQueue<MarketTick>* queue = nullptr;
+    if (state.thread_index() == 0)
+    {
+        queue = new moodycamel::ReaderWriterQueue<MarketTick>(500000);
+    }
+    MarketTick tick;
+    tick.data = makeTick(1);
+    tick.recvNs = 0;
+    tick.recvWallNs = 0;
+    tick.dequeueNs = 0;
+    // 两个线程迭代次数相同，生产者队列满时自旋，消费者队列空时自旋
+    for (auto _: state)
+    {
+        if (state.thread_index() == 0)
+        {
+            while (!queue->try_enqueue(tick))
+            {
+            }
+        }
+        else
+        {
+            while (!queue->try_dequeue(tick))
+            {
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    // 循环结束时两个线程已同步，入队出队条数相同，队列为空
+    if (state.thread_index() == 0)
+    {
+        delete queue;
+        queue = nullptr;
+    }
+}
+BENCHMARK(BM_QueueSpsc)->Threads(2)->UseRealTime();
+
+// 共享内存行情环写入一条再读出一条，与BM_ZmqInprocPubSub对比同机传输开销
+static void BM_ShmRingPublishPoll(benchmark::State& state)
+{
+    string error;
+    ShmTickWriter writer;
+    ShmTickReader reader;
+    if (!writer.open("bench_pipeline_ring", 4096, error) || !reader.open("bench_pipeline_ring", error))
+    {
+        state.SkipWithError(error.c_str());
+        return;
+    }
+    ShmTick tick;
+    memset(&tick, 0, sizeof(tick));
+    strcpy(tick.InstrumentID, "rb2410");
+    ShmTick out;
+    for (auto _: state)
+    {
+        writer.publish(tick);
+        reader.poll(out);
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetItemsProcessed(state.iterations());
+    shm_unlink("/bench_pipeline_ring");
+}
+BENCHMARK(BM_ShmRingPublishPoll);
+
+// ZMQ inproc发布订阅：两帧消息(类型+protobuf内容)，与ZMQPublisher::publishMessage一致
+static void BM_ZmqInprocPubSub(benchmark::State& state)
+{
+    zmq::context_t context(1);
+    zmq::socket_t pub(context, ZMQ_PUB);
+    zmq::socket_t sub(context, ZMQ_SUB);
+    pub.bind("inproc://bench_md");
+    sub.connect("inproc://bench_md");
+    sub.setsockopt(ZMQ_SUBSCRIBE, "MARKET_DATA", 11);
+
+    const string type = "MARKET_DATA_PROTOBUF";
+    string content = ProtobufConverter::serializeToString(
+        ProtobufConverter::convertToProtobuf(makeTick(1), ProtobufConverter::generateLocalTimestamp()));
+
+    auto publish = [&]()
+    {
+        zmq::message_t typeMsg(type.c_str(), type.length());
+        zmq::message_t contentMsg(content.c_str(), content.length());
+        pub.send(typeMsg, zmq::send_flags::sndmore);
+        pub.send(contentMsg, zmq::send_flags::none);
+    };
+
+    // 订阅生效前发出的消息会被丢弃，先探测到第一条收到为止
+    zmq::message_t frame;
+    for (;;)
+    {
+        publish();
+        if (sub.recv(frame, zmq::recv_flags::dontwait))
+        {
+            sub.recv(frame, zmq::recv_flags::none);
+            break;
+        }
+    }
+    while (sub.recv(frame, zmq::recv_flags::dontwait))
+    {
+    }
+
+    for (auto _: state)
+    {
+        publish();
+        sub.recv(frame, zmq::recv_flags::none);
+        sub.recv(frame, zmq::recv_flags::none);
+        benchmark::DoNotOptimize(frame.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * (type.size() + content.size()));
+}
+BENCHMARK(BM_ZmqInprocPubSub);
+
+BENCHMARK_MAIN();
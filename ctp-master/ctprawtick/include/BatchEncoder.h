@@ -0,0 +1,87 @@
+#ifndef BATCHENCODER_H
+#define BATCHENCODER_H
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include "ThostFtdcUserApiStruct.h"
+#include "ZMQPublisher.h"
+
+/// 合约/持仓批量数据的流式编码器
+/// 逐行直接写入复用的输出缓冲区（数值使用std::to_chars），每满rowsPerChunk行
+/// 作为一帧发出，整批数据以一条多帧ZMQ消息发布：type + chunk1 + ... + chunkN。
+/// CSV每帧由完整的行组成；protobuf每帧是一个完整的Batch消息，可单独解析。
+class BatchEncoder
+{
+public:
+    enum Encoding
+    {
+        ENCODING_CSV = 0,
+        ENCODING_PROTOBUF
+    };
+
+    enum BatchKind
+    {
+        BATCH_INSTRUMENT = 0,
+        BATCH_POSITION
+    };
+
+    /// "protobuf"/"pb"返回ENCODING_PROTOBUF，其余返回ENCODING_CSV
+    static Encoding parseEncoding(const std::string& name);
+
+    /// 不同编码对应的消息类型帧
+    static const char* topic(BatchKind kind, Encoding encoding);
+
+    explicit BatchEncoder(ZMQPublisher& publisher, size_t rowsPerChunk = 500);
+
+    void setRowsPerChunk(size_t rows) { rowsPerChunk = rows > 0 ? rows : 500; }
+
+    /// 开始一批数据，有数据时才会发出消息类型帧
+    void begin(BatchKind kind, Encoding encoding);
+    void add(const CThostFtdcInstrumentField& instrument);
+    void add(const CThostFtdcInvestorPositionField& position);
+    /// 发出剩余的数据帧，返回整批是否发送成功
+    bool finish();
+
+    size_t rows() const { return rowCount; }
+    size_t chunks() const { return chunkCount; }
+    size_t bytes() const { return byteCount; }
+
+private:
+    void startChunk();
+    void endRow();
+    void sendFrame(const std::string& frame, bool more);
+
+    // CSV
+    void putStr(const char* s, size_t maxLen);
+    void putChar(char c);
+    void putInt(long long v);
+    void putDouble(double v);
+    void sep() { current.push_back(','); }
+
+    // protobuf
+    void putVarint(uint64_t v);
+    template <class Message>
+    void putMessage(uint32_t fieldNumber, const Message& msg);
+
+private:
+    ZMQPublisher&   publisher;
+    size_t          rowsPerChunk;
+
+    BatchKind       kind;
+    Encoding        encoding;
+    std::string     chunkHeader;    // protobuf每帧的timestamp/message_type字段
+
+    // 双缓冲：current写入中，pending等待发送；两者容量跨批次复用
+    std::string     current;
+    std::string     pending;
+    size_t          currentRows;
+
+    bool            topicSent;
+    bool            ok;
+    size_t          rowCount;
+    size_t          chunkCount;
+    size_t          byteCount;
+};
+
+#endif
@@ -4,19 +4,167 @@
 #include<string>
 #include<ctime>
 #include<map>
+#include<vector>
+#include<cstdio>
+#include<cstdint>
+#include<unordered_map>
+#include "ThostFtdcUserApiStruct.h"
+#include "SessionCalendar.h"
 
 struct OHLCV
 {
-    std::string symbol;
-    std::time_t dt;
+    TThostFtdcInstrumentIDType symbol;
+    std::time_t dt;         ///K线开始时间，日线为交易日零点
     double      open;
     double      high;
     double      low;
     double      close;
-    int         opi;
-    int         volume;
+    int         opi;        ///收盘持仓量
+    int         volume;     ///本周期成交量
+    int         opiDelta;   ///本周期持仓量变化
+    double      turnover;   ///本周期成交额
+    int         timeframe;  ///KlineEngine::Timeframe
 };
 
 typedef std::map<std::string, OHLCV> CMapLastKline;
 
-#endif
\ No newline at end of file
+/// 定长K线环形缓冲区，按列存放(SoA)，查询最近N根时每列连续访问
+class BarRing
+{
+public:
+    BarRing();
+
+    void init(size_t capacity);
+    void push(const OHLCV& bar);
+
+    size_t size() const { return count; }
+    size_t capacity() const { return cap; }
+
+    /// 第i根K线，0为最旧；symbol与timeframe不填
+    void get(size_t i, OHLCV& bar) const;
+
+private:
+    size_t                      cap;
+    size_t                      head;   // 下一次写入位置
+    size_t                      count;
+    std::vector<std::time_t>    dt;
+    std::vector<double>         open;
+    std::vector<double>         high;
+    std::vector<double>         low;
+    std::vector<double>         close;
+    std::vector<double>         turnover;
+    std::vector<int>            volume;
+    std::vector<int>            opi;
+    std::vector<int>            opiDelta;
+};
+
+/// 多周期K线合成
+/// tick只更新1秒K线，高一级周期由低一级周期收线时逐级合并得到：
+/// 1s -> 5s -> 1min -> 5min -> 15min -> 1h -> 1d，整个级联在处理tick的同一次调用中完成。
+/// 每个合约在连续数组中占一个槽位，每个周期各有一个定长环形缓冲区保存已完成的K线。
+/// 成交量/成交额由累计值差分得到，持仓量变化以上一根K线收盘为基准。
+/// tick按品种的交易时段归属K线：收盘后(含收盘集合竞价)归入前一分钟，
+/// 开盘集合竞价归入开盘第一分钟，其余非交易时间的tick不参与合成；日线按TradingDay切分。
+/// 非线程安全，只在行情主线程中调用。
+class KlineEngine
+{
+public:
+    enum Timeframe
+    {
+        TF_1S = 0,
+        TF_5S,
+        TF_1MIN,
+        TF_5MIN,
+        TF_15MIN,
+        TF_1H,
+        TF_DAY,
+        TF_COUNT
+    };
+
+    /// 1s/5s/1min/5min/15min/1h/1d
+    static const char* timeframeName(int tf);
+    /// 发布主题，如KLINE_1MIN
+    static const char* topic(int tf);
+    /// 接受timeframeName以及1m/5m/15m/60m/day等写法，无法识别返回-1
+    static int parseTimeframe(const std::string& name);
+
+    explicit KlineEngine(const SessionCalendar& calendar, size_t expectedInstruments = 4096, size_t ringSize = 512);
+
+    /// 设置无新tick时按墙钟收K线的延迟秒数
+    void setFlushDelay(int seconds) { flushDelaySec = seconds; }
+
+    /// 处理一条行情，各周期完成的K线追加到finished，返回完成的K线数
+    /// now用于确定K线所属的自然日，实盘为当前时间，回放为录制时间
+    size_t onTick(const CThostFtdcDepthMarketDataField& tick, std::vector<OHLCV>& finished, std::time_t now);
+
+    /// 收掉结束时间已超过flushDelay的K线（不活跃合约），返回完成的K线数
+    /// 日线只在TradingDay切换时收线
+    size_t flush(std::time_t now, std::vector<OHLCV>& finished);
+
+    /// 查询最近n根已完成的K线，按时间从旧到新追加到out，返回数量
+    size_t query(const std::string& symbol, int tf, size_t n, std::vector<OHLCV>& out) const;
+
+    /// K线CSV: symbol,datetime,open,high,low,close,volume,turnover,open_interest,oi_delta
+    static std::string toCsv(const OHLCV& bar);
+
+    size_t instruments() const { return slots.size(); }
+    uint64_t barsCompleted() const { return completedCount; }
+    uint64_t lateTicks() const { return lateCount; }
+
+private:
+    struct Level
+    {
+        OHLCV       bar;
+        bool        open;           // 是否有未完成的K线
+        BarRing     ring;
+    };
+
+    struct Slot
+    {
+        bool        hasBase;        // 是否已有累计量基准
+        int         baseVolume;     // 上一条tick的累计成交量
+        double      baseTurnover;   // 上一条tick的累计成交额
+        double      baseOpi;        // 上一根1秒K线收盘持仓量
+        int         tradingDay;     // YYYYMMDD
+        int         sessionSet;     // SessionCalendar::SessionSet
+        std::time_t lastStart;      // 最近一根已完成1秒K线的开始时间
+        Level       levels[TF_COUNT];
+    };
+
+    /// 日内秒数补全日期，得到K线开始时间
+    std::time_t barTime(int second, std::time_t now);
+    static std::time_t dayTime(int tradingDay);
+
+    Slot& slotOf(const char* instrumentID);
+    /// 时间推进到t（交易日为day），收掉所有周期已结束的K线并逐级合并
+    size_t roll(Slot& slot, std::time_t t, int day, std::vector<OHLCV>& finished);
+    void closeLevel(Slot& slot, int tf, std::vector<OHLCV>& finished);
+
+private:
+    const SessionCalendar&                      calendar;
+    std::vector<Slot>                           slots;
+    std::unordered_map<std::string, uint32_t>   index;
+    size_t                                      ringSize;
+    int                                         flushDelaySec;
+    std::time_t                                 dayStart;   // 本地零点，缓存mktime结果
+    uint64_t                                    completedCount;
+    uint64_t                                    lateCount;
+};
+
+/// K线按周期、按自然日追加写入CSV文件: <dir>/kline_<周期>_YYYYMMDD.csv
+class KlineFileWriter
+{
+public:
+    explicit KlineFileWriter(const std::string& dir);
+    ~KlineFileWriter();
+
+    bool write(const OHLCV& bar);
+    void flush();
+
+private:
+    std::string dir;
+    std::string day[KlineEngine::TF_COUNT];
+    FILE*       fp[KlineEngine::TF_COUNT];
+};
+
+#endif
@@ -2,8 +2,18 @@
 #define CTPQUOTE_H
 
 #include <vector>
+#include <atomic>
 #include "ThostFtdcMdApi.h"
 #include <appConfig.h>
+#include "readerwriterqueue.h"
+#include "MdSubscriptionManager.h"
+#include "FrontConnection.h"
+#include "TickArbiter.h"
+#include "MarketTick.h"
+
+typedef moodycamel::ReaderWriterQueue<MarketTick> MarketDataQueue;
+
+class ReplayMdApi;
 
 
 class CTPMarketSpi:public CThostFtdcMdSpi
@@ -70,15 +80,32 @@ public:
     void OnRtnForQuoteRsp(CThostFtdcForQuoteRspField *pForQuoteRsp);
 
 public:
-    bool Create(const CAppConfig&);
+    explicit CTPMarketSpi(int feedId = 0);
+    /// fronts为本路行情的前置地址列表（逗号分隔），为空时使用md_server
+    bool Create(const CAppConfig&, const std::string& fronts = "");
+    /// 多路行情时设置共享的仲裁表，nullptr表示不做仲裁
+    void setArbiter(TickArbiter* arb) { arbiter = arb; }
+    /// 本路行情的SPSC队列：生产者为本API回调线程，消费者为主线程
+    MarketDataQueue& queue() { return ticks; }
+    int  feedId() const { return feed; }
+    uint64_t received() const { return receivedCount.load(std::memory_order_relaxed); }
+    uint64_t dropped() const { return droppedCount.load(std::memory_order_relaxed); }
     void login();
     void subscribe(std::vector<std::string>&);
-    bool inner_sub(char pp[][32], int );
+    void unsubscribe(std::vector<std::string>&);
+    /// 按限速发送剩余的订阅/退订批次，由主线程循环调用
+    void pumpSubscriptions();
+    /// 登录重试与前置切换，由主线程循环调用
+    void pollConnection();
+    FrontConnection& connection() { return conn; }
     void Destroy();
 
 public:
     time_t     exitTs;
 
+private:
+    bool createApi();
+
 private:
 
     CThostFtdcMdApi *api;
@@ -87,6 +114,18 @@ private:
     std::string     password;
     int             requestid;
 
+    MdSubscriptionManager subs;
+    FrontConnection       conn;
+
+    int                   feed;
+    MarketDataQueue       ticks;
+    std::string           replayFile;   // 非空时用ReplayMdApi回放录制文件
+    double                replaySpeed;
+    bool                  replayLoop;
+    ReplayMdApi*          replayApi;    // 回放时与api相同，否则为空
+    TickArbiter*          arbiter;
+    std::atomic<uint64_t> receivedCount;
+    std::atomic<uint64_t> droppedCount;
 };
 
 #endif
\ No newline at end of file
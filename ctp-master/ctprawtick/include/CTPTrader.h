@@ -1,8 +1,14 @@
 #ifndef CTPTRADER_H
 #define CTPTRADER_H
 
+#include <atomic>
+#include <thread>
 #include "ThostFtdcTraderApi.h"
 #include "appConfig.h"
+#include "FrontConnection.h"
+#include "TraderEvent.h"
+#include "MockTraderApi.h"
+#include "readerwriterqueue.h"
 
 class CTPTraderSpi:public CThostFtdcTraderSpi
 {
@@ -178,14 +184,33 @@ public:
 
 public:
     // user define function
+    CTPTraderSpi();
+    virtual ~CTPTraderSpi();
     bool Create(const CAppConfig&);
     void Authenticate();
     void Login();
     void ReqInstruments();
     void ReqInvestorPositions();
     void ReqTradingAccount();
+    /// 登录重试与前置切换，由主线程/监控线程循环调用
+    void pollConnection();
+    FrontConnection& connection() { return conn; }
+    bool isLoggedIn() const { return conn.isLoggedIn(); }
     void Destroy();
 
+private:
+    bool createApi();
+
+    // 回调线程只做拷贝入队，其余处理都在工作线程
+    void postEvent(uint8_t type, const void* data, size_t size,
+                   CThostFtdcRspInfoField* pRspInfo, int nRequestID, bool bIsLast);
+    void workerLoop();
+    void stopWorker();
+    void handleInstrument(const TraderEvent& ev);
+    void handlePosition(const TraderEvent& ev);
+    void handleTradingAccount(const TraderEvent& ev);
+    void resetBatches();
+
 private:
     CThostFtdcTraderApi *api;
     std::string         brokerid;
@@ -194,6 +219,16 @@ private:
     std::string         appid;
     std::string         authcode;
     int                 requestid;
+    FrontConnection     conn;
+    bool                mock;           // 使用MockTraderApi，不连接前置
+    MockTraderOptions   mockOptions;
+
+    // SPSC队列：生产者为SDK回调线程，消费者为worker
+    moodycamel::BlockingReaderWriterQueue<TraderEvent> events;
+    std::thread         worker;
+    std::atomic<bool>   workerRunning;
+    bool                instrumentBatchOpen;    // 仅worker线程访问
+    bool                positionBatchOpen;
     
     // 数据库管理器
 };
@@ -0,0 +1,103 @@
+#ifndef FRONTCONNECTION_H
+#define FRONTCONNECTION_H
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+
+/// 前置连接状态机（行情/交易共用）
+/// SPI回调线程只调用on*系列函数修改状态，不会阻塞；登录重试、API重建
+/// 以及断线缺口通知都由主线程调用poll()/take*()驱动。
+/// 登录失败按指数退避重试；断线超过failoverSec仍未恢复、或登录请求发出后
+/// failoverSec内没有应答时，要求主线程轮换前置地址顺序并重建API。
+class FrontConnection
+{
+public:
+    enum State
+    {
+        FRONT_DISCONNECTED = 0,
+        FRONT_CONNECTED,
+        FRONT_LOGGING_IN,
+        FRONT_LOGGED_IN
+    };
+
+    enum Action
+    {
+        ACTION_NONE = 0,
+        ACTION_LOGIN,       ///主线程需要重新发送登录请求
+        ACTION_RECREATE     ///主线程需要释放并重建API（已切换前置顺序）
+    };
+
+    struct Stats
+    {
+        uint64_t reconnectCount;    ///断线后成功恢复登录的次数
+        uint64_t disconnectCount;   ///断线次数
+        uint64_t loginFailCount;    ///登录失败次数
+        uint64_t recreateCount;     ///API重建次数
+        int64_t  lastGapMs;         ///最近一次断线到恢复登录的耗时
+        int64_t  maxGapMs;
+        int64_t  totalGapMs;
+    };
+
+    explicit FrontConnection(const std::string& name);
+
+    /// serverList为逗号分隔的前置地址，可省略tcp://前缀
+    void configure(const std::string& serverList, int backoffMinMs, int backoffMaxMs, int failoverSec);
+
+    /// 当前的前置地址顺序，依次RegisterFront
+    std::vector<std::string> fronts() const;
+
+    // SPI回调线程调用
+    void onConnected();
+    void onLoginSent(bool ok);
+    void onLoginResult(bool ok);
+    void onDisconnected(int reason);
+
+    // 主线程调用
+    Action poll();
+    bool   takeGapStart(int& reason, int64_t& epochMs);
+    bool   takeGapEnd(int64_t& gapMs, int64_t& epochMs);
+
+    State state() const;
+    bool  isLoggedIn() const { return state() == FRONT_LOGGED_IN; }
+    Stats stats() const;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    Clock::duration backoff(int attempts) const;
+    Action          recreate(Clock::time_point now, const char* why);
+    static int64_t  nowEpochMs();
+
+private:
+    mutable std::mutex          mtx;
+    std::string                 name;
+    std::vector<std::string>    addrs;
+
+    int                         backoffMinMs;
+    int                         backoffMaxMs;
+    int                         failoverSec;
+
+    State                       st;
+    int                         loginAttempts;
+    int                         recreateAttempts;
+    Clock::time_point           nextLoginAt;
+    Clock::time_point           recreateAt;
+    Clock::time_point           loginDeadline;
+    bool                        loginDue;
+
+    bool                        inGap;
+    Clock::time_point           gapStart;
+    bool                        gapStartPending;
+    int                         gapReason;
+    int64_t                     gapStartEpochMs;
+    bool                        gapEndPending;
+    int64_t                     gapEndMs;
+    int64_t                     gapEndEpochMs;
+
+    Stats                       counters;
+};
+
+#endif
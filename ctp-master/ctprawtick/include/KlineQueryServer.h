@@ -0,0 +1,39 @@
+#ifndef KLINEQUERYSERVER_H
+#define KLINEQUERYSERVER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <zmq.hpp>
+#include "CTPKline1min.h"
+
+/// K线查询服务（ZMQ REP）
+/// 请求: "合约,周期,根数"，如 "rb2510,5min,100"
+/// 应答: 首行为CSV表头，其后按时间从旧到新每行一根已完成的K线；出错时应答 "ERROR,原因"
+/// poll()非阻塞，与KlineEngine在同一线程中调用，无需加锁。
+class KlineQueryServer
+{
+public:
+    KlineQueryServer(KlineEngine& engine, const std::string& address);
+    ~KlineQueryServer();
+
+    bool start();
+    /// 处理所有已到达的请求，返回处理数
+    int poll();
+    void stop();
+
+    uint64_t requests() const { return requestCount; }
+
+private:
+    std::string handle(const std::string& request);
+
+private:
+    KlineEngine&                        engine;
+    std::string                         address;
+    std::unique_ptr<zmq::context_t>     context;
+    std::unique_ptr<zmq::socket_t>      socket;
+    std::vector<OHLCV>                  bars;
+    uint64_t                            requestCount;
+};
+
+#endif
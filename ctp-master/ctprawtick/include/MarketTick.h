@@ -0,0 +1,17 @@
+#ifndef MARKETTICK_H
+#define MARKETTICK_H
+
+#include <cstdint>
+#include "ThostFtdcUserApiStruct.h"
+
+/// 行情队列中的元素：原始行情加SPI收到时的打点
+struct MarketTick
+{
+    CThostFtdcDepthMarketDataField data;
+    int64_t     recvNs;         ///单调时钟纳秒
+    int64_t     recvWallNs;     ///系统时钟纳秒
+    int64_t     dequeueNs;      ///主线程取出时的单调时钟纳秒
+    int64_t     eventWallNs;    ///行情所属的系统时钟纳秒，实盘同recvWallNs，回放时为录制时的接收时间
+};
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef MDSUBSCRIPTIONMANAGER_H
+#define MDSUBSCRIPTIONMANAGER_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include "ThostFtdcMdApi.h"
+
+/// 行情订阅管理器
+/// 合约代码保存在一张预分配、连续、地址固定的定长表中，SubscribeMarketData
+/// 直接使用表内指针，不再为每个批次new/delete字符串。
+/// 订阅/退订按批次分页发送，上一批的回报收齐（或超时）后才发送下一批，并按每秒请求数限速，
+/// 收到-2/-3时退避重试；
+/// 每个合约的订阅回报单独记录，断线重连登录后自动重新订阅。
+class MdSubscriptionManager
+{
+public:
+    enum SlotState
+    {
+        SLOT_IDLE       = 0,    ///未订阅
+        SLOT_PENDING    = 1,    ///等待发送订阅请求
+        SLOT_SENT       = 2,    ///订阅请求已发送，等待回报
+        SLOT_SUBSCRIBED = 3,    ///订阅成功
+        SLOT_FAILED     = 4,    ///订阅回报出错
+        SLOT_UNSUB_SENT = 5     ///退订请求已发送，等待回报
+    };
+
+    /// 每个合约代码占用的定长槽位宽度
+    static constexpr size_t kIdWidth = 32;
+    /// 已发送请求等待回报的超时时间，超时后按未发送处理
+    static constexpr int kAckTimeoutSeconds = 10;
+    /// 同一合约超时或退订出错的最大重试次数，重试间隔按1、2、4...秒递增
+    static constexpr int kMaxRetries = 5;
+
+    MdSubscriptionManager(size_t capacity = 65536, int batchSize = 100, int maxRequestsPerSecond = 5);
+
+    /// 设置分页大小与每秒最大请求数
+    void setPacing(int batchSize, int maxRequestsPerSecond);
+
+    /// 加入期望订阅的合约（重复合约忽略），返回新增数量
+    size_t add(const std::vector<std::string>& instruments);
+
+    /// 移除期望订阅的合约，已订阅的合约会在pump时发送退订请求，返回受影响数量
+    size_t remove(const std::vector<std::string>& instruments);
+
+    /// 登录成功：所有期望订阅的合约重新进入待发送状态
+    void onLogin();
+
+    /// 前置断开：已发送或已订阅的合约回退为待发送，等待重新登录
+    void onDisconnected();
+
+    /// 订阅/退订回报
+    void onSubAck(const char* instrumentID, int errorID);
+    void onUnSubAck(const char* instrumentID, int errorID);
+
+    /// 没有等待回报的请求时，在限速范围内发送下一批订阅/退订，返回本次发送的批次数
+    /// 可在SPI回调线程与主线程中调用，内部不会sleep
+    int pump(CThostFtdcMdApi* api);
+
+    size_t size() const;
+    size_t subscribedCount() const;
+    size_t pendingCount() const;
+    size_t failedCount() const;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    int  findSlot(const char* instrumentID) const;
+    bool acquireToken(Clock::time_point now);
+    int  sendBatch(CThostFtdcMdApi* api, bool subscribe, int count, Clock::time_point now);
+    const char* slotId(size_t idx) const { return ids.get() + idx * kIdWidth; }
+    void retryLater(size_t idx, uint8_t state, Clock::time_point now);
+    /// 处理超时的请求，返回仍在等待回报的合约数
+    size_t expireAcks(Clock::time_point now);
+
+private:
+    mutable std::mutex              mtx;
+
+    size_t                          capacity;
+    size_t                          count;
+    std::unique_ptr<char[]>         ids;        // capacity * kIdWidth，连续且地址固定
+    std::vector<uint8_t>            states;
+    std::vector<uint8_t>            wanted;
+    std::vector<uint8_t>            retries;    // 连续超时或退订出错的次数
+    std::vector<Clock::time_point>  deadlines;  // SENT/UNSUB_SENT为等待回报的截止时间，其余为最早重试时间
+    std::unordered_map<std::string_view, uint32_t> index;   // 键指向ids内部，回报查找不分配内存
+
+    std::vector<char*>              batchPtrs;  // 本批次的合约指针，指向ids内部
+    std::vector<uint32_t>           batchSlots;
+
+    int                             batchSize;
+    int                             maxRequestsPerSecond;
+    Clock::time_point               windowStart;
+    int                             windowRequests;
+    Clock::time_point               backoffUntil;
+    bool                            loggedIn;
+};
+
+#endif
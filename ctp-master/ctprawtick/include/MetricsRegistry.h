@@ -0,0 +1,143 @@
+#ifndef METRICSREGISTRY_H
+#define METRICSREGISTRY_H
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <cstdint>
+
+/// 运行指标，ctprawtick与zmq-dataupdate共用同一份定义。
+/// 计数器/仪表/直方图的更新只做原子操作，可在任意线程调用；
+/// 注册在启动时完成，导出时按Prometheus文本格式(0.0.4)输出。
+
+/// 单调递增计数器
+class MetricCounter
+{
+public:
+    MetricCounter() : v(0) {}
+
+    void inc(uint64_t n = 1) { v.fetch_add(n, std::memory_order_relaxed); }
+    /// 同步由其它模块维护的累计值（只在一个线程中调用）
+    void set(uint64_t n) { v.store(n, std::memory_order_relaxed); }
+    uint64_t value() const { return v.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> v;
+};
+
+/// 可增可减的仪表，如队列深度
+class MetricGauge
+{
+public:
+    MetricGauge() : v(0) {}
+
+    void set(int64_t n) { v.store(n, std::memory_order_relaxed); }
+    void add(int64_t n) { v.fetch_add(n, std::memory_order_relaxed); }
+    int64_t value() const { return v.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> v;
+};
+
+/// 固定桶直方图，bounds为各桶上界(升序)，另有+Inf桶
+class MetricHistogram
+{
+public:
+    explicit MetricHistogram(const std::vector<double>& bounds);
+
+    void observe(double value);
+
+    const std::vector<double>& bounds() const { return upper; }
+    /// 各桶计数（非累计），最后一个为+Inf桶
+    std::vector<uint64_t> counts() const;
+    double sum() const { return total.load(std::memory_order_relaxed); }
+
+    /// 指数桶: start, start*factor, ...共count个
+    static std::vector<double> exponential(double start, double factor, int count);
+
+private:
+    std::vector<double>                         upper;
+    std::unique_ptr<std::atomic<uint64_t>[]>    buckets;
+    std::atomic<double>                         total;
+};
+
+/// 指标注册表
+/// labels为不带花括号的Prometheus标签串，如 feed="0",reason="queue_full"；
+/// 同名不同标签的指标共享一组HELP/TYPE。
+class MetricsRegistry
+{
+public:
+    typedef std::function<double()> ValueFn;
+
+    MetricCounter&   counter(const std::string& name, const std::string& help, const std::string& labels = "");
+    MetricGauge&     gauge(const std::string& name, const std::string& help, const std::string& labels = "");
+    MetricHistogram& histogram(const std::string& name, const std::string& help, const std::vector<double>& bounds,
+                               const std::string& labels = "");
+
+    /// 导出时调用fn取值，fn在导出线程中执行，只能读取原子量或自带锁的数据
+    void counterFn(const std::string& name, const std::string& help, ValueFn fn, const std::string& labels = "");
+    void gaugeFn(const std::string& name, const std::string& help, ValueFn fn, const std::string& labels = "");
+
+    /// Prometheus文本格式
+    std::string render() const;
+
+private:
+    enum Type { COUNTER, GAUGE, HISTOGRAM };
+
+    struct Entry
+    {
+        std::string                         name;
+        std::string                         help;
+        std::string                         labels;
+        Type                                type;
+        std::unique_ptr<MetricCounter>      counter;
+        std::unique_ptr<MetricGauge>        gauge;
+        std::unique_ptr<MetricHistogram>    histogram;
+        ValueFn                             fn;
+    };
+
+    Entry& add(const std::string& name, const std::string& help, const std::string& labels, Type type);
+
+private:
+    mutable std::mutex  lock;
+    std::deque<Entry>   entries;
+};
+
+/// 最小的HTTP导出服务，只响应 GET /metrics，每个连接处理一个请求后关闭
+/// 单线程串行处理连接，每个连接的收发总共不超过kClientTimeoutMs，慢客户端不会卡住后续抓取
+class MetricsHttpServer
+{
+public:
+    static constexpr int kClientTimeoutMs = 2000;
+
+    explicit MetricsHttpServer(const MetricsRegistry& registry);
+    ~MetricsHttpServer();
+
+    /// 监听bindAddr:port并启动服务线程，失败返回false，原因见lastError()
+    bool start(const std::string& bindAddr, int port);
+    void stop();
+
+    const std::string& lastError() const { return error; }
+    uint64_t requests() const { return served.load(std::memory_order_relaxed); }
+
+private:
+    void run();
+    void handle(int fd);
+    static int waitReady(int fd, short events, const std::chrono::steady_clock::time_point& deadline);
+
+private:
+    const MetricsRegistry&  registry;
+    int                     listenFd;
+    std::thread             worker;
+    std::atomic<bool>       running;
+    std::atomic<uint64_t>   served;
+    std::string             error;
+};
+
+#endif
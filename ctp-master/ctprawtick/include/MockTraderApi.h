@@ -0,0 +1,191 @@
+#ifndef MOCKTRADERAPI_H
+#define MOCKTRADERAPI_H
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdint>
+#include "ThostFtdcTraderApi.h"
+
+/// 模拟交易前置的参数
+struct MockTraderOptions
+{
+    std::string fixtureDir;         ///fixture目录，含instruments.csv/positions.csv/account.csv，为空或缺文件时自动生成
+    int         syntheticInstruments;   ///自动生成的合约数
+    int         latencyMs;          ///请求到第一条回报的延迟
+    int         pageSize;           ///查询结果每页条数，页之间间隔pageGapMs，模拟CTP分包推送
+    int         pageGapMs;
+    int         queryPerSec;        ///每秒查询请求上限，超过返回-3
+    int         maxInflight;        ///未处理完的查询请求上限，超过返回-2
+
+    MockTraderOptions()
+        : syntheticInstruments(2000), latencyMs(20), pageSize(50), pageGapMs(1), queryPerSec(1), maxInflight(1)
+    {
+    }
+};
+
+/// 模拟交易API
+/// 实现CThostFtdcTraderApi接口，不连接前置，用fixture数据应答登录与合约/持仓/资金查询，
+/// 回报在自己的线程中按配置的延迟与分页异步回调，查询请求按CTP的流控规则返回-2/-3。
+/// 用于离线测试CTPTraderSpi的查询流程与启动耗时，未实现的请求直接返回0且没有回报。
+///
+/// fixture为CSV，#开头的行忽略：
+///   instruments.csv: InstrumentID,ExchangeID,ProductID,DeliveryYear,DeliveryMonth,VolumeMultiple,PriceTick,ExpireDate,LongMarginRatio,ShortMarginRatio
+///   positions.csv:   InstrumentID,ExchangeID,PosiDirection(2多/3空),Position,YdPosition,TodayPosition,PositionCost,OpenCost,UseMargin,PositionProfit,CloseProfit
+///   account.csv:     AccountID,PreBalance,Balance,Available,CurrMargin,FrozenMargin,CloseProfit,PositionProfit,Commission,Deposit,Withdraw
+class MockTraderApi final: public CThostFtdcTraderApi
+{
+public:
+    explicit MockTraderApi(const MockTraderOptions& options);
+
+    void Release() override;
+    void Init() override;
+    int Join() override;
+    const char *GetTradingDay() override { return tradingDay; }
+    void RegisterFront(char *pszFrontAddress) override {}
+    void RegisterNameServer(char *pszNsAddress) override {}
+    void RegisterFensUserInfo(CThostFtdcFensUserInfoField * pFensUserInfo) override {}
+    void RegisterSpi(CThostFtdcTraderSpi *pSpi) override { spi = pSpi; }
+    void SubscribePrivateTopic(THOST_TE_RESUME_TYPE nResumeType) override {}
+    void SubscribePublicTopic(THOST_TE_RESUME_TYPE nResumeType) override {}
+
+    int ReqAuthenticate(CThostFtdcReqAuthenticateField *pReqAuthenticateField, int nRequestID) override;
+    int ReqUserLogin(CThostFtdcReqUserLoginField *pReqUserLoginField, int nRequestID) override;
+    int ReqSettlementInfoConfirm(CThostFtdcSettlementInfoConfirmField *pSettlementInfoConfirm, int nRequestID) override;
+    int ReqQryInstrument(CThostFtdcQryInstrumentField *pQryInstrument, int nRequestID) override;
+    int ReqQryInvestorPosition(CThostFtdcQryInvestorPositionField *pQryInvestorPosition, int nRequestID) override;
+    int ReqQryTradingAccount(CThostFtdcQryTradingAccountField *pQryTradingAccount, int nRequestID) override;
+
+    /// 以下请求不模拟
+    int RegisterUserSystemInfo(CThostFtdcUserSystemInfoField *pUserSystemInfo) override { return 0; }
+    int SubmitUserSystemInfo(CThostFtdcUserSystemInfoField *pUserSystemInfo) override { return 0; }
+    int ReqUserLogout(CThostFtdcUserLogoutField *pUserLogout, int nRequestID) override { return 0; }
+    int ReqUserPasswordUpdate(CThostFtdcUserPasswordUpdateField *pUserPasswordUpdate, int nRequestID) override { return 0; }
+    int ReqTradingAccountPasswordUpdate(CThostFtdcTradingAccountPasswordUpdateField *pTradingAccountPasswordUpdate, int nRequestID) override { return 0; }
+    int ReqUserAuthMethod(CThostFtdcReqUserAuthMethodField *pReqUserAuthMethod, int nRequestID) override { return 0; }
+    int ReqGenUserCaptcha(CThostFtdcReqGenUserCaptchaField *pReqGenUserCaptcha, int nRequestID) override { return 0; }
+    int ReqGenUserText(CThostFtdcReqGenUserTextField *pReqGenUserText, int nRequestID) override { return 0; }
+    int ReqUserLoginWithCaptcha(CThostFtdcReqUserLoginWithCaptchaField *pReqUserLoginWithCaptcha, int nRequestID) override { return 0; }
+    int ReqUserLoginWithText(CThostFtdcReqUserLoginWithTextField *pReqUserLoginWithText, int nRequestID) override { return 0; }
+    int ReqUserLoginWithOTP(CThostFtdcReqUserLoginWithOTPField *pReqUserLoginWithOTP, int nRequestID) override { return 0; }
+    int ReqOrderInsert(CThostFtdcInputOrderField *pInputOrder, int nRequestID) override { return 0; }
+    int ReqParkedOrderInsert(CThostFtdcParkedOrderField *pParkedOrder, int nRequestID) override { return 0; }
+    int ReqParkedOrderAction(CThostFtdcParkedOrderActionField *pParkedOrderAction, int nRequestID) override { return 0; }
+    int ReqOrderAction(CThostFtdcInputOrderActionField *pInputOrderAction, int nRequestID) override { return 0; }
+    int ReqQueryMaxOrderVolume(CThostFtdcQueryMaxOrderVolumeField *pQueryMaxOrderVolume, int nRequestID) override { return 0; }
+    int ReqRemoveParkedOrder(CThostFtdcRemoveParkedOrderField *pRemoveParkedOrder, int nRequestID) override { return 0; }
+    int ReqRemoveParkedOrderAction(CThostFtdcRemoveParkedOrderActionField *pRemoveParkedOrderAction, int nRequestID) override { return 0; }
+    int ReqExecOrderInsert(CThostFtdcInputExecOrderField *pInputExecOrder, int nRequestID) override { return 0; }
+    int ReqExecOrderAction(CThostFtdcInputExecOrderActionField *pInputExecOrderAction, int nRequestID) override { return 0; }
+    int ReqForQuoteInsert(CThostFtdcInputForQuoteField *pInputForQuote, int nRequestID) override { return 0; }
+    int ReqQuoteInsert(CThostFtdcInputQuoteField *pInputQuote, int nRequestID) override { return 0; }
+    int ReqQuoteAction(CThostFtdcInputQuoteActionField *pInputQuoteAction, int nRequestID) override { return 0; }
+    int ReqBatchOrderAction(CThostFtdcInputBatchOrderActionField *pInputBatchOrderAction, int nRequestID) override { return 0; }
+    int ReqOptionSelfCloseInsert(CThostFtdcInputOptionSelfCloseField *pInputOptionSelfClose, int nRequestID) override { return 0; }
+    int ReqOptionSelfCloseAction(CThostFtdcInputOptionSelfCloseActionField *pInputOptionSelfCloseAction, int nRequestID) override { return 0; }
+    int ReqCombActionInsert(CThostFtdcInputCombActionField *pInputCombAction, int nRequestID) override { return 0; }
+    int ReqQryOrder(CThostFtdcQryOrderField *pQryOrder, int nRequestID) override { return 0; }
+    int ReqQryTrade(CThostFtdcQryTradeField *pQryTrade, int nRequestID) override { return 0; }
+    int ReqQryInvestor(CThostFtdcQryInvestorField *pQryInvestor, int nRequestID) override { return 0; }
+    int ReqQryTradingCode(CThostFtdcQryTradingCodeField *pQryTradingCode, int nRequestID) override { return 0; }
+    int ReqQryInstrumentMarginRate(CThostFtdcQryInstrumentMarginRateField *pQryInstrumentMarginRate, int nRequestID) override { return 0; }
+    int ReqQryInstrumentCommissionRate(CThostFtdcQryInstrumentCommissionRateField *pQryInstrumentCommissionRate, int nRequestID) override { return 0; }
+    int ReqQryExchange(CThostFtdcQryExchangeField *pQryExchange, int nRequestID) override { return 0; }
+    int ReqQryProduct(CThostFtdcQryProductField *pQryProduct, int nRequestID) override { return 0; }
+    int ReqQryDepthMarketData(CThostFtdcQryDepthMarketDataField *pQryDepthMarketData, int nRequestID) override { return 0; }
+    int ReqQrySettlementInfo(CThostFtdcQrySettlementInfoField *pQrySettlementInfo, int nRequestID) override { return 0; }
+    int ReqQryTransferBank(CThostFtdcQryTransferBankField *pQryTransferBank, int nRequestID) override { return 0; }
+    int ReqQryInvestorPositionDetail(CThostFtdcQryInvestorPositionDetailField *pQryInvestorPositionDetail, int nRequestID) override { return 0; }
+    int ReqQryNotice(CThostFtdcQryNoticeField *pQryNotice, int nRequestID) override { return 0; }
+    int ReqQrySettlementInfoConfirm(CThostFtdcQrySettlementInfoConfirmField *pQrySettlementInfoConfirm, int nRequestID) override { return 0; }
+    int ReqQryInvestorPositionCombineDetail(CThostFtdcQryInvestorPositionCombineDetailField *pQryInvestorPositionCombineDetail, int nRequestID) override { return 0; }
+    int ReqQryCFMMCTradingAccountKey(CThostFtdcQryCFMMCTradingAccountKeyField *pQryCFMMCTradingAccountKey, int nRequestID) override { return 0; }
+    int ReqQryEWarrantOffset(CThostFtdcQryEWarrantOffsetField *pQryEWarrantOffset, int nRequestID) override { return 0; }
+    int ReqQryInvestorProductGroupMargin(CThostFtdcQryInvestorProductGroupMarginField *pQryInvestorProductGroupMargin, int nRequestID) override { return 0; }
+    int ReqQryExchangeMarginRate(CThostFtdcQryExchangeMarginRateField *pQryExchangeMarginRate, int nRequestID) override { return 0; }
+    int ReqQryExchangeMarginRateAdjust(CThostFtdcQryExchangeMarginRateAdjustField *pQryExchangeMarginRateAdjust, int nRequestID) override { return 0; }
+    int ReqQryExchangeRate(CThostFtdcQryExchangeRateField *pQryExchangeRate, int nRequestID) override { return 0; }
+    int ReqQrySecAgentACIDMap(CThostFtdcQrySecAgentACIDMapField *pQrySecAgentACIDMap, int nRequestID) override { return 0; }
+    int ReqQryProductExchRate(CThostFtdcQryProductExchRateField *pQryProductExchRate, int nRequestID) override { return 0; }
+    int ReqQryProductGroup(CThostFtdcQryProductGroupField *pQryProductGroup, int nRequestID) override { return 0; }
+    int ReqQryMMInstrumentCommissionRate(CThostFtdcQryMMInstrumentCommissionRateField *pQryMMInstrumentCommissionRate, int nRequestID) override { return 0; }
+    int ReqQryMMOptionInstrCommRate(CThostFtdcQryMMOptionInstrCommRateField *pQryMMOptionInstrCommRate, int nRequestID) override { return 0; }
+    int ReqQryInstrumentOrderCommRate(CThostFtdcQryInstrumentOrderCommRateField *pQryInstrumentOrderCommRate, int nRequestID) override { return 0; }
+    int ReqQrySecAgentTradingAccount(CThostFtdcQryTradingAccountField *pQryTradingAccount, int nRequestID) override { return 0; }
+    int ReqQrySecAgentCheckMode(CThostFtdcQrySecAgentCheckModeField *pQrySecAgentCheckMode, int nRequestID) override { return 0; }
+    int ReqQrySecAgentTradeInfo(CThostFtdcQrySecAgentTradeInfoField *pQrySecAgentTradeInfo, int nRequestID) override { return 0; }
+    int ReqQryOptionInstrTradeCost(CThostFtdcQryOptionInstrTradeCostField *pQryOptionInstrTradeCost, int nRequestID) override { return 0; }
+    int ReqQryOptionInstrCommRate(CThostFtdcQryOptionInstrCommRateField *pQryOptionInstrCommRate, int nRequestID) override { return 0; }
+    int ReqQryExecOrder(CThostFtdcQryExecOrderField *pQryExecOrder, int nRequestID) override { return 0; }
+    int ReqQryForQuote(CThostFtdcQryForQuoteField *pQryForQuote, int nRequestID) override { return 0; }
+    int ReqQryQuote(CThostFtdcQryQuoteField *pQryQuote, int nRequestID) override { return 0; }
+    int ReqQryOptionSelfClose(CThostFtdcQryOptionSelfCloseField *pQryOptionSelfClose, int nRequestID) override { return 0; }
+    int ReqQryInvestUnit(CThostFtdcQryInvestUnitField *pQryInvestUnit, int nRequestID) override { return 0; }
+    int ReqQryCombInstrumentGuard(CThostFtdcQryCombInstrumentGuardField *pQryCombInstrumentGuard, int nRequestID) override { return 0; }
+    int ReqQryCombAction(CThostFtdcQryCombActionField *pQryCombAction, int nRequestID) override { return 0; }
+    int ReqQryTransferSerial(CThostFtdcQryTransferSerialField *pQryTransferSerial, int nRequestID) override { return 0; }
+    int ReqQryAccountregister(CThostFtdcQryAccountregisterField *pQryAccountregister, int nRequestID) override { return 0; }
+    int ReqQryContractBank(CThostFtdcQryContractBankField *pQryContractBank, int nRequestID) override { return 0; }
+    int ReqQryParkedOrder(CThostFtdcQryParkedOrderField *pQryParkedOrder, int nRequestID) override { return 0; }
+    int ReqQryParkedOrderAction(CThostFtdcQryParkedOrderActionField *pQryParkedOrderAction, int nRequestID) override { return 0; }
+    int ReqQryTradingNotice(CThostFtdcQryTradingNoticeField *pQryTradingNotice, int nRequestID) override { return 0; }
+    int ReqQryBrokerTradingParams(CThostFtdcQryBrokerTradingParamsField *pQryBrokerTradingParams, int nRequestID) override { return 0; }
+    int ReqQryBrokerTradingAlgos(CThostFtdcQryBrokerTradingAlgosField *pQryBrokerTradingAlgos, int nRequestID) override { return 0; }
+    int ReqQueryCFMMCTradingAccountToken(CThostFtdcQueryCFMMCTradingAccountTokenField *pQueryCFMMCTradingAccountToken, int nRequestID) override { return 0; }
+    int ReqFromBankToFutureByFuture(CThostFtdcReqTransferField *pReqTransfer, int nRequestID) override { return 0; }
+    int ReqFromFutureToBankByFuture(CThostFtdcReqTransferField *pReqTransfer, int nRequestID) override { return 0; }
+    int ReqQueryBankAccountMoneyByFuture(CThostFtdcReqQueryAccountField *pReqQueryAccount, int nRequestID) override { return 0; }
+
+private:
+    ~MockTraderApi();
+
+    struct Request
+    {
+        enum Type { AUTHENTICATE, LOGIN, SETTLEMENT_CONFIRM, QRY_INSTRUMENT, QRY_POSITION, QRY_ACCOUNT };
+        Type                type;
+        int                 requestID;
+        std::string         instrumentID;   // 查询过滤条件，为空查全部
+    };
+
+    /// 非查询请求直接入队
+    int post(Request::Type type, int requestID);
+    /// 查询请求先做流控检查
+    int postQuery(Request::Type type, int requestID, const char* instrumentID);
+    void run();
+    /// 查询的最后一条回报发出前释放在途计数
+    void finishQuery();
+    void process(const Request& req);
+    /// 按分页回调查询结果，rows为空时回调一次空结果
+    template<typename Field, typename Callback>
+    void respondPages(const std::vector<Field>& rows, const std::string& filter, int requestID, Callback callback);
+    /// 等待ms毫秒，收到停止信号返回false
+    bool delay(int ms);
+
+    void loadFixtures();
+    void buildSynthetic();
+
+private:
+    MockTraderOptions                       options;
+    CThostFtdcTraderSpi*                    spi;
+    TThostFtdcDateType                      tradingDay;
+
+    std::vector<CThostFtdcInstrumentField>  instruments;
+    std::vector<CThostFtdcInvestorPositionField> positions;
+    CThostFtdcTradingAccountField           account;
+
+    std::thread                             worker;
+    std::atomic<bool>                       running;
+    std::mutex                              lock;
+    std::condition_variable                 cond;
+    std::deque<Request>                     requests;       // lock保护
+    std::deque<int64_t>                     querySent;      // 最近1秒内查询请求的发送时间(ms)，lock保护
+    int                                     inflight;       // 未处理完的查询请求数，lock保护
+
+    std::atomic<uint64_t>                   rejectCount;
+};
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef REPLAYMDAPI_H
+#define REPLAYMDAPI_H
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <unordered_set>
+#include "ThostFtdcMdApi.h"
+#include "TickRecorder.h"
+
+/// 回放行情API
+/// 实现CThostFtdcMdApi接口，从录制文件读取行情，在自己的线程中按CTP的回调顺序驱动SPI：
+/// Init后回调OnFrontConnected，登录请求回调OnRspUserLogin，订阅请求逐个合约回调OnRspSubMarketData，
+/// 登录后按录制时的接收间隔回调OnRtnDepthMarketData，只推送已订阅的合约。
+/// speed为1按原速，N为N倍速，0为不等待全速回放；SPI队列满时回放线程等待主线程取走，不丢行情。
+/// 与真实API一样，请求接口只登记请求，回报在回放线程中异步回调。
+class ReplayMdApi final: public CThostFtdcMdApi
+{
+public:
+    ReplayMdApi(const std::string& path, double speed, bool loop);
+
+    void Release() override;
+    void Init() override;
+    int Join() override;
+    const char *GetTradingDay() override { return tradingDay; }
+    void RegisterFront(char *pszFrontAddress) override {}
+    void RegisterNameServer(char *pszNsAddress) override {}
+    void RegisterFensUserInfo(CThostFtdcFensUserInfoField * pFensUserInfo) override {}
+    void RegisterSpi(CThostFtdcMdSpi *pSpi) override { spi = pSpi; }
+    int SubscribeMarketData(char *ppInstrumentID[], int nCount) override;
+    int UnSubscribeMarketData(char *ppInstrumentID[], int nCount) override;
+    int SubscribeForQuoteRsp(char *ppInstrumentID[], int nCount) override { return 0; }
+    int UnSubscribeForQuoteRsp(char *ppInstrumentID[], int nCount) override { return 0; }
+    int ReqUserLogin(CThostFtdcReqUserLoginField *pReqUserLoginField, int nRequestID) override;
+    int ReqUserLogout(CThostFtdcUserLogoutField *pUserLogout, int nRequestID) override { return 0; }
+    int ReqQryMulticastInstrument(CThostFtdcQryMulticastInstrumentField *pQryMulticastInstrument, int nRequestID) override { return 0; }
+
+    /// 读出录制文件中出现过的全部合约（按首次出现的顺序），回放时用它代替配置的订阅列表
+    static bool scanInstruments(const std::string& path, std::vector<std::string>& instruments);
+
+    /// 当前回调的行情录制时的接收时间（系统时钟纳秒），只在OnRtnDepthMarketData中有效
+    int64_t recordedWallNs() const { return currentWallNs; }
+    /// 回放线程是否仍在运行，SPI在队列满时据此决定继续等待还是放弃
+    bool isRunning() const { return running; }
+
+private:
+    ~ReplayMdApi();
+
+    struct Request
+    {
+        enum Type { LOGIN, SUBSCRIBE, UNSUBSCRIBE };
+        Type                        type;
+        int                         requestID;
+        std::vector<std::string>    instruments;
+    };
+
+    void run();
+    /// 处理已登记的请求，回调对应的回报
+    void processRequests();
+    /// 按回放速度等待到该条行情的发送时刻，收到停止信号返回false
+    bool pace(int64_t recvNs);
+
+private:
+    std::string                     path;
+    double                          speed;
+    bool                            loop;
+    CThostFtdcMdSpi*                spi;
+    TThostFtdcDateType              tradingDay;
+    TickFileReader                  reader;
+
+    std::thread                     worker;
+    std::atomic<bool>               running;
+    std::atomic<bool>               loggedIn;
+
+    std::mutex                      lock;
+    std::vector<Request>            requests;       // lock保护
+    std::atomic<bool>               pending;        // requests非空
+    std::unordered_set<std::string> subscribed;     // 只在回放线程中访问
+
+    int64_t                         baseRecvNs;     // 本轮回放第一条行情的接收时间
+    int64_t                         baseWallNs;     // 本轮回放开始的墙钟时间
+    uint64_t                        replayed;
+    uint64_t                        skipped;        // 未订阅合约的记录数
+    int64_t                         currentWallNs;
+};
+
+#endif
@@ -0,0 +1,95 @@
+#ifndef SESSIONCALENDAR_H
+#define SESSIONCALENDAR_H
+
+#include <string>
+#include <vector>
+#include <ctime>
+#include <cstdint>
+#include "ThostFtdcUserApiStruct.h"
+#include "ProductTable.h"
+
+/// 交易时段日历
+/// 各品种按交易所、夜盘收盘时间归入若干时段组（品种表见ProductTable），每组预先展开成1440分钟的表，
+/// 给定日内秒数即可O(1)查到所在小节与交易日内的分钟序号。
+/// 交易日按周末与配置的节假日计算，长假前最后一个交易日没有夜盘。
+/// 日期均为YYYYMMDD整数，时间为本地(北京)时间。
+class SessionCalendar
+{
+public:
+    enum SessionSet
+    {
+        SET_DAY         = ProductTable::SESSION_DAY,
+        SET_NIGHT_2300  = ProductTable::SESSION_NIGHT_2300,
+        SET_NIGHT_0100  = ProductTable::SESSION_NIGHT_0100,
+        SET_NIGHT_0230  = ProductTable::SESSION_NIGHT_0230,
+        SET_CFFEX_INDEX = ProductTable::SESSION_CFFEX_INDEX,
+        SET_CFFEX_BOND  = ProductTable::SESSION_CFFEX_BOND,
+        SET_ALL,            ///以上全部的并集，用于未知品种与程序调度
+        SET_COUNT
+    };
+
+    typedef ProductTable::Entry Product;
+
+    explicit SessionCalendar(const std::vector<std::string>& holidays = std::vector<std::string>());
+
+    void setHolidays(const std::vector<std::string>& holidays);
+
+    /// 按合约代码的字母前缀查品种，未知品种返回nullptr
+    const Product* product(const char* instrumentID) const;
+    /// 合约所属时段组，未知品种返回SET_ALL
+    int sessionSetOf(const char* instrumentID) const;
+
+    /// "HH:MM:SS"转换为日内秒数，格式错误返回-1
+    static int secondOfDay(const char* updateTime);
+
+    /// 交易日内的分钟序号（夜盘在前），非交易时间返回-1
+    int minuteIndex(int set, int second) const { return minuteIdx[set][second / 60]; }
+    /// 交易日内的第几小节，非交易时间返回-1
+    int sessionIndex(int set, int second) const { return sessionNo[set][second / 60]; }
+    /// K线归属的日内秒数：收盘后的tick(含收盘集合竞价)归入前一分钟，
+    /// 开盘集合竞价归入开盘第一分钟，其余非交易时间返回-1
+    int barSecond(int set, int second) const;
+
+    bool isTradingDay(int date) const;
+    int nextTradingDay(int date) const;
+    /// date晚上是否有夜盘
+    bool hasNightSession(int date) const;
+    /// 自然日date、日内秒数second所属的交易日
+    int tradingDayOf(int date, int second) const;
+
+    /// now是否处于set的交易时间
+    bool isTrading(int set, std::time_t now) const;
+    bool isTrading(std::time_t now) const { return isTrading(SET_ALL, now); }
+    /// 当前或下一个连续交易时段（日盘或夜盘）的结束时间
+    std::time_t nextClose(std::time_t now) const;
+
+    /// 按本地时钟修正行情的ActionDay(自然日)与TradingDay：
+    /// 大商所夜盘ActionDay为交易日，郑商所夜盘TradingDay为自然日
+    void fixDates(CThostFtdcDepthMarketDataField& tick, std::time_t now);
+
+    /// 本地日期YYYYMMDD，second返回日内秒数
+    static int localDate(std::time_t t, int* second = nullptr);
+    static int addDays(int date, int days);
+
+private:
+    void build();
+
+private:
+    int16_t                 minuteIdx[SET_COUNT][1440];
+    int8_t                  sessionNo[SET_COUNT][1440];
+    std::vector<int>        holidays;       // 有序
+
+    // SET_ALL的日盘/夜盘起止，相对自然日零点的秒数，夜盘收盘可超过86400
+    int                     dayOpen;
+    int                     dayClose;
+    int                     nightOpen;
+    int                     nightClose;
+
+    // fixDates缓存
+    std::time_t             dayStart;
+    int                     today;
+    int                     cachedDate[3];
+    int                     cachedTradingDay[3];
+};
+
+#endif
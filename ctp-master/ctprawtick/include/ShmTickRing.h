@@ -0,0 +1,134 @@
+#ifndef SHMTICKRING_H
+#define SHMTICKRING_H
+
+#include <string>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+/// 同机行情共享内存广播环，ctprawtick写、zmq-dataupdate及策略进程读，两边共用同一份定义。
+///
+/// /dev/shm/<name> 中是一个头部加2的幂个定长槽位。单写多读，读端互不影响、也不反压写端：
+/// 写第n条时把槽位序号置为奇数(2n+1)、拷贝数据、再置为偶数(2n+2)，最后推进头部的writeSeq；
+/// 读端按自己的游标读取，拷贝前后槽位序号一致且等于2n+2才算读到完整数据（seqlock），
+/// 落后超过一圈时跳到最旧的可读位置并累计丢失条数。
+
+/// 环中的行情记录，字段与CThostFtdcDepthMarketDataField一致，另带发布端打点
+struct ShmTick
+{
+    double  LastPrice;
+    double  PreSettlementPrice;
+    double  PreClosePrice;
+    double  PreOpenInterest;
+    double  OpenPrice;
+    double  HighestPrice;
+    double  LowestPrice;
+    double  Turnover;
+    double  OpenInterest;
+    double  ClosePrice;
+    double  SettlementPrice;
+    double  UpperLimitPrice;
+    double  LowerLimitPrice;
+    double  PreDelta;
+    double  CurrDelta;
+    double  AveragePrice;
+    double  BidPrice[5];
+    double  AskPrice[5];
+
+    int64_t recvNs;             ///SPI收到时的单调时钟纳秒
+    int64_t recvWallNs;         ///SPI收到时的系统时钟纳秒
+    int64_t publishNs;          ///写入环时的单调时钟纳秒
+
+    int32_t Volume;
+    int32_t UpdateMillisec;
+    int32_t BidVolume[5];
+    int32_t AskVolume[5];
+    uint32_t quarantine;        ///非0为校验不通过的行情（命中的TickValidator规则位），读端不应按正常行情处理
+
+    char    TradingDay[9];
+    char    ActionDay[9];
+    char    UpdateTime[9];
+    char    ExchangeID[9];
+    char    InstrumentID[81];
+    char    ExchangeInstID[81];
+};
+
+/// 共享内存头部
+struct ShmRingHeader
+{
+    std::atomic<uint64_t>   magic;          ///初始化完成后写入，环被写端废弃时清零
+    uint32_t                version;
+    uint32_t                slotSize;
+    uint64_t                capacity;       ///槽位数，2的幂
+    uint64_t                reserved[5];
+    std::atomic<uint64_t>   writeSeq;       ///已写完的条数，下一条的序号
+    char                    pad[56];
+};
+
+/// 槽位，按缓存行对齐避免相邻槽位的伪共享
+struct alignas(64) ShmRingSlot
+{
+    std::atomic<uint64_t>   seq;            ///写入中为奇数，写完第n条后为2n+2
+    ShmTick                 tick;
+};
+
+/// 写端，只能有一个进程写同一个环
+class ShmTickWriter
+{
+public:
+    ShmTickWriter();
+    ~ShmTickWriter();
+
+    /// 创建或复用/dev/shm/<name>，几何参数相同时沿用原序号，读端无需重连；
+    /// 容量不同时废弃旧环另建新环，已连接的读端通过stale()发现后重新open
+    bool open(const std::string& name, size_t capacity, std::string& error);
+    void close();
+    bool isOpen() const { return header != nullptr; }
+
+    void publish(const ShmTick& tick);
+    uint64_t published() const;
+
+private:
+    std::string     name;
+    void*           base;
+    size_t          mappedSize;
+    ShmRingHeader*  header;
+    ShmRingSlot*    slots;
+    uint64_t        mask;
+};
+
+/// 读端，每个读端有自己的游标
+class ShmTickReader
+{
+public:
+    ShmTickReader();
+    ~ShmTickReader();
+
+    /// 映射已存在的环，游标从最新位置开始
+    bool open(const std::string& name, std::string& error);
+    void close();
+    bool isOpen() const { return header != nullptr; }
+
+    /// 取下一条，没有新数据返回false
+    bool poll(ShmTick& out);
+
+    /// 跳到最新位置，丢弃未读数据（不计入丢失）
+    void seekLatest();
+    /// 读端落后超过一圈被覆盖而丢失的条数
+    uint64_t overruns() const { return lost; }
+    /// 尚未读取的条数
+    uint64_t backlog() const;
+    /// 写端已废弃此环，需要重新open
+    bool stale() const;
+
+private:
+    void*           base;
+    size_t          mappedSize;
+    ShmRingHeader*  header;
+    ShmRingSlot*    slots;
+    uint64_t        mask;
+    uint64_t        cursor;
+    uint64_t        lost;
+};
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef THREADTUNING_H
+#define THREADTUNING_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+
+/// 线程角色配置：命名、绑核、实时调度、NUMA内存绑定，ctprawtick与zmq-dataupdate共用。
+/// 配置格式为 角色:键=值;键=值，例如
+///     md_main:cpus=2;prio=60;numa=0
+///     md_spi:cpus=3-4
+/// cpus为逗号分隔的CPU编号或区间；prio为1-99时使用SCHED_FIFO（需要CAP_SYS_NICE），0为普通调度；
+/// numa为内存绑定的节点，-1为不绑定。未配置的角色只设置线程名。
+struct ThreadSpec
+{
+    std::vector<int>    cpus;
+    int                 priority;
+    int                 numaNode;
+
+    ThreadSpec() : priority(0), numaNode(-1) {}
+};
+
+class ThreadTuning
+{
+public:
+    /// 进程内共享的配置表
+    static ThreadTuning& global();
+
+    /// 解析单条配置，失败时error说明原因
+    static bool parse(const std::string& text, std::string& role, ThreadSpec& spec, std::string& error);
+
+    /// 逐条解析并登记，遇到错误继续处理其余条目，返回false时error汇总所有错误
+    bool load(const std::vector<std::string>& specs, std::string& error);
+    void set(const std::string& role, const ThreadSpec& spec);
+    bool has(const std::string& role) const;
+
+    /// 按角色设置调用线程；name为线程名（最多15字节），为空时用角色名。
+    /// 部分设置失败时其余设置仍然生效，返回false并在error中说明。
+    bool apply(const std::string& role, const std::string& name, std::string& error) const;
+
+    /// 配置的可读描述，用于启动日志
+    static std::string describe(const std::string& role, const ThreadSpec& spec);
+    std::vector<std::string> describeAll() const;
+
+private:
+    mutable std::mutex                  lock;
+    std::map<std::string, ThreadSpec>   roles;
+};
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef TICKARBITER_H
+#define TICKARBITER_H
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include "ThostFtdcUserApiStruct.h"
+
+/// 多路行情仲裁
+/// 同一合约的行情按(UpdateTime, UpdateMillisec, Volume)组成64位序号，
+/// 序号严格递增的第一条行情被接受，其余线路上的相同或更旧行情被丢弃。
+/// 开放寻址哈希表，槽位只增不删，插入与更新都通过CAS完成，
+/// 各行情API回调线程可并发调用accept()，无锁。
+class TickArbiter
+{
+public:
+    explicit TickArbiter(size_t expectedInstruments = 4096);
+
+    /// 返回true表示该行情是首次到达，应当发布
+    bool accept(const CThostFtdcDepthMarketDataField& tick);
+
+    /// 行情序号：按交易时段排序的秒数(17位) | 毫秒(10位) | 成交量(37位)
+    static uint64_t sequence(const CThostFtdcDepthMarketDataField& tick);
+
+    uint64_t accepted() const { return acceptedCount.load(std::memory_order_relaxed); }
+    uint64_t duplicates() const { return duplicateCount.load(std::memory_order_relaxed); }
+
+private:
+    struct Slot
+    {
+        std::atomic<uint64_t> key;  // 合约代码哈希，0表示空槽
+        std::atomic<uint64_t> seq;  // 已发布的最大序号
+    };
+
+    static uint64_t hashId(const char* id);
+    Slot* findOrInsert(uint64_t key);
+
+private:
+    size_t                      mask;
+    std::unique_ptr<Slot[]>     slots;
+    std::atomic<uint64_t>       acceptedCount;
+    std::atomic<uint64_t>       duplicateCount;
+};
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef TICKRECORDER_H
+#define TICKRECORDER_H
+
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include "ThostFtdcUserApiStruct.h"
+
+/// 行情录制文件
+/// 文件头之后是定长记录，每条记录为接收时间戳加原始CThostFtdcDepthMarketDataField，
+/// 不做任何编码，回放时按原样交给OnRtnDepthMarketData。
+/// 文件头记录结构体大小，CTP版本升级导致结构体变化时拒绝读取。
+struct TickFileHeader
+{
+    char        magic[8];       ///"CTPTICK"
+    uint32_t    version;
+    uint32_t    recordSize;     ///sizeof(TickRecord)
+};
+
+struct TickRecord
+{
+    int64_t     recvNs;         ///接收时间，纳秒(系统时钟)
+    int32_t     feed;           ///行情线路
+    int32_t     reserved;
+    CThostFtdcDepthMarketDataField data;
+};
+
+/// 追加写入录制文件，fwrite带缓冲，只在行情主线程中调用
+class TickRecorder
+{
+public:
+    TickRecorder();
+    ~TickRecorder();
+
+    /// 创建文件并写入文件头，已存在的文件被覆盖
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return fp != nullptr; }
+
+    bool write(const CThostFtdcDepthMarketDataField& tick, int64_t recvNs, int feed);
+    void flush();
+
+    uint64_t records() const { return count; }
+    const std::string& path() const { return file; }
+
+private:
+    std::string file;
+    FILE*       fp;
+    uint64_t    count;
+};
+
+/// 顺序读取录制文件
+class TickFileReader
+{
+public:
+    TickFileReader();
+    ~TickFileReader();
+
+    /// 打开文件并校验文件头
+    bool open(const std::string& path);
+    void close();
+    /// 回到第一条记录
+    bool rewind();
+
+    /// 读取下一条记录，文件结束返回false
+    bool next(TickRecord& record);
+
+private:
+    FILE*       fp;
+};
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef TICKVALIDATOR_H
+#define TICKVALIDATOR_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include "ThostFtdcUserApiStruct.h"
+#include "MarketTick.h"
+#include "SessionCalendar.h"
+
+/// 行情校验
+/// 按规则检查每条tick，返回违反规则的位掩码，各规则的比较结果直接按位合并，不做分支判断。
+/// 无状态规则(价格无效/超出涨跌停/盘口交叉/非交易时间)对一批tick逐条计算，
+/// 有状态规则(时间倒退/成交量倒退)与合约上一条通过校验的tick比较，交易日切换时重置。
+/// 命中丢弃规则的tick不更新合约状态，避免一条坏数据污染后续判断。
+/// 非线程安全，只在行情主线程中调用。
+class TickValidator
+{
+public:
+    enum Rule
+    {
+        RULE_BAD_PRICE = 0,     ///最新价无效(0/NaN/DBL_MAX)
+        RULE_PRICE_BAND,        ///最新价超出涨跌停板
+        RULE_CROSSED_BOOK,      ///买一价不低于卖一价
+        RULE_OUT_OF_SESSION,    ///非交易时间
+        RULE_OUT_OF_ORDER,      ///行情时间早于上一条
+        RULE_VOLUME_BACK,       ///累计成交量/成交额倒退
+        RULE_COUNT
+    };
+
+    /// bad_price/price_band/crossed_book/out_of_session/out_of_order/volume_back
+    static const char* ruleName(int rule);
+    /// 无法识别返回-1
+    static int parseRule(const std::string& name);
+    /// 掩码转换为以|分隔的规则名
+    static std::string describe(uint32_t mask);
+
+    explicit TickValidator(const SessionCalendar& calendar, size_t expectedInstruments = 4096);
+
+    /// 命中这些规则的tick被丢弃，其余规则只计数
+    void setDropRules(uint32_t mask) { dropMask = mask; }
+    uint32_t dropRules() const { return dropMask; }
+
+    /// 校验一批tick，masks[i]为第i条违反的规则，返回需要丢弃的条数
+    size_t check(const MarketTick* ticks, size_t n, uint32_t* masks);
+
+    bool shouldDrop(uint32_t mask) const { return (mask & dropMask) != 0; }
+
+    /// 隔离行情CSV: instrument,trading_day,update_time,millisec,last,bid1,ask1,upper,lower,volume,open_interest,mask,rules
+    static std::string toCsv(const CThostFtdcDepthMarketDataField& tick, uint32_t mask);
+
+    uint64_t checked() const { return checkedCount; }
+    uint64_t dropped() const { return droppedCount; }
+    uint64_t hits(int rule) const { return ruleCount[rule]; }
+
+private:
+    struct State
+    {
+        int     tradingDay;     // 0表示还没有通过校验的tick
+        int     sessionSet;
+        int     lastTime;       // 交易日内有序的毫秒数，夜盘在前
+        int     volume;
+        double  turnover;
+    };
+
+    /// 无状态规则
+    uint32_t checkStateless(const CThostFtdcDepthMarketDataField& tick, int second, int set) const;
+    /// 合约状态下标，新合约追加一项
+    uint32_t slotIndex(const char* instrumentID);
+
+private:
+    const SessionCalendar&                      calendar;
+    std::vector<State>                          states;
+    std::unordered_map<std::string, uint32_t>   index;
+    std::vector<int>                            seconds;    // 批内各tick的日内秒数
+    std::vector<uint32_t>                       slots;      // 批内各tick的合约状态下标
+    uint32_t                                    dropMask;
+    uint64_t                                    checkedCount;
+    uint64_t                                    droppedCount;
+    uint64_t                                    ruleCount[RULE_COUNT];
+};
+
+#endif
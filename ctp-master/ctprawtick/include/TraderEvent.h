@@ -0,0 +1,34 @@
+#ifndef TRADEREVENT_H
+#define TRADEREVENT_H
+
+#include <cstdint>
+#include "ThostFtdcUserApiStruct.h"
+
+/// 交易SPI回调投递给工作线程的事件
+/// 回调线程只把CTP原始结构体拷贝进来，转换、编码、发布都在工作线程完成
+struct TraderEvent
+{
+    enum Type : uint8_t
+    {
+        EV_INSTRUMENT = 0,
+        EV_POSITION,
+        EV_TRADING_ACCOUNT,
+        EV_RESET                ///前置断开，丢弃未收齐的查询结果
+    };
+
+    uint8_t     type;
+    bool        hasData;    // 回调中数据指针非空
+    bool        isLast;
+    int         requestID;
+    int         errorID;
+    TThostFtdcErrorMsgType errorMsg;
+
+    union
+    {
+        CThostFtdcInstrumentField       instrument;
+        CThostFtdcInvestorPositionField position;
+        CThostFtdcTradingAccountField   account;
+    };
+};
+
+#endif
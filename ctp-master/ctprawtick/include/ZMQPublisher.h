@@ -3,6 +3,8 @@
 
 #include <string>
 #include <memory>
+#include <vector>
+#include <cstdint>
 #include <zmq.hpp>
 
 class ZMQPublisher {
@@ -28,6 +30,9 @@ public:
     // 发布消息（字节数组版本）
     bool publishMessage(const std::string& messageType, const std::vector<uint8_t>& messageContent);
     
+    // 发送单帧，more为true表示后面还有帧（用于分块多帧消息：type + chunk1 + ... + chunkN）
+    bool sendFrame(const void* data, size_t size, bool more);
+    
     // 检查连接状态
     bool isConnected() const { return initialized; }
     
@@ -2,6 +2,7 @@
 #define APPCONFIG_H
 
 #include <string>
+#include <vector>
 
 struct CAppConfig
 {
@@ -12,8 +13,45 @@ struct CAppConfig
     std::string td_server;
     std::string appid;
     std::string authcode;
-    std::string dayend;
-    std::string nightend;
+    std::vector<std::string> md_feeds;  ///多路行情，每项为一路行情的前置，同一路多个前置用|分隔
+    int         md_sub_batch;   ///每个订阅请求包含的合约数
+    int         md_sub_rate;    ///每秒最多发送的订阅请求数
+    int         reconnect_backoff_min_ms;   ///登录重试初始退避
+    int         reconnect_backoff_max_ms;   ///登录重试最大退避
+    int         front_failover_sec;         ///断线超过该时长后切换前置并重建API
+    std::string batch_encoding;             ///持仓批量数据编码：csv或protobuf
+    std::string instrument_encoding;        ///合约批量数据编码，默认protobuf，csv仅为兼容旧订阅端
+    int         batch_chunk_rows;           ///批量数据每帧包含的行数
+    int         kline_enable;               ///是否合成并发布1分钟K线
+    int         kline_flush_delay_sec;      ///不活跃合约K线结束后延迟多少秒收线
+    std::string kline_persist_dir;          ///K线CSV落盘目录，为空不落盘
+    std::vector<std::string> kline_publish; ///发布/落盘的K线周期，如1min,5min,1d
+    int         kline_ring_size;            ///每个合约每个周期保留的K线根数
+    std::string kline_query_addr;           ///K线查询服务地址(ZMQ REP)，为空不启动
+    std::string md_record_dir;              ///行情录制目录，为空不录制
+    std::string md_replay_file;             ///非空时回放该录制文件代替连接前置
+    double      md_replay_speed;            ///回放速度倍数，0为全速
+    int         md_replay_loop;             ///回放到文件末尾后是否从头开始
+    int         td_mock;                    ///使用MockTraderApi代替交易前置
+    std::string td_mock_dir;                ///模拟前置的fixture目录，为空自动生成
+    int         td_mock_instruments;        ///自动生成的合约数
+    int         td_mock_latency_ms;         ///模拟前置的应答延迟
+    int         td_mock_page_size;          ///模拟前置查询结果每页条数
+    int         td_mock_page_gap_ms;        ///模拟前置分页间隔
+    int         td_mock_query_rate;         ///模拟前置每秒查询上限(-3)
+    int         td_mock_max_inflight;       ///模拟前置在途查询上限(-2)
+    int         tick_validate;              ///是否校验行情
+    std::vector<std::string> tick_drop_rules;   ///命中即丢弃并发往隔离主题的校验规则，其余规则只计数
+    int         latency_trace;              ///行情消息末尾附带各阶段延迟打点
+    std::string metrics_bind;               ///指标HTTP服务监听地址
+    int         market_metrics_port;        ///ctpmarket的/metrics端口，0不启动
+    int         monitor_metrics_port;       ///ctpmonitor的/metrics端口，0不启动
+    std::string md_topic_mode;              ///行情主题: single、instrument(MD.<交易所>.<品种>.<合约>)或both
+    std::string md_transport;               ///行情发布方式: zmq、shm或both
+    std::string md_shm_name;                ///共享内存行情环名，位于/dev/shm下
+    int         md_shm_capacity;            ///共享内存行情环槽位数，2的幂
+    std::vector<std::string> threads;       ///线程角色配置，如 md_main:cpus=2;prio=60;numa=0
+    std::vector<std::string> holidays;      ///交易所休市日YYYYMMDD（周末以外），用于交易日与夜盘判断
 
     CAppConfig();
 };
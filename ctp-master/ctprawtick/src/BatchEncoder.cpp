@@ -0,0 +1,300 @@
+#include <charconv>
+#include <cstring>
+#include <algorithm>
+#include "zlog.h"
+#include "BatchEncoder.h"
+#include "ProtobufConverter.h"
+
+using namespace std;
+
+// external global variable
+extern zlog_category_t *cat;
+
+BatchEncoder::Encoding BatchEncoder::parseEncoding(const string& name)
+{
+    if (name == "protobuf" || name == "pb")
+    {
+        return ENCODING_PROTOBUF;
+    }
+    return ENCODING_CSV;
+}
+
+const char* BatchEncoder::topic(BatchKind kind, Encoding encoding)
+{
+    if (kind == BATCH_INSTRUMENT)
+    {
+        return encoding == ENCODING_PROTOBUF ? "CTP_INSTRUMENT_BATCH_UPDATE" : "INSTRUMENT";
+    }
+    return encoding == ENCODING_PROTOBUF ? "CTP_INVESTOR_POSITION_BATCH_UPDATE" : "CTP_INVESTOR_POSITION_CSV_UPDATE";
+}
+
+BatchEncoder::BatchEncoder(ZMQPublisher& publisher_, size_t rowsPerChunk_)
+    : publisher(publisher_),
+      rowsPerChunk(rowsPerChunk_ > 0 ? rowsPerChunk_ : 500),
+      kind(BATCH_INSTRUMENT),
+      encoding(ENCODING_CSV),
+      currentRows(0),
+      topicSent(false),
+      ok(true),
+      rowCount(0),
+      chunkCount(0),
+      byteCount(0)
+{
+}
+
+void BatchEncoder::begin(BatchKind kind_, Encoding encoding_)
+{
+    kind = kind_;
+    encoding = encoding_;
+    current.clear();
+    pending.clear();
+    currentRows = 0;
+    topicSent = false;
+    ok = true;
+    rowCount = 0;
+    chunkCount = 0;
+    byteCount = 0;
+
+    chunkHeader.clear();
+    if (encoding == ENCODING_PROTOBUF)
+    {
+        // 每帧都带上批次的时间戳与消息类型，保证单帧可独立解析
+        int64_t ts = ProtobufConverter::generateTimestamp();
+        if (kind == BATCH_INSTRUMENT)
+        {
+            ctp::InstrumentBatchMessage header;
+            header.set_timestamp(ts);
+            header.set_message_type(topic(kind, encoding));
+            header.SerializeToString(&chunkHeader);
+        }
+        else
+        {
+            ctp::InvestorPositionBatchMessage header;
+            header.set_timestamp(ts);
+            header.set_message_type(topic(kind, encoding));
+            header.SerializeToString(&chunkHeader);
+        }
+    }
+    startChunk();
+}
+
+void BatchEncoder::startChunk()
+{
+    current.clear();
+    current.append(chunkHeader);
+    currentRows = 0;
+}
+
+void BatchEncoder::sendFrame(const string& frame, bool more)
+{
+    if (!topicSent)
+    {
+        const char* type = topic(kind, encoding);
+        ok = publisher.sendFrame(type, strlen(type), true) && ok;
+        topicSent = true;
+    }
+    ok = publisher.sendFrame(frame.data(), frame.size(), more) && ok;
+    ++chunkCount;
+    byteCount += frame.size();
+}
+
+void BatchEncoder::endRow()
+{
+    ++rowCount;
+    if (++currentRows < rowsPerChunk)
+    {
+        return;
+    }
+    // 上一帧确定不是最后一帧后才发出
+    if (!pending.empty())
+    {
+        sendFrame(pending, true);
+    }
+    pending.swap(current);
+    startChunk();
+}
+
+bool BatchEncoder::finish()
+{
+    if (currentRows > 0)
+    {
+        if (!pending.empty())
+        {
+            sendFrame(pending, true);
+        }
+        sendFrame(current, false);
+    }
+    else if (!pending.empty())
+    {
+        sendFrame(pending, false);
+    }
+    pending.clear();
+    current.clear();
+    currentRows = 0;
+
+    if (!ok)
+    {
+        zlog_error(cat, "[BatchEncoder::finish] %s 发送失败", topic(kind, encoding));
+    }
+    return ok;
+}
+
+void BatchEncoder::putStr(const char* s, size_t maxLen)
+{
+    current.append(s, strnlen(s, maxLen));
+}
+
+void BatchEncoder::putChar(char c)
+{
+    if (c)
+    {
+        current.push_back(c);
+    }
+}
+
+void BatchEncoder::putInt(long long v)
+{
+    char buf[24];
+    auto res = to_chars(buf, buf + sizeof(buf), v);
+    current.append(buf, res.ptr - buf);
+}
+
+void BatchEncoder::putDouble(double v)
+{
+    char buf[32];
+    auto res = to_chars(buf, buf + sizeof(buf), v);
+    current.append(buf, res.ptr - buf);
+}
+
+void BatchEncoder::putVarint(uint64_t v)
+{
+    while (v >= 0x80)
+    {
+        current.push_back(static_cast<char>((v & 0x7F) | 0x80));
+        v >>= 7;
+    }
+    current.push_back(static_cast<char>(v));
+}
+
+template <class Message>
+void BatchEncoder::putMessage(uint32_t fieldNumber, const Message& msg)
+{
+    // length-delimited字段：tag + 长度 + 消息体，直接序列化到缓冲区尾部
+    size_t size = msg.ByteSizeLong();
+    putVarint((static_cast<uint64_t>(fieldNumber) << 3) | 2);
+    putVarint(size);
+    size_t offset = current.size();
+    current.resize(offset + size);
+    msg.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(&current[offset]));
+}
+
+#define PUT_STR(field)  putStr(field, sizeof(field))
+
+void BatchEncoder::add(const CThostFtdcInstrumentField& instrument)
+{
+    if (encoding == ENCODING_PROTOBUF)
+    {
+        // InstrumentBatchMessage.instruments = 1
+        putMessage(1, ProtobufConverter::convertToProtobuf(instrument));
+        endRow();
+        return;
+    }
+
+    PUT_STR(instrument.InstrumentID);           sep();
+    PUT_STR(instrument.ExchangeID);             sep();
+    PUT_STR(instrument.InstrumentName);         sep();
+    PUT_STR(instrument.ExchangeInstID);         sep();
+    PUT_STR(instrument.ProductID);              sep();
+    putChar(instrument.ProductClass);           sep();
+    putInt(instrument.DeliveryYear);            sep();
+    putInt(instrument.DeliveryMonth);           sep();
+    putInt(instrument.MaxMarketOrderVolume);    sep();
+    putInt(instrument.MinMarketOrderVolume);    sep();
+    putInt(instrument.MaxLimitOrderVolume);     sep();
+    putInt(instrument.MinLimitOrderVolume);     sep();
+    putInt(instrument.VolumeMultiple);          sep();
+    putDouble(instrument.PriceTick);            sep();
+    PUT_STR(instrument.CreateDate);             sep();
+    PUT_STR(instrument.OpenDate);               sep();
+    PUT_STR(instrument.ExpireDate);             sep();
+    PUT_STR(instrument.StartDelivDate);         sep();
+    PUT_STR(instrument.EndDelivDate);           sep();
+    putChar(instrument.InstLifePhase);          sep();
+    putChar(instrument.IsTrading ? '1' : '0');  sep();
+    putChar(instrument.PositionType);           sep();
+    putChar(instrument.PositionDateType);       sep();
+    putDouble(instrument.LongMarginRatio);      sep();
+    putDouble(instrument.ShortMarginRatio);     sep();
+    putChar(instrument.MaxMarginSideAlgorithm); sep();
+    PUT_STR(instrument.UnderlyingInstrID);      sep();
+    putDouble(instrument.StrikePrice);          sep();
+    putChar(instrument.OptionsType);            sep();
+    putDouble(instrument.UnderlyingMultiple);   sep();
+    putChar(instrument.CombinationType);
+    current.push_back('\n');
+    endRow();
+}
+
+void BatchEncoder::add(const CThostFtdcInvestorPositionField& position)
+{
+    if (encoding == ENCODING_PROTOBUF)
+    {
+        // InvestorPositionBatchMessage.positions = 3
+        putMessage(3, ProtobufConverter::convertToProtobuf(position));
+        endRow();
+        return;
+    }
+
+    PUT_STR(position.InstrumentID);             sep();
+    PUT_STR(position.BrokerID);                 sep();
+    PUT_STR(position.InvestorID);               sep();
+    putChar(position.PosiDirection);            sep();
+    putChar(position.HedgeFlag);                sep();
+    putChar(position.PositionDate);             sep();
+    putInt(position.YdPosition);                sep();
+    putInt(position.Position);                  sep();
+    putInt(position.LongFrozen);                sep();
+    putInt(position.ShortFrozen);               sep();
+    putDouble(position.LongFrozenAmount);       sep();
+    putDouble(position.ShortFrozenAmount);      sep();
+    putInt(position.OpenVolume);                sep();
+    putInt(position.CloseVolume);               sep();
+    putDouble(position.OpenAmount);             sep();
+    putDouble(position.CloseAmount);            sep();
+    putDouble(position.PositionCost);           sep();
+    putDouble(position.PreMargin);              sep();
+    putDouble(position.UseMargin);              sep();
+    putDouble(position.FrozenMargin);           sep();
+    putDouble(position.FrozenCash);             sep();
+    putDouble(position.FrozenCommission);       sep();
+    putDouble(position.CashIn);                 sep();
+    putDouble(position.Commission);             sep();
+    putDouble(position.CloseProfit);            sep();
+    putDouble(position.PositionProfit);         sep();
+    putDouble(position.PreSettlementPrice);     sep();
+    putDouble(position.SettlementPrice);        sep();
+    PUT_STR(position.TradingDay);               sep();
+    putInt(position.SettlementID);              sep();
+    putDouble(position.OpenCost);               sep();
+    putDouble(position.ExchangeMargin);         sep();
+    putInt(position.CombPosition);              sep();
+    putInt(position.CombLongFrozen);            sep();
+    putInt(position.CombShortFrozen);           sep();
+    putDouble(position.CloseProfitByDate);      sep();
+    putDouble(position.CloseProfitByTrade);     sep();
+    putInt(position.TodayPosition);             sep();
+    putDouble(position.MarginRateByMoney);      sep();
+    putDouble(position.MarginRateByVolume);     sep();
+    putInt(position.StrikeFrozen);              sep();
+    putDouble(position.StrikeFrozenAmount);     sep();
+    putInt(position.AbandonFrozen);             sep();
+    PUT_STR(position.ExchangeID);               sep();
+    putInt(position.YdStrikeFrozen);            sep();
+    PUT_STR(position.InvestUnitID);             sep();
+    putDouble(position.PositionCostOffset);     sep();
+    // TasPosition / TasCost - 默认为0
+    current.append("0,0\n");
+    endRow();
+}
+
+#undef PUT_STR
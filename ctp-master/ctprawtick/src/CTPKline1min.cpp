@@ -0,0 +1,467 @@
+#include <cstring>
+#include <cstdlib>
+#include <charconv>
+#include "zlog.h"
+#include "CTPKline1min.h"
+
+using namespace std;
+
+// external global variable
+extern zlog_category_t *cat;
+
+static const char* kTimeframeNames[] = {"1s", "5s", "1min", "5min", "15min", "1h", "1d"};
+static const char* kTimeframeTopics[] = {"KLINE_1S", "KLINE_5S", "KLINE_1MIN", "KLINE_5MIN",
+                                         "KLINE_15MIN", "KLINE_1H", "KLINE_1D"};
+// 各周期秒数，日线按交易日切分
+static const int kPeriods[] = {1, 5, 60, 300, 900, 3600, 0};
+
+BarRing::BarRing()
+    : cap(0), head(0), count(0)
+{
+}
+
+void BarRing::init(size_t capacity)
+{
+    cap = capacity > 0 ? capacity : 1;
+    head = 0;
+    count = 0;
+    dt.assign(cap, 0);
+    open.assign(cap, 0);
+    high.assign(cap, 0);
+    low.assign(cap, 0);
+    close.assign(cap, 0);
+    turnover.assign(cap, 0);
+    volume.assign(cap, 0);
+    opi.assign(cap, 0);
+    opiDelta.assign(cap, 0);
+}
+
+void BarRing::push(const OHLCV& bar)
+{
+    dt[head]       = bar.dt;
+    open[head]     = bar.open;
+    high[head]     = bar.high;
+    low[head]      = bar.low;
+    close[head]    = bar.close;
+    turnover[head] = bar.turnover;
+    volume[head]   = bar.volume;
+    opi[head]      = bar.opi;
+    opiDelta[head] = bar.opiDelta;
+    head = head + 1 == cap ? 0 : head + 1;
+    if (count < cap)
+    {
+        ++count;
+    }
+}
+
+void BarRing::get(size_t i, OHLCV& bar) const
+{
+    size_t pos = (head + cap - count + i) % cap;
+    bar.dt       = dt[pos];
+    bar.open     = open[pos];
+    bar.high     = high[pos];
+    bar.low      = low[pos];
+    bar.close    = close[pos];
+    bar.turnover = turnover[pos];
+    bar.volume   = volume[pos];
+    bar.opi      = opi[pos];
+    bar.opiDelta = opiDelta[pos];
+}
+
+const char* KlineEngine::timeframeName(int tf)
+{
+    return tf >= 0 && tf < TF_COUNT ? kTimeframeNames[tf] : "";
+}
+
+const char* KlineEngine::topic(int tf)
+{
+    return tf >= 0 && tf < TF_COUNT ? kTimeframeTopics[tf] : "";
+}
+
+int KlineEngine::parseTimeframe(const string& name)
+{
+    for (int tf = 0; tf < TF_COUNT; ++tf)
+    {
+        if (name == kTimeframeNames[tf])
+        {
+            return tf;
+        }
+    }
+    if (name == "1m")                       return TF_1MIN;
+    if (name == "5m")                       return TF_5MIN;
+    if (name == "15m")                      return TF_15MIN;
+    if (name == "60m" || name == "1hour")   return TF_1H;
+    if (name == "day" || name == "1day")    return TF_DAY;
+    return -1;
+}
+
+KlineEngine::KlineEngine(const SessionCalendar& calendar_, size_t expectedInstruments, size_t ringSize_)
+    : calendar(calendar_), ringSize(ringSize_), flushDelaySec(3), dayStart(0), completedCount(0), lateCount(0)
+{
+    slots.reserve(expectedInstruments);
+    index.reserve(expectedInstruments);
+}
+
+time_t KlineEngine::barTime(int second, time_t now)
+{
+    if (now < dayStart || now >= dayStart + 86400)
+    {
+        // 只在跨过本地零点时重新计算，避免每条tick调用mktime
+        struct tm local;
+        localtime_r(&now, &local);
+        local.tm_hour = 0;
+        local.tm_min = 0;
+        local.tm_sec = 0;
+        dayStart = mktime(&local);
+    }
+
+    // UpdateTime只有时分秒，按离本地时间最近的一天补全日期（处理零点前后的行情）
+    time_t start = dayStart + second;
+    if (start - now > 43200)
+    {
+        start -= 86400;
+    }
+    else if (now - start > 43200)
+    {
+        start += 86400;
+    }
+    return start;
+}
+
+time_t KlineEngine::dayTime(int tradingDay)
+{
+    struct tm local;
+    memset(&local, 0, sizeof(local));
+    local.tm_year = tradingDay / 10000 - 1900;
+    local.tm_mon = tradingDay / 100 % 100 - 1;
+    local.tm_mday = tradingDay % 100;
+    local.tm_isdst = -1;
+    return mktime(&local);
+}
+
+KlineEngine::Slot& KlineEngine::slotOf(const char* instrumentID)
+{
+    auto it = index.find(instrumentID);
+    if (it != index.end())
+    {
+        return slots[it->second];
+    }
+
+    index.emplace(instrumentID, static_cast<uint32_t>(slots.size()));
+    slots.emplace_back();
+    Slot& slot = slots.back();
+    slot.hasBase = false;
+    slot.baseVolume = 0;
+    slot.baseTurnover = 0;
+    slot.baseOpi = 0;
+    slot.tradingDay = 0;
+    slot.sessionSet = calendar.sessionSetOf(instrumentID);
+    slot.lastStart = 0;
+    for (int tf = 0; tf < TF_COUNT; ++tf)
+    {
+        Level& level = slot.levels[tf];
+        memset(&level.bar, 0, sizeof(OHLCV));
+        strncpy(level.bar.symbol, instrumentID, sizeof(level.bar.symbol) - 1);
+        level.bar.timeframe = tf;
+        level.open = false;
+        level.ring.init(ringSize);
+    }
+    return slot;
+}
+
+size_t KlineEngine::onTick(const CThostFtdcDepthMarketDataField& tick, vector<OHLCV>& finished, time_t now)
+{
+    Slot& slot = slotOf(tick.InstrumentID);
+    int second = SessionCalendar::secondOfDay(tick.UpdateTime);
+    if (second < 0 || (second = calendar.barSecond(slot.sessionSet, second)) < 0)
+    {
+        // 非交易时间的tick，累计量基准不动
+        return 0;
+    }
+    time_t start = barTime(second, now);
+    if (start <= slot.lastStart)
+    {
+        // 所属K线已经收掉，累计量基准不动，差分计入下一根K线
+        ++lateCount;
+        return 0;
+    }
+
+    int day = atoi(tick.TradingDay);
+    if (day <= 0)
+    {
+        day = slot.tradingDay;
+    }
+
+    // 累计成交量/成交额差分，首条tick只建立基准
+    int volume = 0;
+    double turnover = 0;
+    if (!slot.hasBase)
+    {
+        slot.hasBase = true;
+        slot.baseOpi = tick.OpenInterest;
+    }
+    else if (tick.Volume >= slot.baseVolume)
+    {
+        volume = tick.Volume - slot.baseVolume;
+        turnover = tick.Turnover - slot.baseTurnover;
+    }
+    else
+    {
+        // 累计量变小说明进入了新的交易日
+        volume = tick.Volume;
+        turnover = tick.Turnover;
+    }
+    slot.baseVolume = tick.Volume;
+    slot.baseTurnover = tick.Turnover;
+
+    size_t n = roll(slot, start, day, finished);
+    slot.tradingDay = day;
+
+    Level& level = slot.levels[TF_1S];
+    OHLCV& bar = level.bar;
+    if (!level.open)
+    {
+        level.open = true;
+        bar.dt = start;
+        bar.open = bar.high = bar.low = bar.close = 0;
+        bar.volume = 0;
+        bar.turnover = 0;
+    }
+
+    // 无效价格(0或DBL_MAX)只累计成交量
+    double price = tick.LastPrice;
+    if (price > 0 && price < 1e300)
+    {
+        if (bar.open == 0)
+        {
+            bar.open = bar.high = bar.low = price;
+        }
+        else if (price > bar.high)
+        {
+            bar.high = price;
+        }
+        else if (price < bar.low)
+        {
+            bar.low = price;
+        }
+        bar.close = price;
+    }
+    bar.volume += volume;
+    bar.turnover += turnover;
+    bar.opi = static_cast<int>(tick.OpenInterest);
+    bar.opiDelta = static_cast<int>(tick.OpenInterest - slot.baseOpi);
+    return n;
+}
+
+size_t KlineEngine::roll(Slot& slot, time_t t, int day, vector<OHLCV>& finished)
+{
+    size_t before = finished.size();
+    // 周期由小到大检查，低一级收线后先并入高一级，再判断高一级是否结束
+    for (int tf = 0; tf < TF_COUNT; ++tf)
+    {
+        Level& level = slot.levels[tf];
+        if (!level.open)
+        {
+            continue;
+        }
+        bool ended = tf == TF_DAY ? (day > 0 && day != slot.tradingDay)
+                                  : t >= level.bar.dt + kPeriods[tf];
+        if (ended)
+        {
+            closeLevel(slot, tf, finished);
+        }
+    }
+    return finished.size() - before;
+}
+
+void KlineEngine::closeLevel(Slot& slot, int tf, vector<OHLCV>& finished)
+{
+    Level& level = slot.levels[tf];
+    const OHLCV& bar = level.bar;
+    level.open = false;
+    if (tf == TF_1S)
+    {
+        slot.lastStart = bar.dt;
+        slot.baseOpi = bar.opi;
+    }
+    // 整个周期都没有有效价格时不输出
+    if (bar.open <= 0)
+    {
+        return;
+    }
+    level.ring.push(bar);
+    finished.push_back(bar);
+    ++completedCount;
+
+    if (tf + 1 >= TF_COUNT)
+    {
+        return;
+    }
+
+    // 并入高一级周期
+    Level& upper = slot.levels[tf + 1];
+    time_t start = tf + 1 == TF_DAY ? dayTime(slot.tradingDay) : bar.dt - bar.dt % kPeriods[tf + 1];
+    if (upper.open && upper.bar.dt != start)
+    {
+        // 中间有缺口，高一级K线已不属于同一周期
+        closeLevel(slot, tf + 1, finished);
+    }
+    OHLCV& up = upper.bar;
+    if (!upper.open)
+    {
+        upper.open  = true;
+        up.dt       = start;
+        up.open     = bar.open;
+        up.high     = bar.high;
+        up.low      = bar.low;
+        up.volume   = 0;
+        up.turnover = 0;
+        up.opiDelta = 0;
+    }
+    else
+    {
+        if (bar.high > up.high)
+        {
+            up.high = bar.high;
+        }
+        if (bar.low < up.low)
+        {
+            up.low = bar.low;
+        }
+    }
+    up.close     = bar.close;
+    up.volume   += bar.volume;
+    up.turnover += bar.turnover;
+    up.opi       = bar.opi;
+    up.opiDelta += bar.opiDelta;
+}
+
+size_t KlineEngine::flush(time_t now, vector<OHLCV>& finished)
+{
+    size_t n = 0;
+    time_t t = now - flushDelaySec;
+    for (auto& slot: slots)
+    {
+        n += roll(slot, t, slot.tradingDay, finished);
+    }
+    return n;
+}
+
+size_t KlineEngine::query(const string& symbol, int tf, size_t n, vector<OHLCV>& out) const
+{
+    auto it = index.find(symbol);
+    if (it == index.end() || tf < 0 || tf >= TF_COUNT)
+    {
+        return 0;
+    }
+
+    const Level& level = slots[it->second].levels[tf];
+    size_t size = level.ring.size();
+    size_t k = n < size ? n : size;
+    OHLCV bar = level.bar;
+    for (size_t i = size - k; i < size; ++i)
+    {
+        level.ring.get(i, bar);
+        out.push_back(bar);
+    }
+    return k;
+}
+
+static void appendNumber(string& out, double v)
+{
+    char buf[32];
+    auto res = to_chars(buf, buf + sizeof(buf), v);
+    out.append(buf, res.ptr - buf);
+}
+
+string KlineEngine::toCsv(const OHLCV& bar)
+{
+    char dt[32];
+    struct tm local;
+    localtime_r(&bar.dt, &local);
+    strftime(dt, sizeof(dt), "%Y-%m-%d %H:%M:%S", &local);
+
+    string out;
+    out.reserve(128);
+    out.append(bar.symbol).push_back(',');
+    out.append(dt).push_back(',');
+    appendNumber(out, bar.open);        out.push_back(',');
+    appendNumber(out, bar.high);        out.push_back(',');
+    appendNumber(out, bar.low);         out.push_back(',');
+    appendNumber(out, bar.close);       out.push_back(',');
+    out.append(to_string(bar.volume));  out.push_back(',');
+    appendNumber(out, bar.turnover);    out.push_back(',');
+    out.append(to_string(bar.opi));     out.push_back(',');
+    out.append(to_string(bar.opiDelta));
+    return out;
+}
+
+KlineFileWriter::KlineFileWriter(const string& dir_)
+    : dir(dir_)
+{
+    for (auto& f: fp)
+    {
+        f = nullptr;
+    }
+}
+
+KlineFileWriter::~KlineFileWriter()
+{
+    for (auto& f: fp)
+    {
+        if (f)
+        {
+            fclose(f);
+        }
+    }
+}
+
+bool KlineFileWriter::write(const OHLCV& bar)
+{
+    int tf = bar.timeframe;
+    if (tf < 0 || tf >= KlineEngine::TF_COUNT)
+    {
+        return false;
+    }
+
+    char date[16];
+    struct tm local;
+    localtime_r(&bar.dt, &local);
+    strftime(date, sizeof(date), "%Y%m%d", &local);
+
+    if (!fp[tf] || day[tf] != date)
+    {
+        if (fp[tf])
+        {
+            fclose(fp[tf]);
+        }
+        day[tf] = date;
+        string path = dir + "/kline_" + KlineEngine::timeframeName(tf) + "_" + day[tf] + ".csv";
+        fp[tf] = fopen(path.c_str(), "a");
+        if (!fp[tf])
+        {
+            zlog_error(cat, "[KlineFileWriter::write] 无法打开K线文件: %s", path.c_str());
+            return false;
+        }
+        if (ftell(fp[tf]) == 0)
+        {
+            fputs("symbol,datetime,open,high,low,close,volume,turnover,open_interest,oi_delta\n", fp[tf]);
+        }
+        zlog_info(cat, "[KlineFileWriter::write] K线文件: %s", path.c_str());
+    }
+
+    string line = KlineEngine::toCsv(bar);
+    line.push_back('\n');
+    return fwrite(line.data(), 1, line.size(), fp[tf]) == line.size();
+}
+
+void KlineFileWriter::flush()
+{
+    for (auto& f: fp)
+    {
+        if (f)
+        {
+            fflush(f);
+        }
+    }
+}
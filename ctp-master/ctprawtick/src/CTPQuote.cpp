@@ -9,6 +9,10 @@
 #include <algorithm>
 #include "zlog.h"
 #include "CTPQuote.h"
+#include "SessionCalendar.h"
+#include "ReplayMdApi.h"
+#include "LatencyStats.h"
+#include "ThreadTuning.h"
 #include "ThostFtdcMdApi.h"
 #include "readerwriterqueue.h"
 
@@ -20,23 +24,43 @@ using Ms  = chrono::microseconds;
 // external global variable
 extern zlog_category_t *cat;
 extern vector<string>  contracts;
-extern vector<string> DECSymbols;
-// lockfree threadsafe queue - 更改为CThostFtdcDepthMarketDataField类型
-extern ReaderWriterQueue<CThostFtdcDepthMarketDataField> q;
-extern ReaderWriterQueue<CThostFtdcDepthMarketDataField> bufq;
+
+// SDK回调线程按md_spi角色命名/绑核，每个线程只设置一次
+static void tuneCallbackThread(int feed)
+{
+    static thread_local bool tuned = false;
+    if (tuned)
+    {
+        return;
+    }
+    tuned = true;
+    string error;
+    if (!ThreadTuning::global().apply("md_spi", "md_spi" + to_string(feed), error))
+    {
+        zlog_warn(cat, "[CTPMarketSpi] 行情[%d]回调线程设置失败: %s", feed, error.c_str());
+    }
+}
+
+CTPMarketSpi::CTPMarketSpi(int feedId)
+    : exitTs(0), api(nullptr), requestid(0), conn(feedId == 0 ? string("md") : "md" + to_string(feedId)),
+      feed(feedId), ticks(10000), replaySpeed(1.0), replayLoop(false), replayApi(nullptr), arbiter(nullptr), receivedCount(0), droppedCount(0)
+{
+}
 
 void CTPMarketSpi::OnFrontConnected()
 {
     zlog_info(cat, "[CTPMarketSpi::OnFrontConnected] .");
+    tuneCallbackThread(feed);
+    conn.onConnected();
     login();
 }
 
 void CTPMarketSpi::OnFrontDisconnected(int nReason)
 {
     zlog_error(cat, "[CTPMarketSpi::OnFrontDisconnected] entered. Reason: %d", nReason);
-    zlog_info(cat, "[CTPMarketSpi::OnFrontDisconnected] sleep for 10 seconds.");
-    chrono::seconds dura(10);
-    this_thread::sleep_for(dura);
+    // 不在回调线程中sleep，SDK会立即自动重连，登录重试与前置切换由主线程处理
+    conn.onDisconnected(nReason);
+    subs.onDisconnected();
 }
 
 void CTPMarketSpi::OnHeartBeatWarning(int nTimeLapse)
@@ -50,17 +74,22 @@ void CTPMarketSpi::OnRspUserLogin(CThostFtdcRspUserLoginField *pRspUserLogin,
                                   bool                        bIsLast)
 {
     zlog_info(cat, "[CTPMarketSpi::OnRspUserLogin] .");
-    if (pRspInfo->ErrorID != 0)
+    if (pRspInfo && pRspInfo->ErrorID != 0)
     {
         zlog_error(cat, "[CTPMarketSpi::OnRspUserLogin] 行情服务器登陆出错，错误码:%d", pRspInfo->ErrorID);
         zlog_error(cat, "[CTPMarketSpi::OnRspUserLogin] 行情服务器登陆出错，错误信息:%s", pRspInfo->ErrorMsg);
+        conn.onLoginResult(false);
         return;
     }
+    conn.onLoginResult(true);
 
     zlog_info(cat, "[CTPMarketSpi::OnRspUserLogin] 行情服务器登陆成功");
     zlog_info(cat, "[CTPMarketSpi::OnRspUserLogin] 当前交易日: %s", api->GetTradingDay());
 
-    subscribe(contracts);
+    // 首次登录加入全部合约，重连登录后已登记的合约自动重新订阅
+    subs.add(contracts);
+    subs.onLogin();
+    subs.pump(api);
 }
 
 void CTPMarketSpi::OnRspUserLogout(CThostFtdcUserLogoutField  *pUserLogout,
@@ -82,7 +111,7 @@ void CTPMarketSpi::OnRspQryMulticastInstrument(CThostFtdcMulticastInstrumentFiel
 void CTPMarketSpi::OnRspError(CThostFtdcRspInfoField *pRspInfo, int nRequestID, bool bIsLast)
 {
     zlog_info(cat, "[CTPMarketSpi::OnRspError]");
-    if (pRspInfo->ErrorID != 0)
+    if (pRspInfo && pRspInfo->ErrorID != 0)
     {
         zlog_error(cat, "[CTPMarketSpi::OnRspError]行情错误回报 错误代码: [%d]", pRspInfo->ErrorID);
         zlog_error(cat, "[CTPMarketSpi::OnRspError]行情错误回报 错误信息: [%s]", pRspInfo->ErrorMsg);
@@ -94,13 +123,25 @@ void CTPMarketSpi::OnRspSubMarketData(CThostFtdcSpecificInstrumentField *pSpecif
                                       int                               nRequestID,
                                       bool                              bIsLast)
 {
-    if (pRspInfo->ErrorID != 0)
+    const char* instrumentID = pSpecificInstrument ? pSpecificInstrument->InstrumentID : "";
+    int errorID = pRspInfo ? pRspInfo->ErrorID : 0;
+    subs.onSubAck(instrumentID, errorID);
+
+    if (errorID != 0)
     {
-        zlog_error(cat, "[CTPMarketSpi::OnRspSubMarketData]行情订阅回报 错误代码: [%d]", pRspInfo->ErrorID);
+        zlog_error(cat, "[CTPMarketSpi::OnRspSubMarketData]行情订阅回报 合约[%s] 错误代码: [%d]", instrumentID, errorID);
         zlog_error(cat, "[CTPMarketSpi::OnRspSubMarketData]行情订阅回报 错误信息: [%s]", pRspInfo->ErrorMsg);
-        return;
     }
-    zlog_info(cat, "[CTPMarketSpi::OnRspSubMarketData] 订阅合约[%s]成功", pSpecificInstrument->InstrumentID);
+    else
+    {
+        zlog_debug(cat, "[CTPMarketSpi::OnRspSubMarketData] 订阅合约[%s]成功", instrumentID);
+    }
+
+    // 一个批次的回报收齐后继续发送下一批
+    if (bIsLast)
+    {
+        subs.pump(api);
+    }
 }
 
 void CTPMarketSpi::OnRspUnSubMarketData(CThostFtdcSpecificInstrumentField *pSpecificInstrument,
@@ -108,13 +149,17 @@ void CTPMarketSpi::OnRspUnSubMarketData(CThostFtdcSpecificInstrumentField *pSpec
                                         int                               nRequestID,
                                         bool                              bIsLast)
 {
-    if (pRspInfo->ErrorID != 0)
+    const char* instrumentID = pSpecificInstrument ? pSpecificInstrument->InstrumentID : "";
+    int errorID = pRspInfo ? pRspInfo->ErrorID : 0;
+    subs.onUnSubAck(instrumentID, errorID);
+
+    if (errorID != 0)
     {
-        zlog_error(cat, "[CTPMarketSpi::OnRspUnSubMarketData] 行情取消订阅回报 错误代码: [%d]", pRspInfo->ErrorID);
+        zlog_error(cat, "[CTPMarketSpi::OnRspUnSubMarketData] 行情取消订阅回报 合约[%s] 错误代码: [%d]", instrumentID, errorID);
         zlog_error(cat, "[CTPMarketSpi::OnRspUnSubMarketData] 行情取消订阅回报 错误信息: [%s]", pRspInfo->ErrorMsg);
         return;
     }
-    zlog_info(cat, "[CTPMarketSpi::OnRspUnSubMarketData] 取消订阅合约[%s]成功", pSpecificInstrument->InstrumentID);
+    zlog_info(cat, "[CTPMarketSpi::OnRspUnSubMarketData] 取消订阅合约[%s]成功", instrumentID);
 }
 
 void CTPMarketSpi::OnRspSubForQuoteRsp(CThostFtdcSpecificInstrumentField *pSpecificInstrument,
@@ -153,23 +198,48 @@ void CTPMarketSpi::OnRtnDepthMarketData(CThostFtdcDepthMarketDataField *pDepthMa
         zlog_info(cat, "[OnRtnDepthMarketData] 收到空指针，跳过处理");
         return;
     }
+    tuneCallbackThread(feed);
     
-    // 添加调试日志，记录每次接收到的行情数据
-    zlog_info(cat, "[OnRtnDepthMarketData] 收到行情数据: %s, 最新价: %.2f, 时间: %s", 
+    // 逐条日志只在debug级别输出，info级别下不拖慢SPI线程
+    zlog_debug(cat, "[OnRtnDepthMarketData] 收到行情数据: %s, 最新价: %.2f, 时间: %s", 
               pDepthMarketData->InstrumentID ? pDepthMarketData->InstrumentID : "Unknown",
               pDepthMarketData->LastPrice,
               pDepthMarketData->UpdateTime ? pDepthMarketData->UpdateTime : "Unknown");
     
-    // 直接将行情数据结构体放入队列，让主线程处理protobuf编码
-    if (!q.try_enqueue(*pDepthMarketData))
+    receivedCount.fetch_add(1, std::memory_order_relaxed);
+
+    // 多路行情时只有最先到达的一条进入队列
+    if (arbiter && !arbiter->accept(*pDepthMarketData))
+    {
+        return;
+    }
+
+    // 直接将行情数据结构体放入本路队列，让主线程处理protobuf编码
+    MarketTick tick;
+    tick.recvNs = monotonicNs();
+    tick.recvWallNs = wallNs();
+    tick.dequeueNs = 0;
+    tick.eventWallNs = replayApi ? replayApi->recordedWallNs() : tick.recvWallNs;
+    tick.data = *pDepthMarketData;
+    if (replayApi)
     {
-        // 如果主队列满了，尝试放入缓冲队列
-        if (!bufq.try_enqueue(*pDepthMarketData))
+        // 回放时队列满就等主线程取走，全速回放也不丢自己的输入
+        while (!ticks.try_enqueue(tick))
         {
-            // 如果两个队列都满了，输出错误信息
-            zlog_error(cat, "[OnRtnDepthMarketData] 队列已满，丢弃行情数据: %s", 
-                      pDepthMarketData->InstrumentID ? pDepthMarketData->InstrumentID : "Unknown");
+            if (!replayApi->isRunning())
+            {
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            std::this_thread::yield();
         }
+        return;
+    }
+    if (!ticks.try_enqueue(tick))
+    {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+        zlog_error(cat, "[OnRtnDepthMarketData] 行情[%d]队列已满，丢弃行情数据: %s", feed,
+                  pDepthMarketData->InstrumentID ? pDepthMarketData->InstrumentID : "Unknown");
     }
 }
 
@@ -179,49 +249,79 @@ void CTPMarketSpi::OnRtnForQuoteRsp(CThostFtdcForQuoteRspField *pForQuoteRsp)
 }
 
 /// user function
-bool CTPMarketSpi::Create(const CAppConfig& appConfig)
+bool CTPMarketSpi::Create(const CAppConfig& appConfig, const string& fronts)
 {
-    api = CThostFtdcMdApi::CreateFtdcMdApi();
-    if (api)
-    {
-        char addrBuf[PATH_MAX] = {0};
-        snprintf(addrBuf, sizeof(addrBuf), "tcp://%s", appConfig.md_server.c_str());
-        brokerid = appConfig.brokerid;
-        userid   = appConfig.userid;
-        password = appConfig.password;
-
-        struct tm etm;
-        time_t now = time(nullptr);
-        strptime(appConfig.dayend.c_str(), "%H:%M:%S", &etm);
-        tm *pExitTM = localtime(&now);
-        pExitTM->tm_hour = etm.tm_hour;
-        pExitTM->tm_min = etm.tm_min+5;
-        pExitTM->tm_sec = 0;
-        exitTs = mktime(pExitTM);
-
-        if (now > exitTs)
-        {
-            struct tm nightm;
-            strptime(appConfig.nightend.c_str(), "%H:%M:%S", &nightm);
-            time_t exitTM = now + 24 * 3600;
-            pExitTM = localtime(&exitTM);
-            pExitTM->tm_hour = nightm.tm_hour;
-            pExitTM->tm_min = nightm.tm_min;
-            pExitTM->tm_sec = 59;
-            exitTs = mktime(pExitTM);
-        }
+    brokerid = appConfig.brokerid;
+    userid   = appConfig.userid;
+    password = appConfig.password;
+
+    // 当前或下一个交易时段（日盘/夜盘）收盘后5分钟退出
+    SessionCalendar calendar(appConfig.holidays);
+    exitTs = calendar.nextClose(time(nullptr)) + 5 * 60;
+    zlog_info(cat, "[CTPMarketSpi::Create] exit at %ld", exitTs);
+
+    replayFile  = appConfig.md_replay_file;
+    replaySpeed = appConfig.md_replay_speed;
+    replayLoop  = appConfig.md_replay_loop != 0;
 
-        zlog_info(cat, "[CTPMarketSpi::Create] API Version: %s", api->GetApiVersion());
-        zlog_info(cat, "[CTPMarketSpi::Create] Server Addr: %s", addrBuf);
-        zlog_info(cat, "[CTPMarketSpi::Create] exit at %ld", exitTs);
+    subs.setPacing(appConfig.md_sub_batch, appConfig.md_sub_rate);
+    conn.configure(fronts.empty() ? appConfig.md_server : fronts, appConfig.reconnect_backoff_min_ms,
+                   appConfig.reconnect_backoff_max_ms, appConfig.front_failover_sec);
 
+    return createApi();
+}
+
+bool CTPMarketSpi::createApi()
+{
+    if (!replayFile.empty())
+    {
+        // 离线回放录制文件，不连接前置
+        zlog_info(cat, "[CTPMarketSpi::Create] [%d] 回放行情: %s", feed, replayFile.c_str());
+        replayApi = new ReplayMdApi(replayFile, replaySpeed, replayLoop);
+        api = replayApi;
         api->RegisterSpi(this);
-        api->RegisterFront(addrBuf);
         api->Init();
-        requestid = 0;
         return true;
     }
-    return false;
+
+    api = CThostFtdcMdApi::CreateFtdcMdApi();
+    if (!api)
+    {
+        return false;
+    }
+
+    zlog_info(cat, "[CTPMarketSpi::Create] API Version: %s", api->GetApiVersion());
+    api->RegisterSpi(this);
+    // 注册全部前置，SDK断线后会在这些地址间自动轮询重连
+    for (auto& addr: conn.fronts())
+    {
+        char addrBuf[PATH_MAX] = {0};
+        snprintf(addrBuf, sizeof(addrBuf), "%s", addr.c_str());
+        zlog_info(cat, "[CTPMarketSpi::Create] [%d] Server Addr: %s", feed, addrBuf);
+        api->RegisterFront(addrBuf);
+    }
+    api->Init();
+    return true;
+}
+
+void CTPMarketSpi::pollConnection()
+{
+    switch (conn.poll())
+    {
+    case FrontConnection::ACTION_LOGIN:
+        login();
+        break;
+    case FrontConnection::ACTION_RECREATE:
+        zlog_warn(cat, "[CTPMarketSpi::pollConnection] 重建行情API");
+        Destroy();
+        if (!createApi())
+        {
+            zlog_error(cat, "[CTPMarketSpi::pollConnection] 行情API重建失败");
+        }
+        break;
+    default:
+        break;
+    }
 }
 
 void CTPMarketSpi::login()
@@ -237,6 +337,7 @@ void CTPMarketSpi::login()
     if (api)
     {
         int ret = api->ReqUserLogin(&req, ++requestid);
+        conn.onLoginSent(ret == 0);
         switch (ret)
         {
         case 0:
@@ -262,73 +363,23 @@ void CTPMarketSpi::login()
     }
 }
 
-bool CTPMarketSpi::inner_sub(char pp[][32], int num)
+void CTPMarketSpi::subscribe(std::vector<string>& contracts)
 {
-    char **ppInstruments = new char* [num];
-    for (int i=0; i < num; ++i)
-    {
-        ppInstruments[i] = new char [32];
-        memset(ppInstruments[i], 0, 32);
-        strncpy(ppInstruments[i], pp[i], 32);
-    }
-
-    int ret = api->SubscribeMarketData(ppInstruments, num);
-    for (int j = 0; j < num; ++j)
-    {
-        delete ppInstruments[j];
-    }
-    delete [] ppInstruments;
-    switch (ret)
-    {
-    case 0:
-        zlog_info(cat, "[CTPMarketSpi::subscribe] 订阅请求成功");
-        return true;
-    case -1:
-        zlog_error(cat, "[CTPMarketSpi::subscribe] 网络连接失败");
-        break;
-    case -2:
-        zlog_error(cat, "[CTPMarketSpi::subscribe] 未处理请求超过许可数");
-        break;
-    case -3:
-        zlog_error(cat, "[CTPMarketSpi::subscribe] 每秒发送请求数超过许可数");
-        break;
-
-    default:
-        zlog_error(cat, "[CTPMarketSpi::subscribe] 未知错误码: %d", ret);
-        break;
-    }
-
-    return false;
+    size_t added = subs.add(contracts);
+    zlog_info(cat, "[CTPMarketSpi::subscribe] 合约数量:%ld, 新增:%ld", contracts.size(), added);
+    subs.pump(api);
 }
 
-void CTPMarketSpi::subscribe(std::vector<string>& contracts)
+void CTPMarketSpi::unsubscribe(std::vector<string>& contracts)
 {
-    zlog_info(cat, "[CTPMarketSpi::subscribe] 合约数量:%ld", contracts.size());
-    char buf[100][32] = {0};
-    int idx = 0;
+    size_t removed = subs.remove(contracts);
+    zlog_info(cat, "[CTPMarketSpi::unsubscribe] 合约数量:%ld, 移除:%ld", contracts.size(), removed);
+    subs.pump(api);
+}
 
-    for (auto& m: contracts)
-    {
-        if (idx == 100)
-        {
-            idx = 0;
-            if (!inner_sub(buf, 100))
-            {
-                zlog_error(cat, "[CTPMarketSpi::subscribe] 订阅错误");
-            }
-            for (int j=0; j < 100; ++j)
-            {
-                memset(buf[j], 0, 32);
-            }
-        }
-        snprintf(buf[idx], 32, "%s", m.c_str());
-        ++idx;
-    }
-    // zlog_info(cat, "[CTPMarketSpi::subscribe] lastone: %s", buf[idx-1]);
-    if (!inner_sub(buf, idx))
-    {
-        zlog_error(cat, "[CTPMarketSpi::subscribe] 订阅错误");
-    }
+void CTPMarketSpi::pumpSubscriptions()
+{
+    subs.pump(api);
 }
 
 void CTPMarketSpi::Destroy()
@@ -338,6 +389,7 @@ void CTPMarketSpi::Destroy()
     {
         api->Release();
         api = nullptr;
+        replayApi = nullptr;
     }
     zlog_info(cat, "[CTPMarketSpi::Destroy] api released.");
 }
\ No newline at end of file
@@ -20,6 +20,8 @@
 #include "../proto/instrument.pb.h"
 #include "../proto/investor_position.pb.h"
 #include "../include/ZMQPublisher.h"
+#include "../include/BatchEncoder.h"
+#include "../include/ThreadTuning.h"
 
 // #include "../include/zycMain.h"
 
@@ -36,13 +38,40 @@ bool                isReady = false;
 bool                isPositionReady = false;
 bool                isTradingAccountReady = false;
 ZMQPublisher publisher("tcp://*:8890");
+// 合约/持仓批量数据编码器，输出缓冲区跨批次复用
+static BatchEncoder batchEncoder(publisher);
+static BatchEncoder::Encoding batchEncoding = BatchEncoder::ENCODING_CSV;
+static BatchEncoder::Encoding instrumentEncoding = BatchEncoder::ENCODING_PROTOBUF;
 
 // external global variable
 extern zlog_category_t *cat;
 
+CTPTraderSpi::CTPTraderSpi()
+    : api(nullptr), requestid(0), conn("td"), mock(false), events(4096),
+      workerRunning(false), instrumentBatchOpen(false), positionBatchOpen(false)
+{
+}
+
+CTPTraderSpi::~CTPTraderSpi()
+{
+    stopWorker();
+}
+
 void CTPTraderSpi::OnFrontConnected()
 {
     zlog_info(cat, "[CTPTraderSpi::OnFrontConnected] .");
+    // SDK回调线程按td_spi角色命名/绑核，每个线程只设置一次
+    static thread_local bool tuned = false;
+    if (!tuned)
+    {
+        tuned = true;
+        string error;
+        if (!ThreadTuning::global().apply("td_spi", "td_spi", error))
+        {
+            zlog_warn(cat, "[CTPTraderSpi::OnFrontConnected] 回调线程设置失败: %s", error.c_str());
+        }
+    }
+    conn.onConnected();
     //Authenticate();
     //zlog_info(cat, "[CTPTraderSpi::OnFrontConnected] 开始认证流程");
     Login();
@@ -51,8 +80,10 @@ void CTPTraderSpi::OnFrontConnected()
 void CTPTraderSpi::OnFrontDisconnected(int nReason)
 {
     zlog_info(cat, "[CTPTraderSpi::OnFrontDisconnected] Reason: %d", nReason);
-    chrono::seconds dura(10);
-    this_thread::sleep_for(dura);
+    // 不在回调线程中sleep，SDK会立即自动重连，登录重试与前置切换由主线程处理
+    conn.onDisconnected(nReason);
+    // 断线时查询结果可能只收到一部分，通知worker丢弃，重连后的查询从空列表开始
+    postEvent(TraderEvent::EV_RESET, nullptr, 0, nullptr, 0, true);
 }
 
 void CTPTraderSpi::OnHeartBeatWarning(int nTimeLapse)
@@ -81,16 +112,25 @@ void CTPTraderSpi::OnRspUserLogin(CThostFtdcRspUserLoginField *pRspUserLogin,
                                   bool                        bIsLast)
 {
     zlog_info(cat, "[CTPTraderSpi::OnRspUserLogin] .");
-    if (pRspInfo->ErrorID != 0)
+    if (pRspInfo && pRspInfo->ErrorID != 0)
     {
         zlog_error(cat, "[CTPTraderSpi::OnRspUserLogin] 交易服务器登陆出错，错误码:%d", pRspInfo->ErrorID);
         zlog_error(cat, "[CTPTraderSpi::OnRspUserLogin] 交易服务器登陆出错，错误信息:%s", pRspInfo->ErrorMsg);
+        conn.onLoginResult(false);
         return;
     }
+    conn.onLoginResult(true);
 
     zlog_info(cat, "[CTPTraderSpi::OnRspUserLogin] 交易服务器登陆成功");
     zlog_info(cat, "[CTPTraderSpi::OnRspUserLogin] 当前交易日: %s", api->GetTradingDay());
 
+    // 断线重连后的再次登录：合约已经查询完毕，不再重复查询
+    if (isReady)
+    {
+        zlog_info(cat, "[CTPTraderSpi::OnRspUserLogin] 重连登录成功，合约已就绪，跳过合约查询");
+        return;
+    }
+
     zlog_info(cat, "[CTPTraderSpi::OnRspUserLogin] 开始查询合约");
     ReqInstruments();
     
@@ -291,135 +331,8 @@ void CTPTraderSpi::OnRspQryInvestorPosition(CThostFtdcInvestorPositionField *pIn
                                             int                             nRequestID,
                                             bool                            bIsLast)
 {
-    zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 收到持仓回调, RequestID=%d, IsLast=%s", nRequestID, bIsLast ? "true" : "false");
-    
-    if (pRspInfo)
-    {
-        zlog_error(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 错误码:%d", pRspInfo->ErrorID);
-        zlog_error(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 错误信息:%s", pRspInfo->ErrorMsg);
-        return;
-    }
-
-    if (pInvestorPosition)
-    {
-        zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 收到持仓数据: %s, 持仓数量: %d", pInvestorPosition->InstrumentID, pInvestorPosition->Position);
-        
-        // 使用protobuf处理持仓数据
-        CThostFtdcInvestorPositionField position = *pInvestorPosition;
-        
-        // 转换为protobuf格式
-        ctp::InvestorPositionMessage positionMessage = ProtobufConverter::convertToProtobuf(position);
-        
-        // 序列化为字符串用于日志记录
-        std::string serialized = ProtobufConverter::serializeToString(positionMessage);
-        zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 持仓转换为protobuf格式: %s", pInvestorPosition->InstrumentID);
-        zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] Protobuf序列化大小: %zu 字节", serialized.size());
-        
-        // 存储原始CTP数据用于ZMQ发布
-        allPositions.push_back(position);
-    }
-    else
-    {
-        zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 收到空持仓数据（pInvestorPosition为nullptr）");
-    }
-
-    // 无论是否有持仓数据，都要在最后一条记录时设置isPositionReady
-        if (bIsLast)
-        {
-        zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 持仓查询完成，总共收到 %zu 条持仓记录", allPositions.size());
-        
-            {
-                std::lock_guard<std::mutex> lock(m);
-                isPositionReady = true;
-            zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] isPositionReady已设置为true");
-            }
-
-            // 使用protobuf批量处理持仓数据
-            if (!allPositions.empty()) {
-                zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 开始protobuf批量处理 %zu 个持仓", allPositions.size());
-                
-                // 转换为protobuf批量消息
-                ctp::InvestorPositionBatchMessage batchMessage = ProtobufConverter::convertBatchToProtobuf(allPositions);
-                
-                // 序列化批量消息
-                std::string batchSerialized = ProtobufConverter::serializeToString(batchMessage);
-                zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] Protobuf批量消息大小: %zu 字节", batchSerialized.size());
-                zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 批量消息时间戳: %lld", batchMessage.timestamp());
-                zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 批量消息类型: %s", batchMessage.message_type().c_str());
-                
-            // 通过ZMQ发布持仓数据（Protobuf格式）
-            bool publishSuccess = publisher.publishMessage("CTP_INVESTOR_POSITION_BATCH_UPDATE", batchSerialized);
-            if (publishSuccess) {
-                zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 成功发布 %zu 个持仓记录到ZMQ", allPositions.size());
-            } else {
-                zlog_error(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] ZMQ发布失败");
-            }
-                
-                // 同时发送CSV格式的持仓数据
-                std::ostringstream csvData;
-                for (const auto& position : allPositions) {
-                    csvData << position.InstrumentID << ","
-                           << position.BrokerID << ","
-                           << position.InvestorID << ","
-                           << position.PosiDirection << ","
-                           << position.HedgeFlag << ","
-                           << position.PositionDate << ","
-                           << position.YdPosition << ","
-                           << position.Position << ","
-                           << position.LongFrozen << ","
-                           << position.ShortFrozen << ","
-                           << position.LongFrozenAmount << ","
-                           << position.ShortFrozenAmount << ","
-                           << position.OpenVolume << ","
-                           << position.CloseVolume << ","
-                           << position.OpenAmount << ","
-                           << position.CloseAmount << ","
-                           << position.PositionCost << ","
-                           << position.PreMargin << ","
-                           << position.UseMargin << ","
-                           << position.FrozenMargin << ","
-                           << position.FrozenCash << ","
-                           << position.FrozenCommission << ","
-                           << position.CashIn << ","
-                           << position.Commission << ","
-                           << position.CloseProfit << ","
-                           << position.PositionProfit << ","
-                           << position.PreSettlementPrice << ","
-                           << position.SettlementPrice << ","
-                           << position.TradingDay << ","
-                           << position.SettlementID << ","
-                           << position.OpenCost << ","
-                           << position.ExchangeMargin << ","
-                           << position.CombPosition << ","
-                           << position.CombLongFrozen << ","
-                           << position.CombShortFrozen << ","
-                           << position.CloseProfitByDate << ","
-                           << position.CloseProfitByTrade << ","
-                           << position.TodayPosition << ","
-                           << position.MarginRateByMoney << ","
-                           << position.MarginRateByVolume << ","
-                           << position.StrikeFrozen << ","
-                           << position.StrikeFrozenAmount << ","
-                           << position.AbandonFrozen << ","
-                           << position.ExchangeID << ","
-                           << position.YdStrikeFrozen << ","
-                           << position.InvestUnitID << ","
-                       << position.PositionCostOffset << ","
-                       << "0" << ","  // TasPosition - 默认为0
-                       << "0" << "\n";  // TasCost - 默认为0
-                }
-                
-                std::string csvSerialized = csvData.str();
-            bool csvPublishSuccess = publisher.publishMessage("CTP_INVESTOR_POSITION_CSV_UPDATE", csvSerialized);
-            if (csvPublishSuccess) {
-                zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 成功发布CSV格式持仓数据，大小: %zu 字节", csvSerialized.size());
-            } else {
-                zlog_error(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] CSV格式持仓数据发布失败");
-            }
-        } else {
-            zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 没有持仓数据需要发布");
-        }
-    }
+    postEvent(TraderEvent::EV_POSITION, pInvestorPosition, sizeof(CThostFtdcInvestorPositionField),
+              pRspInfo, nRequestID, bIsLast);
 }
 
 void CTPTraderSpi::OnRspQryTradingAccount(CThostFtdcTradingAccountField *pTradingAccount,
@@ -427,92 +340,8 @@ void CTPTraderSpi::OnRspQryTradingAccount(CThostFtdcTradingAccountField *pTradin
                                             int                           nRequestID,
                                             bool                          bIsLast)
 {
-    zlog_info(cat, "[CTPTraderSpi::OnRspQryTradingAccount] 收到资金账户回调, RequestID=%d, IsLast=%s", nRequestID, bIsLast ? "true" : "false");
-    
-    if (pRspInfo && pRspInfo->ErrorID != 0) {
-        zlog_error(cat, "[CTPTraderSpi::OnRspQryTradingAccount] 错误码:%d", pRspInfo->ErrorID);
-        zlog_error(cat, "[CTPTraderSpi::OnRspQryTradingAccount] 错误信息:%s", pRspInfo->ErrorMsg);
-        if (bIsLast) {
-            isTradingAccountReady = true;
-        }
-        return;
-    }
-    
-    if (pTradingAccount) {
-        zlog_info(cat, "[CTPTraderSpi::OnRspQryTradingAccount] 收到资金账户数据: 账户=%s, 可用资金=%.2f, 账户余额=%.2f", 
-                  pTradingAccount->AccountID, pTradingAccount->Available, pTradingAccount->Balance);
-        
-        // 构建CSV格式的资金账户数据
-        std::ostringstream csvStream;
-        csvStream << "CTP_TRADING_ACCOUNT,"
-                  << pTradingAccount->BrokerID << ","
-                  << pTradingAccount->AccountID << ","
-                  << pTradingAccount->PreMortgage << ","
-                  << pTradingAccount->PreCredit << ","
-                  << pTradingAccount->PreDeposit << ","
-                  << pTradingAccount->PreBalance << ","
-                  << pTradingAccount->PreMargin << ","
-                  << pTradingAccount->InterestBase << ","
-                  << pTradingAccount->Interest << ","
-                  << pTradingAccount->Deposit << ","
-                  << pTradingAccount->Withdraw << ","
-                  << pTradingAccount->FrozenMargin << ","
-                  << pTradingAccount->FrozenCash << ","
-                  << pTradingAccount->FrozenCommission << ","
-                  << pTradingAccount->CurrMargin << ","
-                  << pTradingAccount->CashIn << ","
-                  << pTradingAccount->Commission << ","
-                  << pTradingAccount->CloseProfit << ","
-                  << pTradingAccount->PositionProfit << ","
-                  << pTradingAccount->Balance << ","
-                  << pTradingAccount->Available << ","
-                  << pTradingAccount->WithdrawQuota << ","
-                  << pTradingAccount->Reserve << ","
-                  << pTradingAccount->TradingDay << ","
-                  << pTradingAccount->SettlementID << ","
-                  << pTradingAccount->Credit << ","
-                  << pTradingAccount->Mortgage << ","
-                  << pTradingAccount->ExchangeMargin << ","
-                  << pTradingAccount->DeliveryMargin << ","
-                  << pTradingAccount->ExchangeDeliveryMargin << ","
-                  << pTradingAccount->ReserveBalance << ","
-                  << pTradingAccount->CurrencyID << ","
-                  << pTradingAccount->PreFundMortgageIn << ","
-                  << pTradingAccount->PreFundMortgageOut << ","
-                  << pTradingAccount->FundMortgageIn << ","
-                  << pTradingAccount->FundMortgageOut << ","
-                  << pTradingAccount->FundMortgageAvailable << ","
-                  << pTradingAccount->MortgageableFund << ","
-                  << pTradingAccount->SpecProductMargin << ","
-                  << pTradingAccount->SpecProductFrozenMargin << ","
-                  << pTradingAccount->SpecProductCommission << ","
-                  << pTradingAccount->SpecProductFrozenCommission << ","
-                  << pTradingAccount->SpecProductPositionProfit << ","
-                  << pTradingAccount->SpecProductCloseProfit << ","
-                  << pTradingAccount->SpecProductPositionProfitByAlg << ","
-                  << pTradingAccount->SpecProductExchangeMargin << ","
-                  << (pTradingAccount->BizType ? std::string(1, pTradingAccount->BizType) : "") << ","
-                  << pTradingAccount->FrozenSwap << ","
-                  << pTradingAccount->RemainSwap;
-        
-        std::string csvData = csvStream.str();
-        zlog_info(cat, "[CTPTraderSpi::OnRspQryTradingAccount] 资金账户CSV数据长度: %zu", csvData.length());
-        
-        // 通过ZMQ发布资金账户数据
-        if (publisher.publishMessage("CTP_TRADING_ACCOUNT_CSV_UPDATE", csvData)) {
-            zlog_info(cat, "[CTPTraderSpi::OnRspQryTradingAccount] 成功发布资金账户数据: %s", pTradingAccount->AccountID);
-        } else {
-            zlog_error(cat, "[CTPTraderSpi::OnRspQryTradingAccount] 资金账户数据发布失败: %s", pTradingAccount->AccountID);
-        }
-    } else {
-        zlog_info(cat, "[CTPTraderSpi::OnRspQryTradingAccount] 收到空资金账户数据（pTradingAccount为nullptr）");
-    }
-    
-    if (bIsLast) {
-        zlog_info(cat, "[CTPTraderSpi::OnRspQryTradingAccount] 资金账户查询完成");
-        isTradingAccountReady = true;
-        zlog_info(cat, "[CTPTraderSpi::OnRspQryTradingAccount] isTradingAccountReady已设置为true");
-    }
+    postEvent(TraderEvent::EV_TRADING_ACCOUNT, pTradingAccount, sizeof(CThostFtdcTradingAccountField),
+              pRspInfo, nRequestID, bIsLast);
 }
 
 void CTPTraderSpi::OnRspQryInvestor(CThostFtdcInvestorField   *pInvestor,
@@ -562,125 +391,8 @@ void CTPTraderSpi::OnRspQryInstrument(CThostFtdcInstrumentField *pInstrument,
                                       int                       nRequestID,
                                       bool                      bIsLast)
 {
-    zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] 收到合约回调, RequestID=%d, IsLast=%s, pInstrument=%s", 
-              nRequestID, bIsLast ? "true" : "false", pInstrument ? "非空" : "空");
-    
-    if (pRspInfo && pRspInfo->ErrorID != 0)
-    {
-        zlog_error(cat, "[CTPTraderSpi::OnRspQryInstrument] 错误码:%d", pRspInfo->ErrorID);
-        zlog_error(cat, "[CTPTraderSpi::OnRspQryInstrument] 错误信息:%s", pRspInfo->ErrorMsg);
-        
-        // 即使有错误，如果是最后一条记录也要设置isReady
-        if (bIsLast)
-        {
-            zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] 合约查询出错但已完成，设置isReady=true");
-            {
-                std::lock_guard<std::mutex> lock(m);
-                isReady = true;
-                zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] isReady已设置为true");
-            }
-            cv.notify_one();
-        }
-        return;
-    }
-
-    if (pInstrument)
-    {
-        contracts.push_back(pInstrument->ExchangeInstID);
-
-        // 使用protobuf处理合约数据
-        CThostFtdcInstrumentField instrument = *pInstrument;
-        
-        // 转换为protobuf格式
-        ctp::InstrumentMessage instrumentMessage = ProtobufConverter::convertToProtobuf(instrument);
-        
-        // 序列化为字符串用于日志记录
-        std::string serialized = ProtobufConverter::serializeToString(instrumentMessage);
-        zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] 合约转换为protobuf格式: %s", pInstrument->InstrumentID);
-        zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] Protobuf序列化大小: %zu 字节", serialized.size());
-        
-        // 存储原始CTP数据用于ZMQ发布
-        allInstruments.push_back(instrument);
-    }
-
-    // 无论是否有合约数据，都要在最后一条记录时设置isReady
-        if (bIsLast)
-        {
-        zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] 合约查询完成，设置isReady=true");
-            {
-                std::lock_guard<std::mutex> lock(m);
-                
-                isReady = true;
-            zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] isReady已设置为true");
-            }
-            
-            // 使用protobuf批量处理合约数据
-            if (!allInstruments.empty()) {
-                zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] 开始protobuf批量处理 %zu 个合约", allInstruments.size());
-                
-                // 转换为protobuf批量消息
-                ctp::InstrumentBatchMessage batchMessage = ProtobufConverter::convertBatchToProtobuf(allInstruments);
-                
-                // 序列化批量消息
-                std::string batchSerialized = ProtobufConverter::serializeToString(batchMessage);
-                zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] Protobuf批量消息大小: %zu 字节", batchSerialized.size());
-                zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] 批量消息时间戳: %lld", batchMessage.timestamp());
-                zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] 批量消息类型: %s", batchMessage.message_type().c_str());
-                
-
-
-                publisher.publishMessage("CTP_INSTRUMENT_BATCH_UPDATE", batchSerialized);
-                
-                // 同时发送CSV格式的合约数据
-                std::ostringstream csvData;
-                for (const auto& instrument : allInstruments) {
-                    csvData << instrument.InstrumentID << ","
-                           << instrument.ExchangeID << ","
-                           << instrument.InstrumentName << ","
-                           << instrument.ExchangeInstID << ","
-                           << instrument.ProductID << ","
-                           << instrument.ProductClass << ","
-                           << instrument.DeliveryYear << ","
-                           << instrument.DeliveryMonth << ","
-                           << instrument.MaxMarketOrderVolume << ","
-                           << instrument.MinMarketOrderVolume << ","
-                           << instrument.MaxLimitOrderVolume << ","
-                           << instrument.MinLimitOrderVolume << ","
-                           << instrument.VolumeMultiple << ","
-                           << instrument.PriceTick << ","
-                           << instrument.CreateDate << ","
-                           << instrument.OpenDate << ","
-                           << instrument.ExpireDate << ","
-                           << instrument.StartDelivDate << ","
-                           << instrument.EndDelivDate << ","
-                           << instrument.InstLifePhase << ","
-                           << (instrument.IsTrading ? "1" : "0") << ","
-                           << instrument.PositionType << ","
-                           << instrument.PositionDateType << ","
-                           << instrument.LongMarginRatio << ","
-                           << instrument.ShortMarginRatio << ","
-                           << instrument.MaxMarginSideAlgorithm << ","
-                           << instrument.UnderlyingInstrID << ","
-                           << instrument.StrikePrice << ","
-                           << instrument.OptionsType << ","
-                           << instrument.UnderlyingMultiple << ","
-                           << instrument.CombinationType << "\n";
-                }
-                
-            std::string csvSerialized = csvData.str();
-            bool csvPublishSuccess = publisher.publishMessage("INSTRUMENT", csvSerialized);
-            if (csvPublishSuccess) {
-                zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] 成功发布CSV格式合约数据，大小: %zu 字节", csvSerialized.size());
-            } else {
-                zlog_error(cat, "[CTPTraderSpi::OnRspQryInstrument] CSV格式合约数据发布失败");
-            }
-        } else {
-            zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] 没有合约数据需要发布");
-        }
-        zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] 准备调用cv.notify_one()");
-            cv.notify_one();
-        zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] cv.notify_one()已调用");
-    }
+    postEvent(TraderEvent::EV_INSTRUMENT, pInstrument, sizeof(CThostFtdcInstrumentField),
+              pRspInfo, nRequestID, bIsLast);
 }
 
 void CTPTraderSpi::OnRspQryDepthMarketData(CThostFtdcDepthMarketDataField *pDepthMarketData,
@@ -805,32 +517,366 @@ bool CTPTraderSpi::Create(const CAppConfig& appConfig)
         return false;
     }
     zlog_info(cat, "[CTPTraderSpi::Create] ZMQ发布者连接成功");
+
+    brokerid = appConfig.brokerid;
+    userid   = appConfig.userid;
+    password = appConfig.password;
+    appid    = appConfig.appid;
+    authcode = appConfig.authcode;
+    batchEncoding = BatchEncoder::parseEncoding(appConfig.batch_encoding);
+    instrumentEncoding = BatchEncoder::parseEncoding(appConfig.instrument_encoding);
+    batchEncoder.setRowsPerChunk(appConfig.batch_chunk_rows);
+    mock = appConfig.td_mock != 0;
+    mockOptions.fixtureDir = appConfig.td_mock_dir;
+    mockOptions.syntheticInstruments = appConfig.td_mock_instruments;
+    mockOptions.latencyMs = appConfig.td_mock_latency_ms;
+    mockOptions.pageSize = appConfig.td_mock_page_size;
+    mockOptions.pageGapMs = appConfig.td_mock_page_gap_ms;
+    mockOptions.queryPerSec = appConfig.td_mock_query_rate;
+    mockOptions.maxInflight = appConfig.td_mock_max_inflight;
+    conn.configure(appConfig.td_server, appConfig.reconnect_backoff_min_ms,
+                   appConfig.reconnect_backoff_max_ms, appConfig.front_failover_sec);
+
+    if (!worker.joinable())
+    {
+        workerRunning.store(true, memory_order_release);
+        worker = thread(&CTPTraderSpi::workerLoop, this);
+    }
+
+    return createApi();
+}
+
+bool CTPTraderSpi::createApi()
+{
+    if (mock)
+    {
+        zlog_info(cat, "[CTPTraderSpi::Create] 使用模拟交易前置");
+        api = new MockTraderApi(mockOptions);
+        api->RegisterSpi(this);
+        api->Init();
+        return true;
+    }
+
     api = CThostFtdcTraderApi::CreateFtdcTraderApi();
-    if (api)
+    if (!api)
+    {
+        return false;
+    }
+
+    zlog_info(cat, "[CTPTraderSpi::Create] API Version: %s", api->GetApiVersion());
+    api->RegisterSpi(this);
+    api->SubscribePrivateTopic(THOST_TERT_QUICK);
+    api->SubscribePublicTopic(THOST_TERT_QUICK);
+    // 注册全部前置，SDK断线后会在这些地址间自动轮询重连
+    for (auto& addr: conn.fronts())
     {
         char addrBuf[PATH_MAX] = {0};
-        snprintf(addrBuf, sizeof(addrBuf), "tcp://%s", appConfig.td_server.c_str());
-        brokerid = appConfig.brokerid;
-        userid   = appConfig.userid;
-        password = appConfig.password;
-        appid    = appConfig.appid;
-        authcode = appConfig.authcode;
-
-        zlog_info(cat, "[CTPTraderSpi::Create] API Version: %s", api->GetApiVersion());
+        snprintf(addrBuf, sizeof(addrBuf), "%s", addr.c_str());
         zlog_info(cat, "[CTPTraderSpi::Create] Trade Server Addr: %s", addrBuf);
-
-        api->RegisterSpi(this);
-        api->SubscribePrivateTopic(THOST_TERT_QUICK);
-        api->SubscribePublicTopic(THOST_TERT_QUICK);
         api->RegisterFront(addrBuf);
-        api->Init();
-        requestid = 0;
+    }
+    api->Init();
+    return true;
+}
+
+void CTPTraderSpi::pollConnection()
+{
+    switch (conn.poll())
+    {
+    case FrontConnection::ACTION_LOGIN:
+        Login();
+        break;
+    case FrontConnection::ACTION_RECREATE:
+        zlog_warn(cat, "[CTPTraderSpi::pollConnection] 重建交易API");
+        if (api)
+        {
+            api->Release();
+            api = nullptr;
+        }
+        if (!createApi())
+        {
+            zlog_error(cat, "[CTPTraderSpi::pollConnection] 交易API重建失败");
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void CTPTraderSpi::postEvent(uint8_t type, const void* data, size_t size,
+                             CThostFtdcRspInfoField* pRspInfo, int nRequestID, bool bIsLast)
+{
+    TraderEvent ev;
+    ev.type = type;
+    ev.hasData = data != nullptr;
+    ev.isLast = bIsLast;
+    ev.requestID = nRequestID;
+    ev.errorID = pRspInfo ? pRspInfo->ErrorID : 0;
+    ev.errorMsg[0] = '\0';
+    if (ev.errorID != 0)
+    {
+        memcpy(ev.errorMsg, pRspInfo->ErrorMsg, sizeof(ev.errorMsg));
+    }
+    if (data)
+    {
+        memcpy(&ev.instrument, data, size);
+    }
+    // 队列满时enqueue会追加新的块，回调线程不会阻塞
+    events.enqueue(ev);
+}
+
+void CTPTraderSpi::workerLoop()
+{
+    zlog_info(cat, "[CTPTraderSpi::workerLoop] 查询结果处理线程启动");
+    string error;
+    if (!ThreadTuning::global().apply("td_worker", "td_worker", error))
+    {
+        zlog_warn(cat, "[CTPTraderSpi::workerLoop] 线程设置失败: %s", error.c_str());
+    }
+    TraderEvent ev;
+    // 停止时先处理完队列中剩余的事件
+    while (workerRunning.load(memory_order_acquire) || events.size_approx() > 0)
+    {
+        if (!events.wait_dequeue_timed(ev, 100000))
+        {
+            continue;
+        }
+        switch (ev.type)
+        {
+        case TraderEvent::EV_INSTRUMENT:
+            handleInstrument(ev);
+            break;
+        case TraderEvent::EV_POSITION:
+            handlePosition(ev);
+            break;
+        case TraderEvent::EV_TRADING_ACCOUNT:
+            handleTradingAccount(ev);
+            break;
+        case TraderEvent::EV_RESET:
+            resetBatches();
+            break;
+        default:
+            break;
+        }
+    }
+    zlog_info(cat, "[CTPTraderSpi::workerLoop] 查询结果处理线程退出");
+}
+
+void CTPTraderSpi::stopWorker()
+{
+    if (worker.joinable())
+    {
+        workerRunning.store(false, memory_order_release);
+        worker.join();
+    }
+}
+
+void CTPTraderSpi::resetBatches()
+{
+    // 只丢弃未收齐的一轮，已完成查询的contracts仍被行情订阅使用
+    if (instrumentBatchOpen)
+    {
+        zlog_warn(cat, "[CTPTraderSpi::resetBatches] 前置断开，丢弃未收齐的合约查询结果 %zu 条", allInstruments.size());
+        contracts.clear();
+        allInstruments.clear();
+        instrumentBatchOpen = false;
+    }
+    if (positionBatchOpen)
+    {
+        zlog_warn(cat, "[CTPTraderSpi::resetBatches] 前置断开，丢弃未收齐的持仓查询结果 %zu 条", allPositions.size());
+        allPositions.clear();
+        positionBatchOpen = false;
+    }
+}
+
+void CTPTraderSpi::handleInstrument(const TraderEvent& ev)
+{
+    if (!instrumentBatchOpen)
+    {
+        // 新一轮查询，丢弃上一轮的结果
+        contracts.clear();
+        allInstruments.clear();
+        instrumentBatchOpen = true;
+    }
+
+    if (ev.errorID != 0)
+    {
+        zlog_error(cat, "[CTPTraderSpi::OnRspQryInstrument] 错误码:%d", ev.errorID);
+        zlog_error(cat, "[CTPTraderSpi::OnRspQryInstrument] 错误信息:%s", ev.errorMsg);
+    }
+    else if (ev.hasData)
+    {
+        contracts.push_back(ev.instrument.ExchangeInstID);
+        allInstruments.push_back(ev.instrument);
+    }
+
+    // 无论是否出错，都要在最后一条记录时设置isReady
+    if (!ev.isLast)
+    {
+        return;
+    }
+    instrumentBatchOpen = false;
+    zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] 合约查询完成, RequestID=%d, 共 %zu 个合约",
+              ev.requestID, allInstruments.size());
+
+    // 按配置的编码流式发布合约数据（多帧分块）
+    if (!allInstruments.empty()) {
+        batchEncoder.begin(BatchEncoder::BATCH_INSTRUMENT, instrumentEncoding);
+        for (const auto& instrument : allInstruments) {
+            batchEncoder.add(instrument);
+        }
+        if (batchEncoder.finish()) {
+            zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] 成功发布 %zu 个合约，%zu 帧，%zu 字节",
+                      batchEncoder.rows(), batchEncoder.chunks(), batchEncoder.bytes());
+        } else {
+            zlog_error(cat, "[CTPTraderSpi::OnRspQryInstrument] 合约数据发布失败");
+        }
+    } else {
+        zlog_info(cat, "[CTPTraderSpi::OnRspQryInstrument] 没有合约数据需要发布");
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m);
+        isReady = true;
+    }
+    cv.notify_all();
+}
+
+void CTPTraderSpi::handlePosition(const TraderEvent& ev)
+{
+    if (!positionBatchOpen)
+    {
+        allPositions.clear();
+        positionBatchOpen = true;
+    }
+
+    if (ev.errorID != 0)
+    {
+        zlog_error(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 错误码:%d", ev.errorID);
+        zlog_error(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 错误信息:%s", ev.errorMsg);
+    }
+    else if (ev.hasData)
+    {
+        allPositions.push_back(ev.position);
+    }
+
+    // 无论是否有持仓数据，都要在最后一条记录时设置isPositionReady
+    if (!ev.isLast)
+    {
+        return;
+    }
+    positionBatchOpen = false;
+    zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 持仓查询完成, RequestID=%d, 总共收到 %zu 条持仓记录",
+              ev.requestID, allPositions.size());
+
+    // 按配置的编码流式发布持仓数据（多帧分块）
+    if (!allPositions.empty()) {
+        batchEncoder.begin(BatchEncoder::BATCH_POSITION, batchEncoding);
+        for (const auto& position : allPositions) {
+            batchEncoder.add(position);
+        }
+        if (batchEncoder.finish()) {
+            zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 成功发布 %zu 个持仓记录到ZMQ，%zu 帧，%zu 字节",
+                      batchEncoder.rows(), batchEncoder.chunks(), batchEncoder.bytes());
+        } else {
+            zlog_error(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] ZMQ发布失败");
+        }
+    } else {
+        zlog_info(cat, "[CTPTraderSpi::OnRspQryInvestorPosition] 没有持仓数据需要发布");
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m);
+        isPositionReady = true;
+    }
+    cv.notify_all();
+}
+
+void CTPTraderSpi::handleTradingAccount(const TraderEvent& ev)
+{
+    if (ev.errorID != 0)
+    {
+        zlog_error(cat, "[CTPTraderSpi::OnRspQryTradingAccount] 错误码:%d", ev.errorID);
+        zlog_error(cat, "[CTPTraderSpi::OnRspQryTradingAccount] 错误信息:%s", ev.errorMsg);
+    }
+    else if (ev.hasData)
+    {
+        const CThostFtdcTradingAccountField* pTradingAccount = &ev.account;
+        zlog_info(cat, "[CTPTraderSpi::OnRspQryTradingAccount] 收到资金账户数据: 账户=%s, 可用资金=%.2f, 账户余额=%.2f", 
+                  pTradingAccount->AccountID, pTradingAccount->Available, pTradingAccount->Balance);
         
+        // 构建CSV格式的资金账户数据
+        std::ostringstream csvStream;
+        csvStream << "CTP_TRADING_ACCOUNT,"
+                  << pTradingAccount->BrokerID << ","
+                  << pTradingAccount->AccountID << ","
+                  << pTradingAccount->PreMortgage << ","
+                  << pTradingAccount->PreCredit << ","
+                  << pTradingAccount->PreDeposit << ","
+                  << pTradingAccount->PreBalance << ","
+                  << pTradingAccount->PreMargin << ","
+                  << pTradingAccount->InterestBase << ","
+                  << pTradingAccount->Interest << ","
+                  << pTradingAccount->Deposit << ","
+                  << pTradingAccount->Withdraw << ","
+                  << pTradingAccount->FrozenMargin << ","
+                  << pTradingAccount->FrozenCash << ","
+                  << pTradingAccount->FrozenCommission << ","
+                  << pTradingAccount->CurrMargin << ","
+                  << pTradingAccount->CashIn << ","
+                  << pTradingAccount->Commission << ","
+                  << pTradingAccount->CloseProfit << ","
+                  << pTradingAccount->PositionProfit << ","
+                  << pTradingAccount->Balance << ","
+                  << pTradingAccount->Available << ","
+                  << pTradingAccount->WithdrawQuota << ","
+                  << pTradingAccount->Reserve << ","
+                  << pTradingAccount->TradingDay << ","
+                  << pTradingAccount->SettlementID << ","
+                  << pTradingAccount->Credit << ","
+                  << pTradingAccount->Mortgage << ","
+                  << pTradingAccount->ExchangeMargin << ","
+                  << pTradingAccount->DeliveryMargin << ","
+                  << pTradingAccount->ExchangeDeliveryMargin << ","
+                  << pTradingAccount->ReserveBalance << ","
+                  << pTradingAccount->CurrencyID << ","
+                  << pTradingAccount->PreFundMortgageIn << ","
+                  << pTradingAccount->PreFundMortgageOut << ","
+                  << pTradingAccount->FundMortgageIn << ","
+                  << pTradingAccount->FundMortgageOut << ","
+                  << pTradingAccount->FundMortgageAvailable << ","
+                  << pTradingAccount->MortgageableFund << ","
+                  << pTradingAccount->SpecProductMargin << ","
+                  << pTradingAccount->SpecProductFrozenMargin << ","
+                  << pTradingAccount->SpecProductCommission << ","
+                  << pTradingAccount->SpecProductFrozenCommission << ","
+                  << pTradingAccount->SpecProductPositionProfit << ","
+                  << pTradingAccount->SpecProductCloseProfit << ","
+                  << pTradingAccount->SpecProductPositionProfitByAlg << ","
+                  << pTradingAccount->SpecProductExchangeMargin << ","
+                  << (pTradingAccount->BizType ? std::string(1, pTradingAccount->BizType) : "") << ","
+                  << pTradingAccount->FrozenSwap << ","
+                  << pTradingAccount->RemainSwap;
         
+        std::string csvData = csvStream.str();
+        zlog_info(cat, "[CTPTraderSpi::OnRspQryTradingAccount] 资金账户CSV数据长度: %zu", csvData.length());
         
-        return true;
+        // 通过ZMQ发布资金账户数据
+        if (publisher.publishMessage("CTP_TRADING_ACCOUNT_CSV_UPDATE", csvData)) {
+            zlog_info(cat, "[CTPTraderSpi::OnRspQryTradingAccount] 成功发布资金账户数据: %s", pTradingAccount->AccountID);
+        } else {
+            zlog_error(cat, "[CTPTraderSpi::OnRspQryTradingAccount] 资金账户数据发布失败: %s", pTradingAccount->AccountID);
+        }
+    }
+
+    if (ev.isLast) {
+        zlog_info(cat, "[CTPTraderSpi::OnRspQryTradingAccount] 资金账户查询完成");
+        {
+            std::lock_guard<std::mutex> lock(m);
+            isTradingAccountReady = true;
+        }
+        cv.notify_all();
     }
-    return false;
 }
 
 void CTPTraderSpi::Authenticate()
@@ -874,6 +920,7 @@ void CTPTraderSpi::Login()
     if (api)
     {
         int ret = api->ReqUserLogin(&req, ++requestid);
+        conn.onLoginSent(ret == 0);
         switch (ret)
         {
         case 0:
@@ -938,6 +985,10 @@ void CTPTraderSpi::Destroy()
         api = nullptr;
     }
     zlog_info(cat, "[CTPTraderSpi::Destroy] api released.");
+
+    // API释放后不会再有回调，等待worker处理完剩余事件
+    stopWorker();
+    zlog_info(cat, "[CTPTraderSpi::Destroy] worker stopped.");
     
     // 清理ZMQ发布者
     publisher.disconnect();
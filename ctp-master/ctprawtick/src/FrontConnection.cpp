@@ -0,0 +1,238 @@
+#include <cstring>
+#include <sstream>
+#include <algorithm>
+#include "zlog.h"
+#include "FrontConnection.h"
+
+using namespace std;
+
+// external global variable
+extern zlog_category_t *cat;
+
+FrontConnection::FrontConnection(const string& name_)
+    : name(name_),
+      backoffMinMs(500),
+      backoffMaxMs(30000),
+      failoverSec(30),
+      st(FRONT_DISCONNECTED),
+      loginAttempts(0),
+      recreateAttempts(0),
+      nextLoginAt(Clock::now()),
+      recreateAt(Clock::now() + chrono::seconds(30)),
+      loginDeadline(Clock::now()),
+      loginDue(false),
+      inGap(false),
+      gapStartPending(false),
+      gapReason(0),
+      gapStartEpochMs(0),
+      gapEndPending(false),
+      gapEndMs(0),
+      gapEndEpochMs(0)
+{
+    memset(&counters, 0, sizeof(counters));
+}
+
+void FrontConnection::configure(const string& serverList, int backoffMinMs_, int backoffMaxMs_, int failoverSec_)
+{
+    lock_guard<mutex> lock(mtx);
+    addrs.clear();
+    istringstream iss(serverList);
+    string addr;
+    while (getline(iss, addr, ','))
+    {
+        addr.erase(0, addr.find_first_not_of(" \t"));
+        addr.erase(addr.find_last_not_of(" \t") + 1);
+        if (addr.empty())
+        {
+            continue;
+        }
+        if (addr.find("://") == string::npos)
+        {
+            addr = "tcp://" + addr;
+        }
+        addrs.push_back(addr);
+    }
+
+    backoffMinMs = backoffMinMs_ > 0 ? backoffMinMs_ : 500;
+    backoffMaxMs = max(backoffMaxMs_, backoffMinMs);
+    failoverSec  = failoverSec_ > 0 ? failoverSec_ : 30;
+    recreateAt   = Clock::now() + chrono::seconds(failoverSec);
+}
+
+vector<string> FrontConnection::fronts() const
+{
+    lock_guard<mutex> lock(mtx);
+    return addrs;
+}
+
+FrontConnection::Clock::duration FrontConnection::backoff(int attempts) const
+{
+    int shift = min(max(attempts - 1, 0), 20);
+    int64_t ms = min<int64_t>(static_cast<int64_t>(backoffMinMs) << shift, backoffMaxMs);
+    return chrono::milliseconds(ms);
+}
+
+int64_t FrontConnection::nowEpochMs()
+{
+    return chrono::duration_cast<chrono::milliseconds>(
+        chrono::system_clock::now().time_since_epoch()).count();
+}
+
+void FrontConnection::onConnected()
+{
+    lock_guard<mutex> lock(mtx);
+    st = FRONT_CONNECTED;
+    loginDue = false;
+}
+
+void FrontConnection::onLoginSent(bool ok)
+{
+    lock_guard<mutex> lock(mtx);
+    if (ok)
+    {
+        // 应答丢失时SDK不会再回调，超时后按断线处理
+        st = FRONT_LOGGING_IN;
+        loginDeadline = Clock::now() + chrono::seconds(failoverSec);
+        return;
+    }
+    // 请求未发出（-1/-2/-3），退避后由主线程重发
+    ++counters.loginFailCount;
+    ++loginAttempts;
+    nextLoginAt = Clock::now() + backoff(loginAttempts);
+    loginDue = true;
+}
+
+void FrontConnection::onLoginResult(bool ok)
+{
+    lock_guard<mutex> lock(mtx);
+    Clock::time_point now = Clock::now();
+    if (!ok)
+    {
+        st = FRONT_CONNECTED;
+        ++counters.loginFailCount;
+        ++loginAttempts;
+        nextLoginAt = now + backoff(loginAttempts);
+        loginDue = true;
+        zlog_warn(cat, "[FrontConnection::onLoginResult] %s 登录失败，%lld ms后重试",
+                  name.c_str(), (long long)chrono::duration_cast<chrono::milliseconds>(nextLoginAt - now).count());
+        return;
+    }
+
+    st = FRONT_LOGGED_IN;
+    loginAttempts = 0;
+    recreateAttempts = 0;
+    loginDue = false;
+
+    if (inGap)
+    {
+        int64_t gapMs = chrono::duration_cast<chrono::milliseconds>(now - gapStart).count();
+        inGap = false;
+        ++counters.reconnectCount;
+        counters.lastGapMs = gapMs;
+        counters.maxGapMs = max(counters.maxGapMs, gapMs);
+        counters.totalGapMs += gapMs;
+        gapEndPending = true;
+        gapEndMs = gapMs;
+        gapEndEpochMs = nowEpochMs();
+    }
+}
+
+void FrontConnection::onDisconnected(int reason)
+{
+    lock_guard<mutex> lock(mtx);
+    Clock::time_point now = Clock::now();
+    st = FRONT_DISCONNECTED;
+    loginDue = false;
+    ++counters.disconnectCount;
+
+    if (!inGap)
+    {
+        inGap = true;
+        gapStart = now;
+        gapStartPending = true;
+        gapReason = reason;
+        gapStartEpochMs = nowEpochMs();
+        recreateAt = now + chrono::seconds(failoverSec);
+    }
+}
+
+FrontConnection::Action FrontConnection::poll()
+{
+    lock_guard<mutex> lock(mtx);
+    Clock::time_point now = Clock::now();
+
+    if (st == FRONT_CONNECTED && loginDue && now >= nextLoginAt)
+    {
+        loginDue = false;
+        return ACTION_LOGIN;
+    }
+
+    if (st == FRONT_DISCONNECTED && now >= recreateAt && !addrs.empty())
+    {
+        // SDK自身的重连没有恢复，轮换前置顺序后重建API
+        return recreate(now, "断线");
+    }
+
+    if (st == FRONT_LOGGING_IN && now >= loginDeadline && !addrs.empty())
+    {
+        // 登录请求发出后一直没有应答，与断线一样轮换前置重建API，退避次数累计
+        ++counters.loginFailCount;
+        st = FRONT_DISCONNECTED;
+        loginDue = false;
+        return recreate(now, "登录无应答");
+    }
+    return ACTION_NONE;
+}
+
+FrontConnection::Action FrontConnection::recreate(Clock::time_point now, const char* why)
+{
+    if (addrs.size() > 1)
+    {
+        rotate(addrs.begin(), addrs.begin() + 1, addrs.end());
+    }
+    ++recreateAttempts;
+    ++counters.recreateCount;
+    recreateAt = now + chrono::seconds(failoverSec) + backoff(recreateAttempts);
+    zlog_warn(cat, "[FrontConnection::poll] %s %s超过%d秒，切换前置: %s",
+              name.c_str(), why, failoverSec, addrs.front().c_str());
+    return ACTION_RECREATE;
+}
+
+bool FrontConnection::takeGapStart(int& reason, int64_t& epochMs)
+{
+    lock_guard<mutex> lock(mtx);
+    if (!gapStartPending)
+    {
+        return false;
+    }
+    gapStartPending = false;
+    reason = gapReason;
+    epochMs = gapStartEpochMs;
+    return true;
+}
+
+bool FrontConnection::takeGapEnd(int64_t& gapMs, int64_t& epochMs)
+{
+    lock_guard<mutex> lock(mtx);
+    // 缺口开始标记还未取走时不发结束标记，保证顺序
+    if (!gapEndPending || gapStartPending)
+    {
+        return false;
+    }
+    gapEndPending = false;
+    gapMs = gapEndMs;
+    epochMs = gapEndEpochMs;
+    return true;
+}
+
+FrontConnection::State FrontConnection::state() const
+{
+    lock_guard<mutex> lock(mtx);
+    return st;
+}
+
+FrontConnection::Stats FrontConnection::stats() const
+{
+    lock_guard<mutex> lock(mtx);
+    return counters;
+}
@@ -0,0 +1,115 @@
+#include <cstdlib>
+#include "zlog.h"
+#include "KlineQueryServer.h"
+
+using namespace std;
+
+// external global variable
+extern zlog_category_t *cat;
+
+KlineQueryServer::KlineQueryServer(KlineEngine& engine_, const string& address_)
+    : engine(engine_), address(address_), requestCount(0)
+{
+}
+
+KlineQueryServer::~KlineQueryServer()
+{
+    stop();
+}
+
+bool KlineQueryServer::start()
+{
+    try
+    {
+        context.reset(new zmq::context_t(1));
+        socket.reset(new zmq::socket_t(*context, ZMQ_REP));
+        int linger = 0;
+        socket->setsockopt(ZMQ_LINGER, &linger, sizeof(linger));
+        socket->bind(address);
+    }
+    catch (const zmq::error_t& e)
+    {
+        zlog_error(cat, "[KlineQueryServer::start] 绑定 %s 失败: %s", address.c_str(), e.what());
+        socket.reset();
+        context.reset();
+        return false;
+    }
+    zlog_info(cat, "[KlineQueryServer::start] K线查询服务: %s", address.c_str());
+    return true;
+}
+
+void KlineQueryServer::stop()
+{
+    socket.reset();
+    context.reset();
+}
+
+int KlineQueryServer::poll()
+{
+    if (!socket)
+    {
+        return 0;
+    }
+
+    int handled = 0;
+    try
+    {
+        zmq::message_t request;
+        while (socket->recv(request, zmq::recv_flags::dontwait))
+        {
+            // 多帧请求只取第一帧
+            while (request.more())
+            {
+                zmq::message_t ignored;
+                if (!socket->recv(ignored, zmq::recv_flags::none) || !ignored.more())
+                {
+                    break;
+                }
+            }
+            string reply = handle(string(static_cast<const char*>(request.data()), request.size()));
+            zmq::message_t replyMsg(reply.data(), reply.size());
+            socket->send(replyMsg, zmq::send_flags::none);
+            ++handled;
+            ++requestCount;
+        }
+    }
+    catch (const zmq::error_t& e)
+    {
+        zlog_error(cat, "[KlineQueryServer::poll] %s", e.what());
+    }
+    return handled;
+}
+
+string KlineQueryServer::handle(const string& request)
+{
+    size_t p1 = request.find(',');
+    size_t p2 = p1 == string::npos ? string::npos : request.find(',', p1 + 1);
+    if (p2 == string::npos)
+    {
+        return "ERROR,请求格式应为: 合约,周期,根数";
+    }
+
+    string symbol = request.substr(0, p1);
+    int tf = KlineEngine::parseTimeframe(request.substr(p1 + 1, p2 - p1 - 1));
+    long n = atol(request.c_str() + p2 + 1);
+    if (tf < 0)
+    {
+        return "ERROR,未知周期";
+    }
+    if (n <= 0)
+    {
+        return "ERROR,根数必须大于0";
+    }
+
+    bars.clear();
+    engine.query(symbol, tf, static_cast<size_t>(n), bars);
+
+    string reply = "symbol,datetime,open,high,low,close,volume,turnover,open_interest,oi_delta\n";
+    reply.reserve(reply.size() + bars.size() * 96);
+    for (auto& bar: bars)
+    {
+        reply += KlineEngine::toCsv(bar);
+        reply.push_back('\n');
+    }
+    return reply;
+}
@@ -0,0 +1,191 @@
+#include <cstring>
+#include <cstdio>
+#include <ctime>
+#include "LatencyStats.h"
+
+using namespace std;
+
+// 字段号100、wire type 2(length-delimited)的tag，varint编码
+static const unsigned char kTrailerTag[2] = {0xA2, 0x06};
+static const uint32_t      kTrailerMagic = 0x3154414C;     // "LAT1"
+// magic + stamps + recvWallNs
+static const size_t        kPayloadSize = sizeof(uint32_t) + sizeof(int64_t) * (STAGE_COUNT + 1);
+static const size_t        kEncodedSize = sizeof(kTrailerTag) + 1 + kPayloadSize;
+
+static_assert(kPayloadSize < 128, "trailer length must fit in one varint byte");
+
+int64_t monotonicNs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+int64_t wallNs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+LatencyTrailer::LatencyTrailer()
+    : recvWallNs(0)
+{
+    memset(stamps, 0, sizeof(stamps));
+}
+
+size_t LatencyTrailer::encodedSize()
+{
+    return kEncodedSize;
+}
+
+void LatencyTrailer::appendTo(string& out) const
+{
+    char buf[kEncodedSize];
+    char* p = buf;
+    memcpy(p, kTrailerTag, sizeof(kTrailerTag));
+    p += sizeof(kTrailerTag);
+    *p++ = static_cast<char>(kPayloadSize);
+    memcpy(p, &kTrailerMagic, sizeof(kTrailerMagic));
+    p += sizeof(kTrailerMagic);
+    memcpy(p, stamps, sizeof(stamps));
+    p += sizeof(stamps);
+    memcpy(p, &recvWallNs, sizeof(recvWallNs));
+    out.append(buf, kEncodedSize);
+}
+
+bool LatencyTrailer::parseFrom(const string& message)
+{
+    if (message.size() < kEncodedSize)
+    {
+        return false;
+    }
+    const char* p = message.data() + message.size() - kEncodedSize;
+    uint32_t magic = 0;
+    memcpy(&magic, p + sizeof(kTrailerTag) + 1, sizeof(magic));
+    if (memcmp(p, kTrailerTag, sizeof(kTrailerTag)) != 0
+        || static_cast<unsigned char>(p[sizeof(kTrailerTag)]) != kPayloadSize
+        || magic != kTrailerMagic)
+    {
+        return false;
+    }
+    p += sizeof(kTrailerTag) + 1 + sizeof(magic);
+    memcpy(stamps, p, sizeof(stamps));
+    p += sizeof(stamps);
+    memcpy(&recvWallNs, p, sizeof(recvWallNs));
+    return true;
+}
+
+LatencyHistogram::LatencyHistogram(const char* name)
+    : label(name), total(0), sum(0), maxValue(0)
+{
+    for (auto& c: counts)
+    {
+        c.store(0, memory_order_relaxed);
+    }
+}
+
+size_t LatencyHistogram::indexOf(int64_t ns)
+{
+    uint64_t v = static_cast<uint64_t>(ns);
+    const uint64_t limit = (1ULL << (MAX_SHIFT + SUB_BITS)) - 1;
+    if (v > limit)
+    {
+        v = limit;
+    }
+    if (v < (1ULL << SUB_BITS))
+    {
+        return static_cast<size_t>(v);
+    }
+    // 最高位所在的幂次，右移后落在[HALF, 2*HALF)
+    int shift = 63 - __builtin_clzll(v) - (SUB_BITS - 1);
+    return static_cast<size_t>(shift) * HALF + static_cast<size_t>(v >> shift);
+}
+
+int64_t LatencyHistogram::valueOf(size_t index)
+{
+    if (index < (1u << SUB_BITS))
+    {
+        return static_cast<int64_t>(index);
+    }
+    int shift = static_cast<int>(index / HALF) - 1;
+    uint64_t low = static_cast<uint64_t>(index - shift * HALF) << shift;
+    return static_cast<int64_t>(low + (1ULL << shift) - 1);
+}
+
+void LatencyHistogram::record(int64_t ns)
+{
+    if (ns < 0)
+    {
+        return;
+    }
+    counts[indexOf(ns)].fetch_add(1, memory_order_relaxed);
+    total.fetch_add(1, memory_order_relaxed);
+    sum.fetch_add(ns, memory_order_relaxed);
+
+    int64_t cur = maxValue.load(memory_order_relaxed);
+    while (ns > cur && !maxValue.compare_exchange_weak(cur, ns, memory_order_relaxed))
+    {
+    }
+}
+
+LatencyHistogram::Summary LatencyHistogram::summarize(bool reset)
+{
+    // 先取出各桶计数，分位数按取出的计数计算，与并发的record互不阻塞
+    static thread_local uint64_t snapshot[BUCKETS];
+    uint64_t count = 0;
+    for (size_t i = 0; i < BUCKETS; ++i)
+    {
+        snapshot[i] = reset ? counts[i].exchange(0, memory_order_relaxed) : counts[i].load(memory_order_relaxed);
+        count += snapshot[i];
+    }
+    int64_t sumNs = reset ? sum.exchange(0, memory_order_relaxed) : sum.load(memory_order_relaxed);
+    int64_t maxNs = reset ? maxValue.exchange(0, memory_order_relaxed) : maxValue.load(memory_order_relaxed);
+    if (reset)
+    {
+        total.store(0, memory_order_relaxed);
+    }
+
+    Summary s;
+    memset(&s, 0, sizeof(s));
+    s.count = count;
+    if (count == 0)
+    {
+        return s;
+    }
+    s.max = maxNs;
+    s.mean = sumNs / static_cast<int64_t>(count);
+
+    const double quantiles[] = {0.5, 0.9, 0.99, 0.999};
+    int64_t* outputs[] = {&s.p50, &s.p90, &s.p99, &s.p999};
+    uint64_t seen = 0;
+    size_t q = 0;
+    for (size_t i = 0; i < BUCKETS && q < 4; ++i)
+    {
+        seen += snapshot[i];
+        while (q < 4 && seen >= static_cast<uint64_t>(quantiles[q] * count + 0.5) && seen > 0)
+        {
+            // 桶上界不超过实际最大值
+            int64_t v = valueOf(i);
+            *outputs[q++] = v < maxNs ? v : maxNs;
+        }
+    }
+    return s;
+}
+
+string LatencyHistogram::format(const char* name, const Summary& s)
+{
+    char buf[256];
+    snprintf(buf, sizeof(buf), "%s count=%llu p50=%.1fus p90=%.1fus p99=%.1fus p999=%.1fus max=%.1fus mean=%.1fus",
+             name, (unsigned long long)s.count, s.p50 / 1e3, s.p90 / 1e3, s.p99 / 1e3, s.p999 / 1e3,
+             s.max / 1e3, s.mean / 1e3);
+    return buf;
+}
+
+string LatencyHistogram::toCsv(const char* name, const Summary& s)
+{
+    char buf[256];
+    snprintf(buf, sizeof(buf), "%s,%llu,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f", name, (unsigned long long)s.count,
+             s.p50 / 1e3, s.p90 / 1e3, s.p99 / 1e3, s.p999 / 1e3, s.max / 1e3, s.mean / 1e3);
+    return buf;
+}
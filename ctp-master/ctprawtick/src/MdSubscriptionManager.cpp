@@ -0,0 +1,365 @@
+#include <cstring>
+#include <algorithm>
+#include "zlog.h"
+#include "MdSubscriptionManager.h"
+
+using namespace std;
+
+// external global variable
+extern zlog_category_t *cat;
+
+static_assert(sizeof(TThostFtdcInstrumentIDType) <= MdSubscriptionManager::kIdWidth,
+              "instrument id slot too small");
+
+MdSubscriptionManager::MdSubscriptionManager(size_t capacity_, int batchSize_, int maxRequestsPerSecond_)
+    : capacity(capacity_),
+      count(0),
+      ids(new char[capacity_ * kIdWidth]()),
+      states(capacity_, SLOT_IDLE),
+      wanted(capacity_, 0),
+      retries(capacity_, 0),
+      deadlines(capacity_),
+      batchSize(100),
+      maxRequestsPerSecond(5),
+      windowStart(Clock::now()),
+      windowRequests(0),
+      backoffUntil(Clock::now()),
+      loggedIn(false)
+{
+    index.reserve(capacity_);
+    setPacing(batchSize_, maxRequestsPerSecond_);
+}
+
+void MdSubscriptionManager::setPacing(int batchSize_, int maxRequestsPerSecond_)
+{
+    lock_guard<mutex> lock(mtx);
+    batchSize = batchSize_ > 0 ? batchSize_ : 100;
+    maxRequestsPerSecond = maxRequestsPerSecond_ > 0 ? maxRequestsPerSecond_ : 5;
+    batchPtrs.assign(batchSize, nullptr);
+    batchSlots.assign(batchSize, 0);
+}
+
+size_t MdSubscriptionManager::add(const vector<string>& instruments)
+{
+    lock_guard<mutex> lock(mtx);
+    size_t added = 0;
+    for (auto& inst: instruments)
+    {
+        if (inst.empty())
+        {
+            continue;
+        }
+        if (inst.size() >= kIdWidth)
+        {
+            zlog_error(cat, "[MdSubscriptionManager::add] 合约代码过长，忽略: %s", inst.c_str());
+            continue;
+        }
+
+        auto it = index.find(inst);
+        if (it != index.end())
+        {
+            uint32_t idx = it->second;
+            if (!wanted[idx])
+            {
+                wanted[idx] = 1;
+                if (states[idx] == SLOT_IDLE || states[idx] == SLOT_FAILED)
+                {
+                    states[idx] = SLOT_PENDING;
+                    retries[idx] = 0;
+                    deadlines[idx] = Clock::now();
+                }
+                ++added;
+            }
+            continue;
+        }
+
+        if (count >= capacity)
+        {
+            zlog_error(cat, "[MdSubscriptionManager::add] 订阅表已满(%zu)，忽略: %s", capacity, inst.c_str());
+            continue;
+        }
+
+        char* slot = ids.get() + count * kIdWidth;
+        memcpy(slot, inst.c_str(), inst.size() + 1);
+        states[count] = SLOT_PENDING;
+        wanted[count] = 1;
+        index.emplace(string_view(slot, inst.size()), static_cast<uint32_t>(count));
+        ++count;
+        ++added;
+    }
+    return added;
+}
+
+size_t MdSubscriptionManager::remove(const vector<string>& instruments)
+{
+    lock_guard<mutex> lock(mtx);
+    size_t removed = 0;
+    for (auto& inst: instruments)
+    {
+        auto it = index.find(inst);
+        if (it == index.end() || !wanted[it->second])
+        {
+            continue;
+        }
+        uint32_t idx = it->second;
+        wanted[idx] = 0;
+        // 还未发出的订阅直接取消，已订阅的等待pump发送退订
+        if (states[idx] == SLOT_PENDING || states[idx] == SLOT_FAILED)
+        {
+            states[idx] = SLOT_IDLE;
+        }
+        ++removed;
+    }
+    return removed;
+}
+
+void MdSubscriptionManager::onLogin()
+{
+    lock_guard<mutex> lock(mtx);
+    loggedIn = true;
+    windowRequests = 0;
+    backoffUntil = Clock::now();
+    for (size_t i = 0; i < count; ++i)
+    {
+        states[i] = wanted[i] ? SLOT_PENDING : SLOT_IDLE;
+        retries[i] = 0;
+        deadlines[i] = backoffUntil;
+    }
+}
+
+void MdSubscriptionManager::onDisconnected()
+{
+    lock_guard<mutex> lock(mtx);
+    loggedIn = false;
+    Clock::time_point now = Clock::now();
+    for (size_t i = 0; i < count; ++i)
+    {
+        states[i] = wanted[i] ? SLOT_PENDING : SLOT_IDLE;
+        retries[i] = 0;
+        deadlines[i] = now;
+    }
+}
+
+int MdSubscriptionManager::findSlot(const char* instrumentID) const
+{
+    if (!instrumentID || !instrumentID[0])
+    {
+        return -1;
+    }
+    auto it = index.find(string_view(instrumentID, strnlen(instrumentID, kIdWidth)));
+    return it == index.end() ? -1 : static_cast<int>(it->second);
+}
+
+void MdSubscriptionManager::onSubAck(const char* instrumentID, int errorID)
+{
+    lock_guard<mutex> lock(mtx);
+    int idx = findSlot(instrumentID);
+    if (idx < 0)
+    {
+        return;
+    }
+    // 回报到达前已被移除的合约同样记为已订阅，交给pump退订
+    states[idx] = errorID != 0 ? SLOT_FAILED : SLOT_SUBSCRIBED;
+    retries[idx] = 0;
+    deadlines[idx] = Clock::now();
+}
+
+void MdSubscriptionManager::onUnSubAck(const char* instrumentID, int errorID)
+{
+    lock_guard<mutex> lock(mtx);
+    int idx = findSlot(instrumentID);
+    if (idx < 0)
+    {
+        return;
+    }
+    if (errorID != 0)
+    {
+        // 退订失败按仍在订阅处理，退避后重试，超过次数放弃
+        zlog_error(cat, "[MdSubscriptionManager::onUnSubAck] 退订出错 [%d]: %s", errorID, instrumentID);
+        retryLater(idx, SLOT_SUBSCRIBED, Clock::now());
+        return;
+    }
+    states[idx] = wanted[idx] ? SLOT_PENDING : SLOT_IDLE;
+    retries[idx] = 0;
+    deadlines[idx] = Clock::now();
+}
+
+void MdSubscriptionManager::retryLater(size_t idx, uint8_t state, Clock::time_point now)
+{
+    if (++retries[idx] > kMaxRetries)
+    {
+        zlog_error(cat, "[MdSubscriptionManager::retryLater] %s 重试%d次仍未成功，放弃",
+                   slotId(idx), kMaxRetries);
+        states[idx] = SLOT_FAILED;
+        return;
+    }
+    states[idx] = state;
+    deadlines[idx] = now + chrono::seconds(1 << (retries[idx] - 1));
+}
+
+size_t MdSubscriptionManager::expireAcks(Clock::time_point now)
+{
+    size_t expired = 0;
+    size_t unacked = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (states[i] != SLOT_SENT && states[i] != SLOT_UNSUB_SENT)
+        {
+            continue;
+        }
+        if (now < deadlines[i])
+        {
+            ++unacked;
+            continue;
+        }
+        // 订阅请求超时时合约已被移除的，直接回到未订阅
+        if (states[i] == SLOT_SENT && !wanted[i])
+        {
+            states[i] = SLOT_IDLE;
+            continue;
+        }
+        retryLater(i, states[i] == SLOT_SENT ? SLOT_PENDING : SLOT_SUBSCRIBED, now);
+        ++expired;
+    }
+    if (expired > 0)
+    {
+        zlog_error(cat, "[MdSubscriptionManager::expireAcks] %zu 个合约%d秒内未收到回报，稍后重发",
+                   expired, kAckTimeoutSeconds);
+    }
+    return unacked;
+}
+
+bool MdSubscriptionManager::acquireToken(Clock::time_point now)
+{
+    if (now - windowStart >= chrono::seconds(1))
+    {
+        windowStart = now;
+        windowRequests = 0;
+    }
+    if (windowRequests >= maxRequestsPerSecond)
+    {
+        return false;
+    }
+    ++windowRequests;
+    return true;
+}
+
+int MdSubscriptionManager::sendBatch(CThostFtdcMdApi* api, bool subscribe, int n, Clock::time_point now)
+{
+    int ret = subscribe ? api->SubscribeMarketData(batchPtrs.data(), n)
+                        : api->UnSubscribeMarketData(batchPtrs.data(), n);
+    if (ret == 0)
+    {
+        uint8_t next = subscribe ? SLOT_SENT : SLOT_UNSUB_SENT;
+        Clock::time_point deadline = now + chrono::seconds(kAckTimeoutSeconds);
+        for (int i = 0; i < n; ++i)
+        {
+            states[batchSlots[i]] = next;
+            deadlines[batchSlots[i]] = deadline;
+        }
+    }
+    return ret;
+}
+
+int MdSubscriptionManager::pump(CThostFtdcMdApi* api)
+{
+    if (!api)
+    {
+        return 0;
+    }
+
+    lock_guard<mutex> lock(mtx);
+    Clock::time_point now = Clock::now();
+    if (!loggedIn || now < backoffUntil)
+    {
+        return 0;
+    }
+
+    // 上一批的回报还没收齐，等OnRspSubMarketData的最后一条回报再发
+    if (expireAcks(now) > 0)
+    {
+        return 0;
+    }
+
+    // 先处理退订，再处理订阅；每次只发一批，回报收齐后由下一次pump继续
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        bool subscribe = (pass == 1);
+        int n = 0;
+        for (size_t i = 0; i < count && n < batchSize; ++i)
+        {
+            bool hit = subscribe ? (wanted[i] && states[i] == SLOT_PENDING)
+                                 : (!wanted[i] && states[i] == SLOT_SUBSCRIBED);
+            // 退避中的合约留到下次
+            if (hit && now >= deadlines[i])
+            {
+                batchPtrs[n] = ids.get() + i * kIdWidth;
+                batchSlots[n] = static_cast<uint32_t>(i);
+                ++n;
+            }
+        }
+        if (n == 0)
+        {
+            continue;
+        }
+        if (!acquireToken(now))
+        {
+            // 本秒配额已用完，等待下一次pump
+            return 0;
+        }
+
+        int ret = sendBatch(api, subscribe, n, now);
+        switch (ret)
+        {
+        case 0:
+            zlog_info(cat, "[MdSubscriptionManager::pump] %s请求成功，本批 %d 个合约",
+                      subscribe ? "订阅" : "退订", n);
+            return 1;
+        case -1:
+            zlog_error(cat, "[MdSubscriptionManager::pump] 网络连接失败 [-1]，等待重连后重发");
+            return 0;
+        case -2:
+        case -3:
+            zlog_error(cat, "[MdSubscriptionManager::pump] 请求超限 [%d]，1秒后重试", ret);
+            backoffUntil = now + chrono::seconds(1);
+            return 0;
+        default:
+            zlog_error(cat, "[MdSubscriptionManager::pump] 未知错误码: %d", ret);
+            backoffUntil = now + chrono::seconds(1);
+            return 0;
+        }
+    }
+    return 0;
+}
+
+size_t MdSubscriptionManager::size() const
+{
+    lock_guard<mutex> lock(mtx);
+    return count;
+}
+
+size_t MdSubscriptionManager::subscribedCount() const
+{
+    lock_guard<mutex> lock(mtx);
+    return std::count(states.begin(), states.begin() + count, static_cast<uint8_t>(SLOT_SUBSCRIBED));
+}
+
+size_t MdSubscriptionManager::pendingCount() const
+{
+    lock_guard<mutex> lock(mtx);
+    size_t n = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (wanted[i] && (states[i] == SLOT_PENDING || states[i] == SLOT_SENT))
+        {
+            ++n;
+        }
+    }
+    return n;
+}
+
+size_t MdSubscriptionManager::failedCount() const
+{
+    lock_guard<mutex> lock(mtx);
+    return std::count(states.begin(), states.begin() + count, static_cast<uint8_t>(SLOT_FAILED));
+}
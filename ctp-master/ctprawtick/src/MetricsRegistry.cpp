@@ -0,0 +1,380 @@
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <cmath>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "MetricsRegistry.h"
+#include "ThreadTuning.h"
+
+using namespace std;
+
+MetricHistogram::MetricHistogram(const vector<double>& bounds)
+    : upper(bounds), buckets(new atomic<uint64_t>[bounds.size() + 1]), total(0.0)
+{
+    for (size_t i = 0; i <= upper.size(); ++i)
+    {
+        buckets[i].store(0, memory_order_relaxed);
+    }
+}
+
+void MetricHistogram::observe(double value)
+{
+    // 桶数一般不超过20个，顺序查找比二分更快
+    size_t i = 0;
+    while (i < upper.size() && value > upper[i])
+    {
+        ++i;
+    }
+    buckets[i].fetch_add(1, memory_order_relaxed);
+
+    double cur = total.load(memory_order_relaxed);
+    while (!total.compare_exchange_weak(cur, cur + value, memory_order_relaxed))
+    {
+    }
+}
+
+vector<uint64_t> MetricHistogram::counts() const
+{
+    vector<uint64_t> out(upper.size() + 1);
+    for (size_t i = 0; i < out.size(); ++i)
+    {
+        out[i] = buckets[i].load(memory_order_relaxed);
+    }
+    return out;
+}
+
+vector<double> MetricHistogram::exponential(double start, double factor, int count)
+{
+    vector<double> bounds;
+    double v = start;
+    for (int i = 0; i < count; ++i)
+    {
+        bounds.push_back(v);
+        v *= factor;
+    }
+    return bounds;
+}
+
+MetricsRegistry::Entry& MetricsRegistry::add(const string& name, const string& help, const string& labels, Type type)
+{
+    lock_guard<mutex> guard(lock);
+    entries.emplace_back();
+    Entry& e = entries.back();
+    e.name = name;
+    e.help = help;
+    e.labels = labels;
+    e.type = type;
+    return e;
+}
+
+MetricCounter& MetricsRegistry::counter(const string& name, const string& help, const string& labels)
+{
+    Entry& e = add(name, help, labels, COUNTER);
+    e.counter.reset(new MetricCounter());
+    return *e.counter;
+}
+
+MetricGauge& MetricsRegistry::gauge(const string& name, const string& help, const string& labels)
+{
+    Entry& e = add(name, help, labels, GAUGE);
+    e.gauge.reset(new MetricGauge());
+    return *e.gauge;
+}
+
+MetricHistogram& MetricsRegistry::histogram(const string& name, const string& help, const vector<double>& bounds,
+                                            const string& labels)
+{
+    Entry& e = add(name, help, labels, HISTOGRAM);
+    e.histogram.reset(new MetricHistogram(bounds));
+    return *e.histogram;
+}
+
+void MetricsRegistry::counterFn(const string& name, const string& help, ValueFn fn, const string& labels)
+{
+    add(name, help, labels, COUNTER).fn = fn;
+}
+
+void MetricsRegistry::gaugeFn(const string& name, const string& help, ValueFn fn, const string& labels)
+{
+    add(name, help, labels, GAUGE).fn = fn;
+}
+
+// 数值按Prometheus的写法输出，整数不带小数点
+static void appendValue(string& out, double v)
+{
+    char buf[64];
+    if (std::isinf(v))
+    {
+        snprintf(buf, sizeof(buf), "%s", v > 0 ? "+Inf" : "-Inf");
+    }
+    else if (v == static_cast<double>(static_cast<int64_t>(v)) && fabs(v) < 1e15)
+    {
+        snprintf(buf, sizeof(buf), "%lld", static_cast<long long>(v));
+    }
+    else
+    {
+        snprintf(buf, sizeof(buf), "%.9g", v);
+    }
+    out += buf;
+}
+
+static void appendSample(string& out, const string& name, const string& labels, const string& extra, double v)
+{
+    out += name;
+    if (!labels.empty() || !extra.empty())
+    {
+        out += '{';
+        out += labels;
+        if (!labels.empty() && !extra.empty())
+        {
+            out += ',';
+        }
+        out += extra;
+        out += '}';
+    }
+    out += ' ';
+    appendValue(out, v);
+    out += '\n';
+}
+
+string MetricsRegistry::render() const
+{
+    static const char* typeNames[] = {"counter", "gauge", "histogram"};
+
+    lock_guard<mutex> guard(lock);
+    string out;
+    out.reserve(entries.size() * 128);
+    vector<bool> done(entries.size(), false);
+
+    // 同名指标按首次注册的顺序聚在一起输出
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        if (done[i])
+        {
+            continue;
+        }
+        const Entry& head = entries[i];
+        out += "# HELP " + head.name + " " + head.help + "\n";
+        out += "# TYPE " + head.name + " " + typeNames[head.type] + "\n";
+
+        for (size_t j = i; j < entries.size(); ++j)
+        {
+            const Entry& e = entries[j];
+            if (done[j] || e.name != head.name)
+            {
+                continue;
+            }
+            done[j] = true;
+
+            if (e.fn)
+            {
+                appendSample(out, e.name, e.labels, "", e.fn());
+            }
+            else if (e.counter)
+            {
+                appendSample(out, e.name, e.labels, "", static_cast<double>(e.counter->value()));
+            }
+            else if (e.gauge)
+            {
+                appendSample(out, e.name, e.labels, "", static_cast<double>(e.gauge->value()));
+            }
+            else if (e.histogram)
+            {
+                const vector<double>& bounds = e.histogram->bounds();
+                vector<uint64_t> counts = e.histogram->counts();
+                uint64_t cumulative = 0;
+                for (size_t b = 0; b < counts.size(); ++b)
+                {
+                    cumulative += counts[b];
+                    string le = "le=\"";
+                    if (b < bounds.size())
+                    {
+                        appendValue(le, bounds[b]);
+                    }
+                    else
+                    {
+                        le += "+Inf";
+                    }
+                    le += "\"";
+                    appendSample(out, e.name + "_bucket", e.labels, le, static_cast<double>(cumulative));
+                }
+                appendSample(out, e.name + "_sum", e.labels, "", e.histogram->sum());
+                appendSample(out, e.name + "_count", e.labels, "", static_cast<double>(cumulative));
+            }
+        }
+    }
+    return out;
+}
+
+MetricsHttpServer::MetricsHttpServer(const MetricsRegistry& registry)
+    : registry(registry), listenFd(-1), running(false), served(0)
+{
+}
+
+MetricsHttpServer::~MetricsHttpServer()
+{
+    stop();
+}
+
+bool MetricsHttpServer::start(const string& bindAddr, int port)
+{
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd < 0)
+    {
+        error = string("socket: ") + strerror(errno);
+        return false;
+    }
+    int on = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    if (bindAddr.empty() || bindAddr == "*")
+    {
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    }
+    else if (inet_pton(AF_INET, bindAddr.c_str(), &addr.sin_addr) != 1)
+    {
+        error = "invalid bind address: " + bindAddr;
+        close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+
+    if (::bind(listenFd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) != 0 || listen(listenFd, 16) != 0)
+    {
+        error = string("bind/listen: ") + strerror(errno);
+        close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+
+    running = true;
+    worker = thread(&MetricsHttpServer::run, this);
+    return true;
+}
+
+void MetricsHttpServer::stop()
+{
+    running = false;
+    if (worker.joinable())
+    {
+        worker.join();
+    }
+    if (listenFd >= 0)
+    {
+        close(listenFd);
+        listenFd = -1;
+    }
+}
+
+void MetricsHttpServer::run()
+{
+    // 设置失败不影响导出
+    string tuneError;
+    ThreadTuning::global().apply("metrics_http", "metrics_http", tuneError);
+
+    while (running)
+    {
+        // 定时醒来检查退出标志
+        struct pollfd pfd;
+        pfd.fd = listenFd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        if (poll(&pfd, 1, 200) <= 0)
+        {
+            continue;
+        }
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0)
+        {
+            continue;
+        }
+        handle(fd);
+        close(fd);
+    }
+}
+
+// 等待fd可读/可写，到截止时间仍未就绪返回0
+int MetricsHttpServer::waitReady(int fd, short events, const chrono::steady_clock::time_point& deadline)
+{
+    auto left = chrono::duration_cast<chrono::milliseconds>(deadline - chrono::steady_clock::now()).count();
+    if (left <= 0)
+    {
+        return 0;
+    }
+    struct pollfd pfd;
+    pfd.fd = fd;
+    pfd.events = events;
+    pfd.revents = 0;
+    return poll(&pfd, 1, static_cast<int>(left));
+}
+
+void MetricsHttpServer::handle(int fd)
+{
+    // 整个连接共用一个截止时间，按字节慢慢收发的客户端也只能占用服务线程kClientTimeoutMs
+    const auto deadline = chrono::steady_clock::now() + chrono::milliseconds(kClientTimeoutMs);
+
+    // 只需要请求行，读到第一个换行或超时为止
+    char buf[1024];
+    size_t len = 0;
+    while (len < sizeof(buf) - 1 && memchr(buf, '\n', len) == nullptr)
+    {
+        if (waitReady(fd, POLLIN, deadline) <= 0)
+        {
+            return;
+        }
+        ssize_t n = recv(fd, buf + len, sizeof(buf) - 1 - len, MSG_DONTWAIT);
+        if (n <= 0)
+        {
+            return;
+        }
+        len += static_cast<size_t>(n);
+    }
+    buf[len] = '\0';
+
+    string status;
+    string body;
+    string contentType = "text/plain; charset=utf-8";
+    if (strncmp(buf, "GET /metrics ", 13) == 0 || strncmp(buf, "GET /metrics?", 13) == 0)
+    {
+        status = "200 OK";
+        body = registry.render();
+        contentType = "text/plain; version=0.0.4; charset=utf-8";
+        served.fetch_add(1, memory_order_relaxed);
+    }
+    else
+    {
+        status = "404 Not Found";
+        body = "not found\n";
+    }
+
+    string response = "HTTP/1.1 " + status + "\r\nContent-Type: " + contentType
+                    + "\r\nContent-Length: " + to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+    const char* p = response.data();
+    size_t left = response.size();
+    while (left > 0)
+    {
+        if (waitReady(fd, POLLOUT, deadline) <= 0)
+        {
+            return;
+        }
+        ssize_t n = send(fd, p, left, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            return;
+        }
+        p += n;
+        left -= static_cast<size_t>(n);
+    }
+}
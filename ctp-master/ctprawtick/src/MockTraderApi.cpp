@@ -0,0 +1,498 @@
+#include <cstring>
+#include <cstdlib>
+#include <ctime>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include "zlog.h"
+#include "MockTraderApi.h"
+
+using namespace std;
+
+// external global variable
+extern zlog_category_t *cat;
+
+static int64_t steadyMs()
+{
+    return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static vector<string> splitCsv(const string& line)
+{
+    vector<string> cols;
+    stringstream ss(line);
+    string col;
+    while (getline(ss, col, ','))
+    {
+        cols.push_back(col);
+    }
+    return cols;
+}
+
+/// 读取fixture文件，跳过空行与#开头的行，列数不足的行丢弃
+static vector<vector<string>> readFixture(const string& path, size_t minCols)
+{
+    vector<vector<string>> rows;
+    ifstream in(path);
+    string line;
+    while (getline(in, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+        vector<string> cols = splitCsv(line);
+        if (cols.size() < minCols)
+        {
+            zlog_warn(cat, "[MockTraderApi] fixture %s 列数不足，跳过: %s", path.c_str(), line.c_str());
+            continue;
+        }
+        rows.push_back(cols);
+    }
+    return rows;
+}
+
+template<size_t N>
+static void copyField(char (&dst)[N], const string& src)
+{
+    strncpy(dst, src.c_str(), N - 1);
+    dst[N - 1] = '\0';
+}
+
+MockTraderApi::MockTraderApi(const MockTraderOptions& options_)
+    : options(options_), spi(nullptr), running(false), inflight(0), rejectCount(0)
+{
+    time_t now = time(nullptr);
+    struct tm local;
+    localtime_r(&now, &local);
+    strftime(tradingDay, sizeof(tradingDay), "%Y%m%d", &local);
+
+    memset(&account, 0, sizeof(account));
+    loadFixtures();
+}
+
+MockTraderApi::~MockTraderApi()
+{
+}
+
+void MockTraderApi::Release()
+{
+    {
+        lock_guard<mutex> guard(lock);
+        running = false;
+    }
+    cond.notify_all();
+    if (worker.joinable())
+    {
+        worker.join();
+    }
+    zlog_info(cat, "[MockTraderApi::Release] 流控拒绝 %llu 次", (unsigned long long)rejectCount.load());
+    delete this;
+}
+
+void MockTraderApi::Init()
+{
+    if (!spi)
+    {
+        zlog_error(cat, "[MockTraderApi::Init] 未注册SPI");
+        return;
+    }
+    zlog_info(cat, "[MockTraderApi::Init] 模拟交易前置: 合约 %zu 个, 持仓 %zu 条, 延迟 %d ms, 每页 %d 条, 查询 %d 次/秒",
+              instruments.size(), positions.size(), options.latencyMs, options.pageSize, options.queryPerSec);
+    running = true;
+    worker = thread(&MockTraderApi::run, this);
+}
+
+int MockTraderApi::Join()
+{
+    if (worker.joinable())
+    {
+        worker.join();
+    }
+    return 0;
+}
+
+int MockTraderApi::ReqAuthenticate(CThostFtdcReqAuthenticateField *pReqAuthenticateField, int nRequestID)
+{
+    return post(Request::AUTHENTICATE, nRequestID);
+}
+
+int MockTraderApi::ReqUserLogin(CThostFtdcReqUserLoginField *pReqUserLoginField, int nRequestID)
+{
+    return post(Request::LOGIN, nRequestID);
+}
+
+int MockTraderApi::ReqSettlementInfoConfirm(CThostFtdcSettlementInfoConfirmField *pSettlementInfoConfirm, int nRequestID)
+{
+    return post(Request::SETTLEMENT_CONFIRM, nRequestID);
+}
+
+int MockTraderApi::ReqQryInstrument(CThostFtdcQryInstrumentField *pQryInstrument, int nRequestID)
+{
+    return postQuery(Request::QRY_INSTRUMENT, nRequestID, pQryInstrument ? pQryInstrument->InstrumentID : "");
+}
+
+int MockTraderApi::ReqQryInvestorPosition(CThostFtdcQryInvestorPositionField *pQryInvestorPosition, int nRequestID)
+{
+    return postQuery(Request::QRY_POSITION, nRequestID, pQryInvestorPosition ? pQryInvestorPosition->InstrumentID : "");
+}
+
+int MockTraderApi::ReqQryTradingAccount(CThostFtdcQryTradingAccountField *pQryTradingAccount, int nRequestID)
+{
+    return postQuery(Request::QRY_ACCOUNT, nRequestID, "");
+}
+
+int MockTraderApi::post(Request::Type type, int requestID)
+{
+    {
+        lock_guard<mutex> guard(lock);
+        requests.push_back(Request{type, requestID, string()});
+    }
+    cond.notify_one();
+    return 0;
+}
+
+int MockTraderApi::postQuery(Request::Type type, int requestID, const char* instrumentID)
+{
+    {
+        lock_guard<mutex> guard(lock);
+        // 与CTP相同：先检查在途请求数(-2)，再检查每秒请求数(-3)
+        if (options.maxInflight > 0 && inflight >= options.maxInflight)
+        {
+            ++rejectCount;
+            return -2;
+        }
+        int64_t now = steadyMs();
+        while (!querySent.empty() && now - querySent.front() >= 1000)
+        {
+            querySent.pop_front();
+        }
+        if (options.queryPerSec > 0 && querySent.size() >= static_cast<size_t>(options.queryPerSec))
+        {
+            ++rejectCount;
+            return -3;
+        }
+        querySent.push_back(now);
+        ++inflight;
+        requests.push_back(Request{type, requestID, instrumentID ? string(instrumentID) : string()});
+    }
+    cond.notify_one();
+    return 0;
+}
+
+bool MockTraderApi::delay(int ms)
+{
+    if (ms <= 0)
+    {
+        return running;
+    }
+    unique_lock<mutex> guard(lock);
+    cond.wait_for(guard, chrono::milliseconds(ms), [this] { return !running; });
+    return running;
+}
+
+void MockTraderApi::run()
+{
+    if (delay(options.latencyMs))
+    {
+        spi->OnFrontConnected();
+    }
+
+    for (;;)
+    {
+        Request req;
+        {
+            unique_lock<mutex> guard(lock);
+            cond.wait(guard, [this] { return !running || !requests.empty(); });
+            if (!running)
+            {
+                break;
+            }
+            req = requests.front();
+            requests.pop_front();
+        }
+
+        if (!delay(options.latencyMs))
+        {
+            break;
+        }
+        process(req);
+    }
+}
+
+void MockTraderApi::finishQuery()
+{
+    lock_guard<mutex> guard(lock);
+    --inflight;
+}
+
+template<typename Field, typename Callback>
+void MockTraderApi::respondPages(const vector<Field>& rows, const string& filter, int requestID, Callback callback)
+{
+    vector<const Field*> matched;
+    for (auto& row: rows)
+    {
+        if (filter.empty() || filter == row.InstrumentID)
+        {
+            matched.push_back(&row);
+        }
+    }
+
+    if (matched.empty())
+    {
+        finishQuery();
+        callback(nullptr, requestID, true);
+        return;
+    }
+
+    int pageSize = options.pageSize > 0 ? options.pageSize : static_cast<int>(matched.size());
+    for (size_t i = 0; i < matched.size(); ++i)
+    {
+        if (i > 0 && i % pageSize == 0 && !delay(options.pageGapMs))
+        {
+            return;
+        }
+        // 回调参数为非const指针，传副本
+        Field field = *matched[i];
+        bool isLast = (i + 1 == matched.size());
+        if (isLast)
+        {
+            // 与CTP相同，最后一条回报到达时在途请求已经释放，回调中可以立即发下一个查询
+            finishQuery();
+        }
+        callback(&field, requestID, isLast);
+    }
+}
+
+void MockTraderApi::process(const Request& req)
+{
+    CThostFtdcRspInfoField info;
+    memset(&info, 0, sizeof(info));
+
+    switch (req.type)
+    {
+    case Request::AUTHENTICATE:
+    {
+        CThostFtdcRspAuthenticateField rsp;
+        memset(&rsp, 0, sizeof(rsp));
+        spi->OnRspAuthenticate(&rsp, &info, req.requestID, true);
+        break;
+    }
+    case Request::LOGIN:
+    {
+        CThostFtdcRspUserLoginField rsp;
+        memset(&rsp, 0, sizeof(rsp));
+        copyField(rsp.TradingDay, tradingDay);
+        copyField(rsp.SystemName, "MockTraderApi");
+        spi->OnRspUserLogin(&rsp, &info, req.requestID, true);
+        break;
+    }
+    case Request::SETTLEMENT_CONFIRM:
+    {
+        CThostFtdcSettlementInfoConfirmField rsp;
+        memset(&rsp, 0, sizeof(rsp));
+        spi->OnRspSettlementInfoConfirm(&rsp, &info, req.requestID, true);
+        break;
+    }
+    case Request::QRY_INSTRUMENT:
+        respondPages(instruments, req.instrumentID, req.requestID,
+                     [this, &info](CThostFtdcInstrumentField* field, int requestID, bool isLast) {
+                         spi->OnRspQryInstrument(field, &info, requestID, isLast);
+                     });
+        break;
+    case Request::QRY_POSITION:
+        respondPages(positions, req.instrumentID, req.requestID,
+                     [this, &info](CThostFtdcInvestorPositionField* field, int requestID, bool isLast) {
+                         spi->OnRspQryInvestorPosition(field, &info, requestID, isLast);
+                     });
+        break;
+    case Request::QRY_ACCOUNT:
+    {
+        CThostFtdcTradingAccountField rsp = account;
+        finishQuery();
+        spi->OnRspQryTradingAccount(&rsp, &info, req.requestID, true);
+        break;
+    }
+    }
+}
+
+void MockTraderApi::loadFixtures()
+{
+    if (!options.fixtureDir.empty())
+    {
+        for (auto& cols: readFixture(options.fixtureDir + "/instruments.csv", 10))
+        {
+            CThostFtdcInstrumentField f;
+            memset(&f, 0, sizeof(f));
+            copyField(f.InstrumentID, cols[0]);
+            copyField(f.ExchangeID, cols[1]);
+            copyField(f.ProductID, cols[2]);
+            copyField(f.InstrumentName, cols[0]);
+            copyField(f.ExchangeInstID, cols[0]);
+            f.ProductClass = THOST_FTDC_PC_Futures;
+            f.DeliveryYear = atoi(cols[3].c_str());
+            f.DeliveryMonth = atoi(cols[4].c_str());
+            f.VolumeMultiple = atoi(cols[5].c_str());
+            f.PriceTick = atof(cols[6].c_str());
+            copyField(f.ExpireDate, cols[7]);
+            f.LongMarginRatio = atof(cols[8].c_str());
+            f.ShortMarginRatio = atof(cols[9].c_str());
+            f.IsTrading = 1;
+            f.InstLifePhase = THOST_FTDC_IP_Started;
+            f.MaxLimitOrderVolume = 1000;
+            f.MinLimitOrderVolume = 1;
+            instruments.push_back(f);
+        }
+
+        for (auto& cols: readFixture(options.fixtureDir + "/positions.csv", 11))
+        {
+            CThostFtdcInvestorPositionField f;
+            memset(&f, 0, sizeof(f));
+            copyField(f.InstrumentID, cols[0]);
+            copyField(f.ExchangeID, cols[1]);
+            copyField(f.TradingDay, tradingDay);
+            f.PosiDirection = cols[2].empty() ? THOST_FTDC_PD_Long : cols[2][0];
+            f.HedgeFlag = THOST_FTDC_HF_Speculation;
+            f.PositionDate = THOST_FTDC_PSD_Today;
+            f.Position = atoi(cols[3].c_str());
+            f.YdPosition = atoi(cols[4].c_str());
+            f.TodayPosition = atoi(cols[5].c_str());
+            f.PositionCost = atof(cols[6].c_str());
+            f.OpenCost = atof(cols[7].c_str());
+            f.UseMargin = atof(cols[8].c_str());
+            f.PositionProfit = atof(cols[9].c_str());
+            f.CloseProfit = atof(cols[10].c_str());
+            positions.push_back(f);
+        }
+
+        vector<vector<string>> rows = readFixture(options.fixtureDir + "/account.csv", 11);
+        if (!rows.empty())
+        {
+            auto& cols = rows[0];
+            copyField(account.AccountID, cols[0]);
+            account.PreBalance = atof(cols[1].c_str());
+            account.Balance = atof(cols[2].c_str());
+            account.Available = atof(cols[3].c_str());
+            account.CurrMargin = atof(cols[4].c_str());
+            account.FrozenMargin = atof(cols[5].c_str());
+            account.CloseProfit = atof(cols[6].c_str());
+            account.PositionProfit = atof(cols[7].c_str());
+            account.Commission = atof(cols[8].c_str());
+            account.Deposit = atof(cols[9].c_str());
+            account.Withdraw = atof(cols[10].c_str());
+        }
+    }
+
+    if (instruments.empty())
+    {
+        buildSynthetic();
+    }
+    copyField(account.TradingDay, tradingDay);
+    copyField(account.CurrencyID, "CNY");
+}
+
+void MockTraderApi::buildSynthetic()
+{
+    struct ProductDef
+    {
+        const char* product;
+        const char* exchange;
+        int         multiple;
+        double      tick;
+        double      price;
+    };
+    static const ProductDef kProducts[] = {
+        {"cu", "SHFE", 5, 10, 70000}, {"al", "SHFE", 5, 5, 19000}, {"zn", "SHFE", 5, 5, 22000},
+        {"au", "SHFE", 1000, 0.02, 560}, {"ag", "SHFE", 15, 1, 7500}, {"rb", "SHFE", 10, 1, 3100},
+        {"hc", "SHFE", 10, 1, 3300}, {"sc", "INE", 1000, 0.1, 520}, {"i", "DCE", 100, 0.5, 780},
+        {"m", "DCE", 10, 1, 2900}, {"y", "DCE", 10, 2, 7600}, {"p", "DCE", 10, 2, 8500},
+        {"TA", "CZCE", 5, 2, 4800}, {"MA", "CZCE", 10, 1, 2400}, {"SR", "CZCE", 10, 1, 5800},
+        {"CF", "CZCE", 5, 5, 13500}, {"si", "GFEX", 5, 5, 9000}, {"IF", "CFFEX", 300, 0.2, 3800}
+    };
+    const size_t productCount = sizeof(kProducts) / sizeof(kProducts[0]);
+
+    int year = atoi(tradingDay) / 10000;
+    int month = atoi(tradingDay) / 100 % 100;
+    size_t target = options.syntheticInstruments > 0 ? options.syntheticInstruments : 0;
+    bool withPositions = positions.empty();
+
+    // 每个品种从当月起逐月生成合约，数量不够时继续生成更远月份
+    for (int ahead = 0; instruments.size() < target; ++ahead)
+    {
+        int y = year + (month - 1 + ahead) / 12;
+        int mon = (month - 1 + ahead) % 12 + 1;
+        for (size_t p = 0; p < productCount && instruments.size() < target; ++p)
+        {
+            const ProductDef& def = kProducts[p];
+            char id[32];
+            // 郑商所合约代码年份只有一位
+            if (strcmp(def.exchange, "CZCE") == 0)
+            {
+                snprintf(id, sizeof(id), "%s%d%02d", def.product, y % 10, mon);
+            }
+            else
+            {
+                snprintf(id, sizeof(id), "%s%02d%02d", def.product, y % 100, mon);
+            }
+            char expire[16];
+            snprintf(expire, sizeof(expire), "%04d%02d15", y, mon);
+
+            CThostFtdcInstrumentField f;
+            memset(&f, 0, sizeof(f));
+            copyField(f.InstrumentID, id);
+            copyField(f.ExchangeID, def.exchange);
+            copyField(f.ProductID, def.product);
+            copyField(f.InstrumentName, id);
+            copyField(f.ExchangeInstID, id);
+            copyField(f.ExpireDate, expire);
+            f.ProductClass = THOST_FTDC_PC_Futures;
+            f.DeliveryYear = y;
+            f.DeliveryMonth = mon;
+            f.VolumeMultiple = def.multiple;
+            f.PriceTick = def.tick;
+            f.LongMarginRatio = 0.1;
+            f.ShortMarginRatio = 0.1;
+            f.IsTrading = 1;
+            f.InstLifePhase = THOST_FTDC_IP_Started;
+            f.MaxLimitOrderVolume = 1000;
+            f.MinLimitOrderVolume = 1;
+            instruments.push_back(f);
+
+            // 近月合约各生成一多一空两条持仓
+            if (withPositions && ahead == 0)
+            {
+                for (char dir: {THOST_FTDC_PD_Long, THOST_FTDC_PD_Short})
+                {
+                    CThostFtdcInvestorPositionField pos;
+                    memset(&pos, 0, sizeof(pos));
+                    copyField(pos.InstrumentID, id);
+                    copyField(pos.ExchangeID, def.exchange);
+                    copyField(pos.TradingDay, tradingDay);
+                    pos.PosiDirection = dir;
+                    pos.HedgeFlag = THOST_FTDC_HF_Speculation;
+                    pos.PositionDate = THOST_FTDC_PSD_Today;
+                    pos.Position = 10;
+                    pos.YdPosition = 5;
+                    pos.TodayPosition = 5;
+                    pos.PositionCost = def.price * def.multiple * pos.Position;
+                    pos.OpenCost = pos.PositionCost;
+                    pos.UseMargin = pos.PositionCost * 0.1;
+                    positions.push_back(pos);
+                    account.CurrMargin += pos.UseMargin;
+                }
+            }
+        }
+    }
+
+    if (account.AccountID[0] == '\0')
+    {
+        copyField(account.AccountID, "mock");
+        account.PreBalance = 10000000;
+        account.Balance = account.PreBalance;
+        account.Available = account.Balance - account.CurrMargin;
+    }
+}
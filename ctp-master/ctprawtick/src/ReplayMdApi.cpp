@@ -0,0 +1,252 @@
+#include <cstring>
+#include <chrono>
+#include <algorithm>
+#include "zlog.h"
+#include "ReplayMdApi.h"
+
+using namespace std;
+
+// external global variable
+extern zlog_category_t *cat;
+
+static int64_t steadyNs()
+{
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+ReplayMdApi::ReplayMdApi(const string& path_, double speed_, bool loop_)
+    : path(path_), speed(speed_), loop(loop_), spi(nullptr), running(false), loggedIn(false),
+      pending(false), baseRecvNs(0), baseWallNs(0), replayed(0), skipped(0), currentWallNs(0)
+{
+    memset(tradingDay, 0, sizeof(tradingDay));
+}
+
+ReplayMdApi::~ReplayMdApi()
+{
+}
+
+void ReplayMdApi::Release()
+{
+    running = false;
+    if (worker.joinable())
+    {
+        worker.join();
+    }
+    reader.close();
+    zlog_info(cat, "[ReplayMdApi::Release] 回放 %llu 条，未订阅跳过 %llu 条", (unsigned long long)replayed,
+              (unsigned long long)skipped);
+    delete this;
+}
+
+bool ReplayMdApi::scanInstruments(const string& path, vector<string>& instruments)
+{
+    TickFileReader scan;
+    if (!scan.open(path))
+    {
+        return false;
+    }
+    unordered_set<string> seen;
+    TickRecord record;
+    while (scan.next(record))
+    {
+        if (seen.insert(record.data.InstrumentID).second)
+        {
+            instruments.push_back(record.data.InstrumentID);
+        }
+    }
+    return true;
+}
+
+void ReplayMdApi::Init()
+{
+    if (!spi || !reader.open(path))
+    {
+        zlog_error(cat, "[ReplayMdApi::Init] 回放初始化失败: %s", path.c_str());
+        return;
+    }
+
+    // 以第一条行情的交易日作为登录回报的交易日
+    TickRecord record;
+    if (reader.next(record))
+    {
+        strncpy(tradingDay, record.data.TradingDay, sizeof(tradingDay) - 1);
+    }
+    reader.rewind();
+
+    zlog_info(cat, "[ReplayMdApi::Init] 回放文件: %s, 速度: %g%s, 交易日: %s", path.c_str(), speed,
+              speed > 0 ? "x" : "(全速)", tradingDay);
+    running = true;
+    worker = thread(&ReplayMdApi::run, this);
+}
+
+int ReplayMdApi::Join()
+{
+    if (worker.joinable())
+    {
+        worker.join();
+    }
+    return 0;
+}
+
+int ReplayMdApi::ReqUserLogin(CThostFtdcReqUserLoginField *pReqUserLoginField, int nRequestID)
+{
+    Request req;
+    req.type = Request::LOGIN;
+    req.requestID = nRequestID;
+    lock_guard<mutex> guard(lock);
+    requests.push_back(move(req));
+    pending = true;
+    return 0;
+}
+
+int ReplayMdApi::SubscribeMarketData(char *ppInstrumentID[], int nCount)
+{
+    Request req;
+    req.type = Request::SUBSCRIBE;
+    req.requestID = 0;
+    req.instruments.assign(ppInstrumentID, ppInstrumentID + nCount);
+    lock_guard<mutex> guard(lock);
+    requests.push_back(move(req));
+    pending = true;
+    return 0;
+}
+
+int ReplayMdApi::UnSubscribeMarketData(char *ppInstrumentID[], int nCount)
+{
+    Request req;
+    req.type = Request::UNSUBSCRIBE;
+    req.requestID = 0;
+    req.instruments.assign(ppInstrumentID, ppInstrumentID + nCount);
+    lock_guard<mutex> guard(lock);
+    requests.push_back(move(req));
+    pending = true;
+    return 0;
+}
+
+void ReplayMdApi::processRequests()
+{
+    vector<Request> batch;
+    {
+        lock_guard<mutex> guard(lock);
+        batch.swap(requests);
+        pending = false;
+    }
+
+    CThostFtdcRspInfoField info;
+    memset(&info, 0, sizeof(info));
+    for (auto& req: batch)
+    {
+        if (req.type == Request::LOGIN)
+        {
+            CThostFtdcRspUserLoginField rsp;
+            memset(&rsp, 0, sizeof(rsp));
+            strncpy(rsp.TradingDay, tradingDay, sizeof(rsp.TradingDay) - 1);
+            loggedIn = true;
+            spi->OnRspUserLogin(&rsp, &info, req.requestID, true);
+            continue;
+        }
+
+        for (size_t i = 0; i < req.instruments.size(); ++i)
+        {
+            CThostFtdcSpecificInstrumentField field;
+            memset(&field, 0, sizeof(field));
+            strncpy(field.InstrumentID, req.instruments[i].c_str(), sizeof(field.InstrumentID) - 1);
+            bool isLast = (i + 1 == req.instruments.size());
+            if (req.type == Request::SUBSCRIBE)
+            {
+                subscribed.insert(req.instruments[i]);
+                spi->OnRspSubMarketData(&field, &info, req.requestID, isLast);
+            }
+            else
+            {
+                subscribed.erase(req.instruments[i]);
+                spi->OnRspUnSubMarketData(&field, &info, req.requestID, isLast);
+            }
+        }
+    }
+}
+
+bool ReplayMdApi::pace(int64_t recvNs)
+{
+    if (speed <= 0)
+    {
+        return running;
+    }
+    if (baseWallNs == 0)
+    {
+        baseRecvNs = recvNs;
+        baseWallNs = steadyNs();
+        return running;
+    }
+
+    int64_t target = baseWallNs + static_cast<int64_t>((recvNs - baseRecvNs) / speed);
+    for (;;)
+    {
+        int64_t remain = target - steadyNs();
+        if (remain <= 0 || !running)
+        {
+            break;
+        }
+        if (remain > 2000000)
+        {
+            // 长间隔(如午休)分段睡眠，保证能及时退出
+            this_thread::sleep_for(chrono::nanoseconds(min<int64_t>(remain - 1000000, 100000000)));
+        }
+        else
+        {
+            this_thread::yield();
+        }
+    }
+    return running;
+}
+
+void ReplayMdApi::run()
+{
+    spi->OnFrontConnected();
+
+    bool finished = false;
+    TickRecord record;
+    while (running)
+    {
+        if (pending)
+        {
+            processRequests();
+        }
+        if (!loggedIn || finished)
+        {
+            this_thread::sleep_for(chrono::milliseconds(1));
+            continue;
+        }
+
+        if (!reader.next(record))
+        {
+            if (loop && reader.rewind())
+            {
+                zlog_info(cat, "[ReplayMdApi::run] 回放到文件末尾，从头开始，已回放 %llu 条，未订阅跳过 %llu 条",
+                          (unsigned long long)replayed, (unsigned long long)skipped);
+                baseWallNs = 0;
+                continue;
+            }
+            zlog_info(cat, "[ReplayMdApi::run] 回放结束，共 %llu 条，未订阅跳过 %llu 条", (unsigned long long)replayed,
+                      (unsigned long long)skipped);
+            finished = true;
+            continue;
+        }
+
+        if (subscribed.find(record.data.InstrumentID) == subscribed.end())
+        {
+            if (skipped++ == 0)
+            {
+                zlog_warn(cat, "[ReplayMdApi::run] 录制文件中的合约未订阅，跳过: %s", record.data.InstrumentID);
+            }
+            continue;
+        }
+        if (!pace(record.recvNs))
+        {
+            break;
+        }
+        currentWallNs = record.recvNs;
+        spi->OnRtnDepthMarketData(&record.data);
+        ++replayed;
+    }
+}
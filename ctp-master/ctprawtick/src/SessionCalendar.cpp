@@ -0,0 +1,379 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include "SessionCalendar.h"
+
+using namespace std;
+
+namespace
+{
+
+struct Range
+{
+    int open;   // HHMM
+    int close;  // HHMM，不含
+};
+
+const Range kDay[]         = {{900, 1015}, {1030, 1130}, {1330, 1500}};
+const Range kNight2300[]   = {{2100, 2300}};
+const Range kNight0100[]   = {{2100, 100}};
+const Range kNight0230[]   = {{2100, 230}};
+const Range kCffexIndex[]  = {{930, 1130}, {1300, 1500}};
+const Range kCffexBond[]   = {{930, 1130}, {1300, 1515}};
+
+// 以18:00为起点的分钟序号，夜盘排在日盘之前
+inline int orderedMinute(int minute)
+{
+    return minute >= 1080 ? minute - 1080 : minute + 360;
+}
+
+void markRanges(bool* trading, const Range* ranges, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        int m = ranges[i].open / 100 * 60 + ranges[i].open % 100;
+        int end = ranges[i].close / 100 * 60 + ranges[i].close % 100;
+        for (; m != end; m = (m + 1) % 1440)
+        {
+            trading[m] = true;
+        }
+    }
+}
+
+// 公历日期与1970-01-01起天数互转
+int daysFromCivil(int y, int m, int d)
+{
+    y -= m <= 2;
+    int era = (y >= 0 ? y : y - 399) / 400;
+    int yoe = y - era * 400;
+    int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+int civilFromDays(int z)
+{
+    z += 719468;
+    int era = (z >= 0 ? z : z - 146096) / 146097;
+    int doe = z - era * 146097;
+    int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int y = yoe + era * 400;
+    int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int mp = (5 * doy + 2) / 153;
+    int d = doy - (153 * mp + 2) / 5 + 1;
+    int m = mp + (mp < 10 ? 3 : -9);
+    y += m <= 2;
+    return y * 10000 + m * 100 + d;
+}
+
+inline int toDays(int date)
+{
+    return daysFromCivil(date / 10000, date / 100 % 100, date % 100);
+}
+
+}
+
+SessionCalendar::SessionCalendar(const vector<string>& holidays_)
+    : dayOpen(0), dayClose(0), nightOpen(0), nightClose(0), dayStart(0), today(0)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        cachedDate[i] = 0;
+        cachedTradingDay[i] = 0;
+    }
+    build();
+    setHolidays(holidays_);
+}
+
+void SessionCalendar::build()
+{
+    static const struct { int set; const Range* ranges; size_t n; } kSets[] = {
+        {SET_DAY,         kDay,        sizeof(kDay) / sizeof(Range)},
+        {SET_NIGHT_2300,  kDay,        sizeof(kDay) / sizeof(Range)},
+        {SET_NIGHT_2300,  kNight2300,  sizeof(kNight2300) / sizeof(Range)},
+        {SET_NIGHT_0100,  kDay,        sizeof(kDay) / sizeof(Range)},
+        {SET_NIGHT_0100,  kNight0100,  sizeof(kNight0100) / sizeof(Range)},
+        {SET_NIGHT_0230,  kDay,        sizeof(kDay) / sizeof(Range)},
+        {SET_NIGHT_0230,  kNight0230,  sizeof(kNight0230) / sizeof(Range)},
+        {SET_CFFEX_INDEX, kCffexIndex, sizeof(kCffexIndex) / sizeof(Range)},
+        {SET_CFFEX_BOND,  kCffexBond,  sizeof(kCffexBond) / sizeof(Range)},
+    };
+
+    bool trading[SET_COUNT][1440];
+    memset(trading, 0, sizeof(trading));
+    for (auto& s: kSets)
+    {
+        markRanges(trading[s.set], s.ranges, s.n);
+        markRanges(trading[SET_ALL], s.ranges, s.n);
+    }
+
+    for (int set = 0; set < SET_COUNT; ++set)
+    {
+        int idx = 0;
+        int session = -1;
+        bool prev = false;
+        for (int ord = 0; ord < 1440; ++ord)
+        {
+            int m = (ord + 1080) % 1440;
+            if (trading[set][m])
+            {
+                if (!prev)
+                {
+                    ++session;
+                }
+                minuteIdx[set][m] = static_cast<int16_t>(idx++);
+                sessionNo[set][m] = static_cast<int8_t>(session);
+            }
+            else
+            {
+                minuteIdx[set][m] = -1;
+                sessionNo[set][m] = -1;
+            }
+            prev = trading[set][m];
+        }
+    }
+
+    // 调度用的连续时段：日盘取06:00-18:00内首末交易分钟，夜盘取18:00-次日06:00
+    int firstDay = -1, lastDay = -1, firstNight = -1, lastNight = -1;
+    for (int ord = 0; ord < 1440; ++ord)
+    {
+        int m = (ord + 1080) % 1440;
+        if (!trading[SET_ALL][m])
+        {
+            continue;
+        }
+        if (ord < 720)
+        {
+            if (firstNight < 0) firstNight = ord;
+            lastNight = ord;
+        }
+        else
+        {
+            if (firstDay < 0) firstDay = ord;
+            lastDay = ord;
+        }
+    }
+    dayOpen    = (firstDay - 360) * 60;
+    dayClose   = (lastDay - 360 + 1) * 60;
+    nightOpen  = (firstNight + 1080) * 60;
+    nightClose = (lastNight + 1080 + 1) * 60;
+}
+
+void SessionCalendar::setHolidays(const vector<string>& list)
+{
+    holidays.clear();
+    for (auto& h: list)
+    {
+        int date = atoi(h.c_str());
+        if (date > 19700101)
+        {
+            holidays.push_back(date);
+        }
+    }
+    sort(holidays.begin(), holidays.end());
+    for (int i = 0; i < 3; ++i)
+    {
+        cachedDate[i] = 0;
+    }
+}
+
+const SessionCalendar::Product* SessionCalendar::product(const char* instrumentID) const
+{
+    char prefix[8];
+    size_t n = 0;
+    while (n < sizeof(prefix) - 1 && ((instrumentID[n] >= 'a' && instrumentID[n] <= 'z') ||
+                                      (instrumentID[n] >= 'A' && instrumentID[n] <= 'Z')))
+    {
+        prefix[n] = instrumentID[n];
+        ++n;
+    }
+    prefix[n] = '\0';
+    return ProductTable::find(prefix);
+}
+
+int SessionCalendar::sessionSetOf(const char* instrumentID) const
+{
+    const Product* p = product(instrumentID);
+    return p ? p->sessionSet : SET_ALL;
+}
+
+int SessionCalendar::secondOfDay(const char* t)
+{
+    if (t[2] != ':' || t[5] != ':')
+    {
+        return -1;
+    }
+    int hour = (t[0] - '0') * 10 + (t[1] - '0');
+    int min  = (t[3] - '0') * 10 + (t[4] - '0');
+    int sec  = (t[6] - '0') * 10 + (t[7] - '0');
+    if (hour < 0 || hour > 23 || min < 0 || min > 59 || sec < 0 || sec > 60)
+    {
+        return -1;
+    }
+    return hour * 3600 + min * 60 + (sec > 59 ? 59 : sec);
+}
+
+int SessionCalendar::barSecond(int set, int second) const
+{
+    int m = second / 60;
+    if (minuteIdx[set][m] >= 0)
+    {
+        return second;
+    }
+    int prev = (m + 1439) % 1440;
+    if (minuteIdx[set][prev] >= 0)
+    {
+        return prev * 60 + 59;
+    }
+    int next = (m + 1) % 1440;
+    if (minuteIdx[set][next] >= 0)
+    {
+        return next * 60;
+    }
+    return -1;
+}
+
+int SessionCalendar::addDays(int date, int days)
+{
+    return civilFromDays(toDays(date) + days);
+}
+
+bool SessionCalendar::isTradingDay(int date) const
+{
+    // 1970-01-01为周四
+    int weekday = ((toDays(date) % 7) + 11) % 7;  // 0为周日
+    if (weekday == 0 || weekday == 6)
+    {
+        return false;
+    }
+    return !binary_search(holidays.begin(), holidays.end(), date);
+}
+
+int SessionCalendar::nextTradingDay(int date) const
+{
+    int d = addDays(date, 1);
+    for (int i = 0; i < 30 && !isTradingDay(d); ++i)
+    {
+        d = addDays(d, 1);
+    }
+    return d;
+}
+
+bool SessionCalendar::hasNightSession(int date) const
+{
+    if (!isTradingDay(date))
+    {
+        return false;
+    }
+    // 与下一交易日之间隔着节假日（长假）时不开夜盘
+    int next = nextTradingDay(date);
+    for (int d = addDays(date, 1); d != next; d = addDays(d, 1))
+    {
+        if (binary_search(holidays.begin(), holidays.end(), d))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int SessionCalendar::tradingDayOf(int date, int second) const
+{
+    if (second >= 18 * 3600)
+    {
+        return nextTradingDay(date);
+    }
+    if (second < 6 * 3600)
+    {
+        return nextTradingDay(addDays(date, -1));
+    }
+    return date;
+}
+
+int SessionCalendar::localDate(time_t t, int* second)
+{
+    struct tm local;
+    localtime_r(&t, &local);
+    if (second)
+    {
+        *second = local.tm_hour * 3600 + local.tm_min * 60 + local.tm_sec;
+    }
+    return (local.tm_year + 1900) * 10000 + (local.tm_mon + 1) * 100 + local.tm_mday;
+}
+
+bool SessionCalendar::isTrading(int set, time_t now) const
+{
+    int second = 0;
+    int date = localDate(now, &second);
+    if (minuteIdx[set][second / 60] < 0)
+    {
+        return false;
+    }
+    if (second >= 18 * 3600)
+    {
+        return hasNightSession(date);
+    }
+    if (second < 6 * 3600)
+    {
+        return hasNightSession(addDays(date, -1));
+    }
+    return isTradingDay(date);
+}
+
+time_t SessionCalendar::nextClose(time_t now) const
+{
+    int second = 0;
+    int date = localDate(now, &second);
+    time_t midnight = now - second;
+    for (int i = -1; i < 30; ++i)
+    {
+        int d = addDays(date, i);
+        time_t base = midnight + static_cast<time_t>(i) * 86400;
+        if (isTradingDay(d) && base + dayClose > now)
+        {
+            return base + dayClose;
+        }
+        if (hasNightSession(d) && base + nightClose > now)
+        {
+            return base + nightClose;
+        }
+    }
+    return now + 86400;
+}
+
+void SessionCalendar::fixDates(CThostFtdcDepthMarketDataField& tick, time_t now)
+{
+    int second = secondOfDay(tick.UpdateTime);
+    if (second < 0)
+    {
+        return;
+    }
+    if (now < dayStart || now >= dayStart + 86400)
+    {
+        int nowSecond = 0;
+        today = localDate(now, &nowSecond);
+        dayStart = now - nowSecond;
+    }
+
+    // UpdateTime与本地时钟跨零点时按最近的一天取自然日
+    int nowSecond = static_cast<int>(now - dayStart);
+    int date = today;
+    if (second - nowSecond > 43200)
+    {
+        date = addDays(today, -1);
+    }
+    else if (nowSecond - second > 43200)
+    {
+        date = addDays(today, 1);
+    }
+
+    int part = second >= 18 * 3600 ? 2 : (second < 6 * 3600 ? 0 : 1);
+    if (cachedDate[part] != date)
+    {
+        cachedDate[part] = date;
+        cachedTradingDay[part] = tradingDayOf(date, second);
+    }
+    snprintf(tick.ActionDay, sizeof(tick.ActionDay), "%08d", date);
+    snprintf(tick.TradingDay, sizeof(tick.TradingDay), "%08d", cachedTradingDay[part]);
+}
@@ -0,0 +1,276 @@
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "ShmTickRing.h"
+
+using namespace std;
+
+static const uint64_t kShmMagic = 0x474E495254504D43ULL;    // "CMPTRING"
+static const uint32_t kShmVersion = 2;    // 2: ShmTick增加quarantine
+
+static_assert(sizeof(ShmRingHeader) == 128, "ShmRingHeader layout changed");
+static_assert(sizeof(ShmRingSlot) % 64 == 0, "ShmRingSlot must be cache line sized");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared memory atomics must be lock free");
+
+static string shmPath(const string& name)
+{
+    return name.empty() || name[0] == '/' ? name : "/" + name;
+}
+
+static size_t ringBytes(uint64_t capacity)
+{
+    return sizeof(ShmRingHeader) + capacity * sizeof(ShmRingSlot);
+}
+
+ShmTickWriter::ShmTickWriter()
+    : base(nullptr), mappedSize(0), header(nullptr), slots(nullptr), mask(0)
+{
+}
+
+ShmTickWriter::~ShmTickWriter()
+{
+    close();
+}
+
+bool ShmTickWriter::open(const string& ringName, size_t capacity, string& error)
+{
+    close();
+    if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+    {
+        error = "capacity must be a power of 2: " + to_string(capacity);
+        return false;
+    }
+    name = shmPath(ringName);
+    size_t size = ringBytes(capacity);
+
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+    {
+        error = "shm_open " + name + ": " + strerror(errno);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        error = string("fstat: ") + strerror(errno);
+        ::close(fd);
+        return false;
+    }
+
+    bool reuse = false;
+    if (static_cast<size_t>(st.st_size) >= sizeof(ShmRingHeader))
+    {
+        // 已有环：几何参数一致就沿用，否则清除magic让读端重连，再换一个新文件
+        void* old = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (old != MAP_FAILED)
+        {
+            ShmRingHeader* h = static_cast<ShmRingHeader*>(old);
+            reuse = static_cast<size_t>(st.st_size) == size && h->magic.load(memory_order_acquire) == kShmMagic
+                 && h->version == kShmVersion && h->slotSize == sizeof(ShmRingSlot) && h->capacity == capacity;
+            if (!reuse)
+            {
+                h->magic.store(0, memory_order_release);
+            }
+            munmap(old, st.st_size);
+        }
+        if (!reuse)
+        {
+            ::close(fd);
+            shm_unlink(name.c_str());
+            fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+            if (fd < 0)
+            {
+                error = "shm_open " + name + ": " + strerror(errno);
+                return false;
+            }
+        }
+    }
+
+    if (!reuse && ftruncate(fd, static_cast<off_t>(size)) != 0)
+    {
+        error = string("ftruncate: ") + strerror(errno);
+        ::close(fd);
+        return false;
+    }
+    void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED)
+    {
+        error = string("mmap: ") + strerror(errno);
+        return false;
+    }
+
+    base = p;
+    mappedSize = size;
+    header = static_cast<ShmRingHeader*>(p);
+    slots = reinterpret_cast<ShmRingSlot*>(static_cast<char*>(p) + sizeof(ShmRingHeader));
+    mask = capacity - 1;
+
+    if (!reuse)
+    {
+        // ftruncate出来的页全为0，槽位序号和writeSeq无需再清
+        header->version = kShmVersion;
+        header->slotSize = sizeof(ShmRingSlot);
+        header->capacity = capacity;
+        header->magic.store(kShmMagic, memory_order_release);
+    }
+    // 槽位区逐页原值写回一次，把页映射进来，避免行情高峰时缺页；原值不变，读端看到的内容不受影响
+    // 文件头所在的页在上面或第一次发布时就会写到
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    for (size_t off = pageSize; off < mappedSize; off += pageSize)
+    {
+        volatile char* page = static_cast<char*>(base) + off;
+        *page = *page;
+    }
+    return true;
+}
+
+void ShmTickWriter::close()
+{
+    // 不删除文件：读端可以继续读完剩余数据，写端重启后沿用序号
+    if (base != nullptr)
+    {
+        munmap(base, mappedSize);
+    }
+    base = nullptr;
+    header = nullptr;
+    slots = nullptr;
+    mappedSize = 0;
+    mask = 0;
+}
+
+void ShmTickWriter::publish(const ShmTick& tick)
+{
+    uint64_t n = header->writeSeq.load(memory_order_relaxed);
+    ShmRingSlot& slot = slots[n & mask];
+    slot.seq.store(2 * n + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    memcpy(&slot.tick, &tick, sizeof(ShmTick));
+    slot.seq.store(2 * n + 2, memory_order_release);
+    header->writeSeq.store(n + 1, memory_order_release);
+}
+
+uint64_t ShmTickWriter::published() const
+{
+    return header == nullptr ? 0 : header->writeSeq.load(memory_order_relaxed);
+}
+
+ShmTickReader::ShmTickReader()
+    : base(nullptr), mappedSize(0), header(nullptr), slots(nullptr), mask(0), cursor(0), lost(0)
+{
+}
+
+ShmTickReader::~ShmTickReader()
+{
+    close();
+}
+
+bool ShmTickReader::open(const string& ringName, string& error)
+{
+    close();
+    string path = shmPath(ringName);
+    int fd = shm_open(path.c_str(), O_RDONLY, 0);
+    if (fd < 0)
+    {
+        error = "shm_open " + path + ": " + strerror(errno);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(ShmRingHeader))
+    {
+        error = "ring not initialized: " + path;
+        ::close(fd);
+        return false;
+    }
+    void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED)
+    {
+        error = string("mmap: ") + strerror(errno);
+        return false;
+    }
+
+    ShmRingHeader* h = static_cast<ShmRingHeader*>(p);
+    if (h->magic.load(memory_order_acquire) != kShmMagic || h->version != kShmVersion
+        || h->slotSize != sizeof(ShmRingSlot) || ringBytes(h->capacity) != static_cast<size_t>(st.st_size))
+    {
+        error = "ring layout mismatch or not initialized: " + path;
+        munmap(p, st.st_size);
+        return false;
+    }
+
+    base = p;
+    mappedSize = st.st_size;
+    header = h;
+    slots = reinterpret_cast<ShmRingSlot*>(static_cast<char*>(p) + sizeof(ShmRingHeader));
+    mask = h->capacity - 1;
+    lost = 0;
+    seekLatest();
+    return true;
+}
+
+void ShmTickReader::close()
+{
+    if (base != nullptr)
+    {
+        munmap(base, mappedSize);
+    }
+    base = nullptr;
+    header = nullptr;
+    slots = nullptr;
+    mappedSize = 0;
+    mask = 0;
+}
+
+bool ShmTickReader::poll(ShmTick& out)
+{
+    for (;;)
+    {
+        uint64_t head = header->writeSeq.load(memory_order_acquire);
+        if (cursor >= head)
+        {
+            return false;
+        }
+        if (head - cursor > mask + 1)
+        {
+            // 落后超过一圈，跳到仍然有效的最旧一条
+            lost += head - cursor - (mask + 1);
+            cursor = head - (mask + 1);
+        }
+
+        const ShmRingSlot& slot = slots[cursor & mask];
+        uint64_t expect = 2 * cursor + 2;
+        if (slot.seq.load(memory_order_acquire) == expect)
+        {
+            memcpy(&out, &slot.tick, sizeof(ShmTick));
+            atomic_thread_fence(memory_order_acquire);
+            if (slot.seq.load(memory_order_relaxed) == expect)
+            {
+                ++cursor;
+                return true;
+            }
+        }
+        // 拷贝前后被写端追上覆盖，这一条作废
+        ++lost;
+        ++cursor;
+    }
+}
+
+void ShmTickReader::seekLatest()
+{
+    cursor = header->writeSeq.load(memory_order_acquire);
+}
+
+uint64_t ShmTickReader::backlog() const
+{
+    uint64_t head = header->writeSeq.load(memory_order_acquire);
+    return head > cursor ? head - cursor : 0;
+}
+
+bool ShmTickReader::stale() const
+{
+    return header == nullptr || header->magic.load(memory_order_acquire) != kShmMagic;
+}
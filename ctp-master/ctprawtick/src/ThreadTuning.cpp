@@ -0,0 +1,268 @@
+#include <cstring>
+#include <cerrno>
+#include <cstdlib>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "ThreadTuning.h"
+
+using namespace std;
+
+// numaif.h来自libnuma，这里只需要set_mempolicy，直接走系统调用
+static const int kMpolBind = 2;
+
+ThreadTuning& ThreadTuning::global()
+{
+    static ThreadTuning instance;
+    return instance;
+}
+
+static string trim(const string& s)
+{
+    size_t b = s.find_first_not_of(" \t");
+    if (b == string::npos)
+    {
+        return "";
+    }
+    size_t e = s.find_last_not_of(" \t");
+    return s.substr(b, e - b + 1);
+}
+
+static bool parseInt(const string& text, int& value)
+{
+    if (text.empty())
+    {
+        return false;
+    }
+    char* end = nullptr;
+    long v = strtol(text.c_str(), &end, 10);
+    if (*end != '\0')
+    {
+        return false;
+    }
+    value = static_cast<int>(v);
+    return true;
+}
+
+// 2,3,6-8
+static bool parseCpus(const string& text, vector<int>& cpus)
+{
+    size_t start = 0;
+    while (start <= text.size())
+    {
+        size_t comma = text.find(',', start);
+        string item = trim(text.substr(start, comma == string::npos ? string::npos : comma - start));
+        size_t dash = item.find('-');
+        int lo = 0;
+        int hi = 0;
+        if (dash == string::npos)
+        {
+            if (!parseInt(item, lo))
+            {
+                return false;
+            }
+            hi = lo;
+        }
+        else if (!parseInt(item.substr(0, dash), lo) || !parseInt(item.substr(dash + 1), hi) || hi < lo)
+        {
+            return false;
+        }
+        if (lo < 0 || hi >= CPU_SETSIZE)
+        {
+            return false;
+        }
+        for (int cpu = lo; cpu <= hi; ++cpu)
+        {
+            cpus.push_back(cpu);
+        }
+        if (comma == string::npos)
+        {
+            break;
+        }
+        start = comma + 1;
+    }
+    return !cpus.empty();
+}
+
+bool ThreadTuning::parse(const string& text, string& role, ThreadSpec& spec, string& error)
+{
+    size_t colon = text.find(':');
+    role = trim(text.substr(0, colon));
+    if (role.empty())
+    {
+        error = "missing role: " + text;
+        return false;
+    }
+    spec = ThreadSpec();
+    if (colon == string::npos)
+    {
+        return true;
+    }
+
+    string rest = text.substr(colon + 1);
+    size_t start = 0;
+    while (start < rest.size())
+    {
+        size_t semi = rest.find(';', start);
+        string item = trim(rest.substr(start, semi == string::npos ? string::npos : semi - start));
+        start = semi == string::npos ? rest.size() : semi + 1;
+        if (item.empty())
+        {
+            continue;
+        }
+
+        size_t eq = item.find('=');
+        string key = trim(item.substr(0, eq));
+        string value = eq == string::npos ? "" : trim(item.substr(eq + 1));
+        bool ok = false;
+        if (key == "cpus")
+        {
+            ok = parseCpus(value, spec.cpus);
+        }
+        else if (key == "prio")
+        {
+            ok = parseInt(value, spec.priority) && spec.priority >= 0 && spec.priority <= 99;
+        }
+        else if (key == "numa")
+        {
+            ok = parseInt(value, spec.numaNode) && spec.numaNode >= -1 && spec.numaNode < 64;
+        }
+        if (!ok)
+        {
+            error = "bad item '" + item + "' in " + text;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ThreadTuning::load(const vector<string>& specs, string& error)
+{
+    bool ok = true;
+    for (auto& text: specs)
+    {
+        string role;
+        ThreadSpec spec;
+        string err;
+        if (!parse(text, role, spec, err))
+        {
+            error += (error.empty() ? "" : "; ") + err;
+            ok = false;
+            continue;
+        }
+        set(role, spec);
+    }
+    return ok;
+}
+
+void ThreadTuning::set(const string& role, const ThreadSpec& spec)
+{
+    lock_guard<mutex> guard(lock);
+    roles[role] = spec;
+}
+
+bool ThreadTuning::has(const string& role) const
+{
+    lock_guard<mutex> guard(lock);
+    return roles.count(role) > 0;
+}
+
+bool ThreadTuning::apply(const string& role, const string& name, string& error) const
+{
+    ThreadSpec spec;
+    bool configured = false;
+    {
+        lock_guard<mutex> guard(lock);
+        auto it = roles.find(role);
+        if (it != roles.end())
+        {
+            spec = it->second;
+            configured = true;
+        }
+    }
+
+    bool ok = true;
+    string threadName = (name.empty() ? role : name).substr(0, 15);
+    int rc = pthread_setname_np(pthread_self(), threadName.c_str());
+    if (rc != 0)
+    {
+        error += "setname: " + string(strerror(rc)) + "; ";
+        ok = false;
+    }
+    if (!configured)
+    {
+        return ok;
+    }
+
+    if (!spec.cpus.empty())
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu: spec.cpus)
+        {
+            CPU_SET(cpu, &set);
+        }
+        rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        if (rc != 0)
+        {
+            error += "affinity: " + string(strerror(rc)) + "; ";
+            ok = false;
+        }
+    }
+
+    if (spec.priority > 0)
+    {
+        struct sched_param param;
+        memset(&param, 0, sizeof(param));
+        param.sched_priority = spec.priority;
+        rc = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (rc != 0)
+        {
+            error += "SCHED_FIFO: " + string(strerror(rc)) + "; ";
+            ok = false;
+        }
+    }
+
+    if (spec.numaNode >= 0)
+    {
+        // 之后由本线程分配的页只从该节点取
+        unsigned long mask = 1UL << spec.numaNode;
+        if (syscall(SYS_set_mempolicy, kMpolBind, &mask, sizeof(mask) * 8) != 0)
+        {
+            error += "set_mempolicy: " + string(strerror(errno)) + "; ";
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+string ThreadTuning::describe(const string& role, const ThreadSpec& spec)
+{
+    string out = role + ": cpus=";
+    if (spec.cpus.empty())
+    {
+        out += "any";
+    }
+    for (size_t i = 0; i < spec.cpus.size(); ++i)
+    {
+        out += (i ? "," : "") + to_string(spec.cpus[i]);
+    }
+    out += spec.priority > 0 ? " SCHED_FIFO/" + to_string(spec.priority) : " SCHED_OTHER";
+    if (spec.numaNode >= 0)
+    {
+        out += " numa=" + to_string(spec.numaNode);
+    }
+    return out;
+}
+
+vector<string> ThreadTuning::describeAll() const
+{
+    lock_guard<mutex> guard(lock);
+    vector<string> out;
+    for (auto& kv: roles)
+    {
+        out.push_back(describe(kv.first, kv.second));
+    }
+    return out;
+}
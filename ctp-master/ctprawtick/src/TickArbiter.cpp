@@ -0,0 +1,105 @@
+#include <cstring>
+#include "TickArbiter.h"
+
+using namespace std;
+
+TickArbiter::TickArbiter(size_t expectedInstruments)
+    : mask(0), acceptedCount(0), duplicateCount(0)
+{
+    // 负载因子不超过0.5
+    size_t capacity = 1024;
+    while (capacity < expectedInstruments * 2)
+    {
+        capacity <<= 1;
+    }
+    mask = capacity - 1;
+    slots.reset(new Slot[capacity]);
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        slots[i].key.store(0, memory_order_relaxed);
+        slots[i].seq.store(0, memory_order_relaxed);
+    }
+}
+
+uint64_t TickArbiter::hashId(const char* id)
+{
+    // FNV-1a
+    uint64_t h = 1469598103934665603ULL;
+    for (size_t i = 0; i < sizeof(TThostFtdcInstrumentIDType) && id[i]; ++i)
+    {
+        h ^= static_cast<unsigned char>(id[i]);
+        h *= 1099511628211ULL;
+    }
+    return h ? h : 1;
+}
+
+uint64_t TickArbiter::sequence(const CThostFtdcDepthMarketDataField& tick)
+{
+    const char* t = tick.UpdateTime;
+    uint64_t hour = (t[0] - '0') * 10 + (t[1] - '0');
+    uint64_t min  = (t[3] - '0') * 10 + (t[4] - '0');
+    uint64_t sec  = (t[6] - '0') * 10 + (t[7] - '0');
+    if (hour > 23 || min > 59 || sec > 60)
+    {
+        return 0;
+    }
+
+    // 夜盘跨越零点，以18:00为起点重新排序，保证 21:00 < 02:30 < 09:00 < 15:00
+    uint64_t secOfDay = hour * 3600 + min * 60 + sec;
+    uint64_t ordered = hour >= 18 ? secOfDay - 18 * 3600 : secOfDay + 6 * 3600;
+
+    uint64_t ms = static_cast<uint64_t>(tick.UpdateMillisec) & 0x3FF;
+    uint64_t volume = tick.Volume > 0 ? static_cast<uint64_t>(tick.Volume) : 0;
+    if (volume > 0x1FFFFFFFFFULL)
+    {
+        volume = 0x1FFFFFFFFFULL;
+    }
+    return (ordered << 47) | (ms << 37) | volume;
+}
+
+TickArbiter::Slot* TickArbiter::findOrInsert(uint64_t key)
+{
+    size_t idx = key & mask;
+    for (size_t probe = 0; probe <= mask; ++probe, idx = (idx + 1) & mask)
+    {
+        Slot& slot = slots[idx];
+        uint64_t cur = slot.key.load(memory_order_acquire);
+        if (cur == key)
+        {
+            return &slot;
+        }
+        if (cur == 0)
+        {
+            uint64_t expected = 0;
+            if (slot.key.compare_exchange_strong(expected, key, memory_order_acq_rel) || expected == key)
+            {
+                return &slot;
+            }
+        }
+    }
+    return nullptr;
+}
+
+bool TickArbiter::accept(const CThostFtdcDepthMarketDataField& tick)
+{
+    uint64_t seq = sequence(tick);
+    Slot* slot = findOrInsert(hashId(tick.InstrumentID));
+    if (!slot || seq == 0)
+    {
+        // 表已满或时间格式异常时不做仲裁，直接放行
+        acceptedCount.fetch_add(1, memory_order_relaxed);
+        return true;
+    }
+
+    uint64_t cur = slot->seq.load(memory_order_acquire);
+    while (seq > cur)
+    {
+        if (slot->seq.compare_exchange_weak(cur, seq, memory_order_acq_rel))
+        {
+            acceptedCount.fetch_add(1, memory_order_relaxed);
+            return true;
+        }
+    }
+    duplicateCount.fetch_add(1, memory_order_relaxed);
+    return false;
+}
@@ -0,0 +1,149 @@
+#include <cstring>
+#include "zlog.h"
+#include "TickRecorder.h"
+
+using namespace std;
+
+// external global variable
+extern zlog_category_t *cat;
+
+static const char     kMagic[8] = "CTPTICK";
+static const uint32_t kVersion = 1;
+// 64KB写缓冲，约150条记录
+static const size_t   kBufferSize = 64 * 1024;
+
+TickRecorder::TickRecorder()
+    : fp(nullptr), count(0)
+{
+}
+
+TickRecorder::~TickRecorder()
+{
+    close();
+}
+
+bool TickRecorder::open(const string& path)
+{
+    close();
+    fp = fopen(path.c_str(), "wb");
+    if (!fp)
+    {
+        zlog_error(cat, "[TickRecorder::open] 无法创建录制文件: %s", path.c_str());
+        return false;
+    }
+    setvbuf(fp, nullptr, _IOFBF, kBufferSize);
+
+    TickFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, kMagic, sizeof(header.magic));
+    header.version = kVersion;
+    header.recordSize = sizeof(TickRecord);
+    if (fwrite(&header, sizeof(header), 1, fp) != 1)
+    {
+        zlog_error(cat, "[TickRecorder::open] 写入文件头失败: %s", path.c_str());
+        close();
+        return false;
+    }
+
+    file = path;
+    count = 0;
+    zlog_info(cat, "[TickRecorder::open] 开始录制行情: %s", path.c_str());
+    return true;
+}
+
+void TickRecorder::close()
+{
+    if (fp)
+    {
+        fclose(fp);
+        fp = nullptr;
+        zlog_info(cat, "[TickRecorder::close] 录制结束: %s, 共 %llu 条", file.c_str(), (unsigned long long)count);
+    }
+}
+
+bool TickRecorder::write(const CThostFtdcDepthMarketDataField& tick, int64_t recvNs, int feed)
+{
+    if (!fp)
+    {
+        return false;
+    }
+
+    TickRecord record;
+    record.recvNs = recvNs;
+    record.feed = feed;
+    record.reserved = 0;
+    record.data = tick;
+    if (fwrite(&record, sizeof(record), 1, fp) != 1)
+    {
+        zlog_error(cat, "[TickRecorder::write] 写入失败，停止录制: %s", file.c_str());
+        close();
+        return false;
+    }
+    ++count;
+    return true;
+}
+
+void TickRecorder::flush()
+{
+    if (fp)
+    {
+        fflush(fp);
+    }
+}
+
+TickFileReader::TickFileReader()
+    : fp(nullptr)
+{
+}
+
+TickFileReader::~TickFileReader()
+{
+    close();
+}
+
+bool TickFileReader::open(const string& path)
+{
+    close();
+    fp = fopen(path.c_str(), "rb");
+    if (!fp)
+    {
+        zlog_error(cat, "[TickFileReader::open] 无法打开录制文件: %s", path.c_str());
+        return false;
+    }
+    setvbuf(fp, nullptr, _IOFBF, kBufferSize);
+
+    TickFileHeader header;
+    if (fread(&header, sizeof(header), 1, fp) != 1 || memcmp(header.magic, kMagic, sizeof(kMagic)) != 0)
+    {
+        zlog_error(cat, "[TickFileReader::open] 不是行情录制文件: %s", path.c_str());
+        close();
+        return false;
+    }
+    if (header.version != kVersion || header.recordSize != sizeof(TickRecord))
+    {
+        zlog_error(cat, "[TickFileReader::open] 录制文件版本不匹配: %s, version %u, record %u bytes, expect %u bytes",
+                   path.c_str(), header.version, header.recordSize, (unsigned)sizeof(TickRecord));
+        close();
+        return false;
+    }
+    return true;
+}
+
+void TickFileReader::close()
+{
+    if (fp)
+    {
+        fclose(fp);
+        fp = nullptr;
+    }
+}
+
+bool TickFileReader::rewind()
+{
+    return fp && fseek(fp, sizeof(TickFileHeader), SEEK_SET) == 0;
+}
+
+bool TickFileReader::next(TickRecord& record)
+{
+    return fp && fread(&record, sizeof(record), 1, fp) == 1;
+}
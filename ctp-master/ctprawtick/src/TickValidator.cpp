@@ -0,0 +1,193 @@
+#include <cstring>
+#include <cstdlib>
+#include <charconv>
+#include "TickValidator.h"
+
+using namespace std;
+
+static const char* kRuleNames[] = {"bad_price", "price_band", "crossed_book",
+                                   "out_of_session", "out_of_order", "volume_back"};
+
+// 价格比较容差
+static const double kEpsilon = 1e-6;
+// 超过该值视为CTP未填写(DBL_MAX)
+static const double kPriceMax = 1e300;
+
+// 0/负数/NaN/DBL_MAX均无效，NaN参与的比较都为false
+static inline uint32_t validPrice(double p)
+{
+    return static_cast<uint32_t>(p > 0) & static_cast<uint32_t>(p < kPriceMax);
+}
+
+static inline uint32_t bit(uint32_t cond, int rule)
+{
+    return cond << rule;
+}
+
+const char* TickValidator::ruleName(int rule)
+{
+    return (rule >= 0 && rule < RULE_COUNT) ? kRuleNames[rule] : "";
+}
+
+int TickValidator::parseRule(const string& name)
+{
+    for (int rule = 0; rule < RULE_COUNT; ++rule)
+    {
+        if (name == kRuleNames[rule])
+        {
+            return rule;
+        }
+    }
+    return -1;
+}
+
+string TickValidator::describe(uint32_t mask)
+{
+    string out;
+    for (int rule = 0; rule < RULE_COUNT; ++rule)
+    {
+        if (mask & (1u << rule))
+        {
+            if (!out.empty())
+            {
+                out.push_back('|');
+            }
+            out.append(kRuleNames[rule]);
+        }
+    }
+    return out;
+}
+
+TickValidator::TickValidator(const SessionCalendar& calendar_, size_t expectedInstruments)
+    : calendar(calendar_), dropMask(0), checkedCount(0), droppedCount(0)
+{
+    states.reserve(expectedInstruments);
+    index.reserve(expectedInstruments);
+    memset(ruleCount, 0, sizeof(ruleCount));
+}
+
+uint32_t TickValidator::slotIndex(const char* instrumentID)
+{
+    auto it = index.find(instrumentID);
+    if (it != index.end())
+    {
+        return it->second;
+    }
+
+    uint32_t slot = static_cast<uint32_t>(states.size());
+    index.emplace(instrumentID, slot);
+    State state;
+    state.tradingDay = 0;
+    state.sessionSet = calendar.sessionSetOf(instrumentID);
+    state.lastTime = 0;
+    state.volume = 0;
+    state.turnover = 0;
+    states.push_back(state);
+    return slot;
+}
+
+uint32_t TickValidator::checkStateless(const CThostFtdcDepthMarketDataField& tick, int second, int set) const
+{
+    uint32_t lastOk  = validPrice(tick.LastPrice);
+    uint32_t bidOk   = validPrice(tick.BidPrice1);
+    uint32_t askOk   = validPrice(tick.AskPrice1);
+    uint32_t limitOk = validPrice(tick.UpperLimitPrice) & validPrice(tick.LowerLimitPrice);
+
+    uint32_t outBand = static_cast<uint32_t>(tick.LastPrice > tick.UpperLimitPrice + kEpsilon)
+                     | static_cast<uint32_t>(tick.LastPrice < tick.LowerLimitPrice - kEpsilon);
+    uint32_t crossed = static_cast<uint32_t>(tick.BidPrice1 >= tick.AskPrice1 - kEpsilon);
+    // 收盘后与集合竞价的tick按K线规则归入相邻交易分钟，不算非交易时间
+    uint32_t badTime = static_cast<uint32_t>(second < 0);
+    uint32_t offHour = static_cast<uint32_t>(calendar.barSecond(set, second & ~(second >> 31)) < 0);
+
+    return bit(lastOk ^ 1u, RULE_BAD_PRICE)
+         | bit(lastOk & limitOk & outBand, RULE_PRICE_BAND)
+         | bit(bidOk & askOk & crossed, RULE_CROSSED_BOOK)
+         | bit(badTime | offHour, RULE_OUT_OF_SESSION);
+}
+
+size_t TickValidator::check(const MarketTick* ticks, size_t n, uint32_t* masks)
+{
+    if (seconds.size() < n)
+    {
+        seconds.resize(n);
+        slots.resize(n);
+    }
+
+    // 第一遍：查合约状态，计算无状态规则
+    for (size_t i = 0; i < n; ++i)
+    {
+        slots[i] = slotIndex(ticks[i].data.InstrumentID);
+        seconds[i] = SessionCalendar::secondOfDay(ticks[i].data.UpdateTime);
+        masks[i] = checkStateless(ticks[i].data, seconds[i], states[slots[i]].sessionSet);
+    }
+
+    // 第二遍：按到达顺序与合约上一条通过的tick比较，同一批内同一合约可能出现多次
+    size_t drops = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const CThostFtdcDepthMarketDataField& tick = ticks[i].data;
+        State& state = states[slots[i]];
+
+        // 18:00起算，夜盘在前
+        int second = seconds[i] & ~(seconds[i] >> 31);
+        int t = ((second + 6 * 3600) % 86400) * 1000 + tick.UpdateMillisec;
+        int day = atoi(tick.TradingDay);
+        uint32_t sameDay = static_cast<uint32_t>(day == state.tradingDay);
+
+        uint32_t early = static_cast<uint32_t>(t < state.lastTime);
+        uint32_t back  = static_cast<uint32_t>(tick.Volume < state.volume)
+                       | static_cast<uint32_t>(tick.Turnover < state.turnover - kEpsilon);
+        uint32_t mask  = masks[i]
+                       | bit(sameDay & early, RULE_OUT_OF_ORDER)
+                       | bit(sameDay & back, RULE_VOLUME_BACK);
+        masks[i] = mask;
+
+        for (int rule = 0; rule < RULE_COUNT; ++rule)
+        {
+            ruleCount[rule] += (mask >> rule) & 1u;
+        }
+
+        if (mask & dropMask)
+        {
+            // 丢弃的tick不更新状态
+            ++drops;
+            continue;
+        }
+        state.tradingDay = day;
+        state.lastTime = t;
+        state.volume = tick.Volume;
+        state.turnover = tick.Turnover;
+    }
+
+    checkedCount += n;
+    droppedCount += drops;
+    return drops;
+}
+
+static void appendNumber(string& out, double v)
+{
+    char buf[32];
+    auto res = to_chars(buf, buf + sizeof(buf), v);
+    out.append(buf, res.ptr - buf);
+}
+
+string TickValidator::toCsv(const CThostFtdcDepthMarketDataField& tick, uint32_t mask)
+{
+    string out;
+    out.reserve(192);
+    out.append(tick.InstrumentID).push_back(',');
+    out.append(tick.TradingDay).push_back(',');
+    out.append(tick.UpdateTime).push_back(',');
+    out.append(to_string(tick.UpdateMillisec));     out.push_back(',');
+    appendNumber(out, tick.LastPrice);              out.push_back(',');
+    appendNumber(out, tick.BidPrice1);              out.push_back(',');
+    appendNumber(out, tick.AskPrice1);              out.push_back(',');
+    appendNumber(out, tick.UpperLimitPrice);        out.push_back(',');
+    appendNumber(out, tick.LowerLimitPrice);        out.push_back(',');
+    out.append(to_string(tick.Volume));             out.push_back(',');
+    appendNumber(out, tick.OpenInterest);           out.push_back(',');
+    out.append(to_string(mask));                    out.push_back(',');
+    out.append(describe(mask));
+    return out;
+}
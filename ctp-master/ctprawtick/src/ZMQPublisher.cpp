@@ -109,6 +109,23 @@ bool ZMQPublisher::publishMessage(const std::string& messageType, const std::vec
     }
 }
 
+bool ZMQPublisher::sendFrame(const void* data, size_t size, bool more) {
+    if (!initialized || !socket) {
+        std::cerr << "[ZMQPublisher::sendFrame] 发布者未初始化" << std::endl;
+        return false;
+    }
+    
+    try {
+        zmq::message_t frame(data, size);
+        socket->send(frame, more ? zmq::send_flags::sndmore : zmq::send_flags::none);
+        return true;
+        
+    } catch (const zmq::error_t& e) {
+        std::cerr << "[ZMQPublisher::sendFrame] ZMQ发送失败: " << e.what() << std::endl;
+        return false;
+    }
+}
+
 void ZMQPublisher::disconnect() {
     try {
         if (socket) {
@@ -4,12 +4,12 @@
 //#include <Config.h>
 #include "../include/JsonConfig.h"
 #include "appConfig.h"
+#include "ThreadTuning.h"
 
 using namespace std;
 
 // global variable for zmq server
 string pushServer;
-vector<string> DECSymbols;
 
 // external global variable
 extern string currentPath;
@@ -30,9 +30,47 @@ CAppConfig::CAppConfig()
     password  = cfg.Read<string>("password");
     appid     = cfg.Read<string>("appid");
     authcode  = cfg.Read<string>("authcode");
-    dayend    = cfg.Read<string>("dayend");
-    nightend  = cfg.Read<string>("nightend");
     pushServer= cfg.Read<string>("ZMQServer");
+    md_feeds     = cfg.ReadArray("md_feeds", vector<string>());
+    md_sub_batch = cfg.Read<int>("md_sub_batch", 100);
+    md_sub_rate  = cfg.Read<int>("md_sub_rate", 5);
+    reconnect_backoff_min_ms = cfg.Read<int>("reconnect_backoff_min_ms", 500);
+    reconnect_backoff_max_ms = cfg.Read<int>("reconnect_backoff_max_ms", 30000);
+    front_failover_sec       = cfg.Read<int>("front_failover_sec", 30);
+    batch_encoding   = cfg.Read<string>("batch_encoding", "csv");
+    instrument_encoding = cfg.Read<string>("instrument_encoding", "protobuf");
+    batch_chunk_rows = cfg.Read<int>("batch_chunk_rows", 500);
+    kline_enable          = cfg.Read<int>("kline_enable", 0);
+    kline_flush_delay_sec = cfg.Read<int>("kline_flush_delay_sec", 3);
+    kline_persist_dir     = cfg.Read<string>("kline_persist_dir", "");
+    kline_publish         = cfg.ReadArray("kline_publish", vector<string>{"1min"});
+    kline_ring_size       = cfg.Read<int>("kline_ring_size", 512);
+    kline_query_addr      = cfg.Read<string>("kline_query_addr", "");
+    md_record_dir         = cfg.Read<string>("md_record_dir", "");
+    md_replay_file        = cfg.Read<string>("md_replay_file", "");
+    md_replay_speed       = cfg.Read<double>("md_replay_speed", 1.0);
+    md_replay_loop        = cfg.Read<int>("md_replay_loop", 0);
+    td_mock               = cfg.Read<int>("td_mock", 0);
+    td_mock_dir           = cfg.Read<string>("td_mock_dir", "");
+    td_mock_instruments   = cfg.Read<int>("td_mock_instruments", 2000);
+    td_mock_latency_ms    = cfg.Read<int>("td_mock_latency_ms", 20);
+    td_mock_page_size     = cfg.Read<int>("td_mock_page_size", 50);
+    td_mock_page_gap_ms   = cfg.Read<int>("td_mock_page_gap_ms", 1);
+    td_mock_query_rate    = cfg.Read<int>("td_mock_query_rate", 1);
+    td_mock_max_inflight  = cfg.Read<int>("td_mock_max_inflight", 1);
+    tick_validate         = cfg.Read<int>("tick_validate", 0);
+    tick_drop_rules       = cfg.ReadArray("tick_drop_rules", vector<string>{"price_band", "crossed_book",
+                                          "out_of_session", "out_of_order", "volume_back"});
+    latency_trace         = cfg.Read<int>("latency_trace", 0);
+    metrics_bind          = cfg.Read<string>("metrics_bind", "127.0.0.1");
+    market_metrics_port   = cfg.Read<int>("market_metrics_port", 9101);
+    monitor_metrics_port  = cfg.Read<int>("monitor_metrics_port", 9102);
+    md_topic_mode         = cfg.Read<string>("md_topic_mode", "single");
+    md_transport          = cfg.Read<string>("md_transport", "zmq");
+    md_shm_name           = cfg.Read<string>("md_shm_name", "ctp_md");
+    md_shm_capacity       = cfg.Read<int>("md_shm_capacity", 65536);
+    threads               = cfg.ReadArray("threads", vector<string>());
+    holidays              = cfg.ReadArray("holidays", vector<string>());
 
     zlog_info(cat, "[CAppConfig] load config from config file successfully.");
     zlog_info(cat, "[CAppConfig] %9s: %-20s", "brokerid", brokerid.c_str());
@@ -42,37 +80,70 @@ CAppConfig::CAppConfig()
     zlog_info(cat, "[CAppConfig] %9s: %-20s", "authcode", authcode.c_str());
     zlog_info(cat, "[CAppConfig] %9s: %-20s", "authcode", authcode.c_str());
     zlog_info(cat, "[CAppConfig] %9s: %-20s", "ZMQServer", pushServer.c_str());
+    zlog_info(cat, "[CAppConfig] %9s: %d per request, %d requests/s", "md_sub", md_sub_batch, md_sub_rate);
+    zlog_info(cat, "[CAppConfig] %9s: instrument %s, position %s, %d rows per frame", "batch",
+              instrument_encoding.c_str(), batch_encoding.c_str(), batch_chunk_rows);
+    zlog_info(cat, "[CAppConfig] %9s: backoff %d-%d ms, failover %d s", "reconnect",
+              reconnect_backoff_min_ms, reconnect_backoff_max_ms, front_failover_sec);
+    zlog_info(cat, "[CAppConfig] %9s: %s, flush delay %d s, persist dir: %s", "kline",
+              kline_enable ? "on" : "off", kline_flush_delay_sec, kline_persist_dir.c_str());
+    zlog_info(cat, "[CAppConfig] %9s: %d bars per timeframe, query: %s", "kline",
+              kline_ring_size, kline_query_addr.c_str());
+    if (!md_record_dir.empty())
+    {
+        zlog_info(cat, "[CAppConfig] %9s: %-20s", "md_record", md_record_dir.c_str());
+    }
+    if (!md_replay_file.empty())
+    {
+        zlog_info(cat, "[CAppConfig] %9s: %s, speed %g, loop %d", "md_replay", md_replay_file.c_str(),
+                  md_replay_speed, md_replay_loop);
+    }
+    if (td_mock)
+    {
+        zlog_info(cat, "[CAppConfig] %9s: fixture: %s, latency %d ms, page %d/%d ms, %d qry/s, inflight %d", "td_mock",
+                  td_mock_dir.c_str(), td_mock_latency_ms, td_mock_page_size, td_mock_page_gap_ms,
+                  td_mock_query_rate, td_mock_max_inflight);
+    }
+    zlog_info(cat, "[CAppConfig] %9s: %s", "tick_chk", tick_validate ? "on" : "off");
+    zlog_info(cat, "[CAppConfig] %9s: %s", "latency", latency_trace ? "on" : "off");
+    zlog_info(cat, "[CAppConfig] %9s: %s, market port %d, monitor port %d", "metrics", metrics_bind.c_str(),
+              market_metrics_port, monitor_metrics_port);
+    zlog_info(cat, "[CAppConfig] %9s: %s, topic %s, shm ring /dev/shm/%s, %d slots", "md_pub", md_transport.c_str(),
+              md_topic_mode.c_str(), md_shm_name.c_str(), md_shm_capacity);
+    // 线程角色配置在读取配置时登记，各线程启动时按角色设置
+    string threadError;
+    if (!ThreadTuning::global().load(threads, threadError))
+    {
+        zlog_warn(cat, "[CAppConfig] 线程配置有误: %s", threadError.c_str());
+    }
+    for (auto& desc: ThreadTuning::global().describeAll())
+    {
+        zlog_info(cat, "[CAppConfig] %9s: %s", "thread", desc.c_str());
+    }
+    for (auto& rule: tick_drop_rules)
+    {
+        zlog_info(cat, "[CAppConfig] %9s: %-20s", "tick_drop", rule.c_str());
+    }
+    for (auto& tf: kline_publish)
+    {
+        zlog_info(cat, "[CAppConfig] %9s: %-20s", "kline_pub", tf.c_str());
+    }
 
     if (!md_server.empty())
     {
         zlog_info(cat, "[CAppConfig] %9s: %-20s", "md_server", md_server.c_str());
     }
+    for (auto& feed: md_feeds)
+    {
+        zlog_info(cat, "[CAppConfig] %9s: %-20s", "md_feed", feed.c_str());
+    }
     if (!td_server.empty())
     {
         zlog_info(cat, "[CAppConfig] %9s: %-20s", "td_server", td_server.c_str());
     }
 
-    // string decSymbols = cfg.Read<string>("DEC");
-    // string delim = ",";
-    // size_t prepos = 0;
-    // size_t findpos = 0;
-    // while (1)
-    // {
-    //     findpos = decSymbols.find(delim, prepos);
-    //     if (findpos != string::npos)
-    //     {
-    //         DECSymbols.push_back(decSymbols.substr(prepos, findpos-prepos));
-    //         prepos = findpos + 1;
-    //     }
-    //     else
-    //     {
-    //         DECSymbols.push_back(decSymbols.substr(prepos));
-    //         break;
-    //     }
-    // }
-    DECSymbols = cfg.ReadArray("DEC");
-    for (auto& m: DECSymbols)
+    for (auto& h: holidays)
     {
-        zlog_info(cat, "[CAppConfig] %9s: %-20s", "DEC", m.c_str());
+        zlog_info(cat, "[CAppConfig] %9s: %-20s", "holiday", h.c_str());
     }
 }
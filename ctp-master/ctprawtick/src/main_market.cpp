@@ -5,10 +5,26 @@
 #include <vector>
 #include <condition_variable>
 #include <mutex>
+#include <memory>
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <ctime>
 #include <zmq.hpp>
 #include "zlog.h"
 #include "utils.h"
 #include "CTPQuote.h"
+#include "CTPKline1min.h"
+#include "KlineQueryServer.h"
+#include "SessionCalendar.h"
+#include "TickValidator.h"
+#include "TickRecorder.h"
+#include "ReplayMdApi.h"
+#include "LatencyStats.h"
+#include "MetricsRegistry.h"
+#include "ThreadTuning.h"
+#include "ShmTickRing.h"
+#include "MarketTopic.h"
 #include "Config.h"
 #include "readerwriterqueue.h"
 #include "../include/ZMQPublisher.h"
@@ -21,16 +37,27 @@ using namespace moodycamel;
 // global variable definitions needed by CTPQuote
 extern string currentPath;           // 在utils.cpp中定义
 vector<string>      contracts;        // 合约列表
-extern vector<string> DECSymbols;     // 在appConfig.cpp中定义
 condition_variable  cv;
 mutex               m;
 bool                isReady = false;
 extern string       pushServer;       // 在appConfig.cpp中定义
 
-// 修改队列类型：使用CThostFtdcDepthMarketDataField而不是string
-ReaderWriterQueue<CThostFtdcDepthMarketDataField>  q(10000);
-// 缓存发送不成功的行情数据
-ReaderWriterQueue<CThostFtdcDepthMarketDataField>  bufq(500000);
+// 行情发布的主题，按位记录一条行情已经发出的主题
+enum PublishTopic
+{
+    TOPIC_SINGLE     = 1,   // MARKET_DATA_PROTOBUF
+    TOPIC_INSTRUMENT = 2    // MD.<交易所>.<品种>.<合约>
+};
+
+// 发送失败等待重试的行情，sent为已经发出的主题，重试时只补发其余主题
+struct RetryTick
+{
+    MarketTick  tick;
+    uint32_t    sent;
+};
+
+// 缓存发送不成功的行情数据，只在主线程中读写；队首发送成功才出队，保证按到达顺序发布
+ReaderWriterQueue<RetryTick>  bufq(500000);
 
 // global variable
 zlog_category_t *cat = nullptr;
@@ -38,6 +65,278 @@ zlog_category_t *cat = nullptr;
 // ZMQ Publisher for market data
 ZMQPublisher marketPublisher("tcp://*:9999");  // 使用不同的端口发布行情数据
 
+static int64_t epochMs()
+{
+    return chrono::duration_cast<chrono::milliseconds>(
+        chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// 发布端各阶段延迟，每60秒输出一次并清零
+LatencyHistogram latExchange("exchange_to_recv");   // 交易所时间到SPI收到（墙钟，含时钟偏差）
+LatencyHistogram latQueue("recv_to_dequeue");
+LatencyHistogram latEncode("dequeue_to_encode");
+LatencyHistogram latSend("encode_to_sent");
+LatencyHistogram latTotal("recv_to_sent");
+bool             latencyTrace = false;              // 行情消息是否附带打点尾部，取自latency_trace
+
+// 运行指标，由HTTP /metrics导出；各路行情相关的指标在创建行情API后注册
+MetricsRegistry  metrics;
+MetricCounter&   metricPublished = metrics.counter("ctp_md_ticks_published_total", "发布到ZMQ的行情条数");
+MetricCounter&   metricPublishFailed = metrics.counter("ctp_md_publish_failures_total", "ZMQ发送失败、转入重试缓存的次数");
+MetricCounter&   metricBufqDropped = metrics.counter("ctp_md_ticks_dropped_total", "丢弃的行情条数", "reason=\"bufq_full\"");
+MetricCounter&   metricQuarantined = metrics.counter("ctp_md_ticks_quarantined_total", "校验不通过发往隔离主题的行情条数");
+MetricGauge&     metricBufqDepth = metrics.gauge("ctp_md_bufq_depth", "发送失败重试缓存bufq的深度");
+MetricHistogram& metricPublishLatency = metrics.histogram("ctp_md_publish_latency_seconds", "SPI收到到ZMQ发送完成的耗时",
+                                                          MetricHistogram::exponential(1e-6, 2, 20));
+
+// 同机消费者使用的共享内存行情环，md_transport为shm或both时创建，只在主线程中写
+unique_ptr<ShmTickWriter> shmRing;
+bool             publishZmq = true;                 // md_transport为shm时不再编码发布到ZMQ
+bool             topicSingle = true;                // 发布到MARKET_DATA_PROTOBUF，取自md_topic_mode
+bool             topicInstrument = false;           // 发布到MD.<交易所>.<品种>.<合约>
+LatencyHistogram latShm("recv_to_shm");
+
+// 交易所行情时间(ActionDay+UpdateTime+UpdateMillisec)对应的系统时钟纳秒，日期解析失败返回0
+static int64_t exchangeWallNs(const CThostFtdcDepthMarketDataField& marketData)
+{
+    static char   cachedDay[9] = {0};
+    static time_t cachedMidnight = 0;
+
+    if (strncmp(cachedDay, marketData.ActionDay, 8) != 0)
+    {
+        int y = 0, mon = 0, d = 0;
+        if (sscanf(marketData.ActionDay, "%4d%2d%2d", &y, &mon, &d) != 3)
+        {
+            return 0;
+        }
+        struct tm t;
+        memset(&t, 0, sizeof(t));
+        t.tm_year = y - 1900;
+        t.tm_mon = mon - 1;
+        t.tm_mday = d;
+        t.tm_isdst = -1;
+        cachedMidnight = mktime(&t);
+        memcpy(cachedDay, marketData.ActionDay, 8);
+    }
+    const char* u = marketData.UpdateTime;      // HH:MM:SS
+    int seconds = ((u[0] - '0') * 10 + (u[1] - '0')) * 3600 + ((u[3] - '0') * 10 + (u[4] - '0')) * 60
+                + (u[6] - '0') * 10 + (u[7] - '0');
+    return (static_cast<int64_t>(cachedMidnight) + seconds) * 1000000000LL + marketData.UpdateMillisec * 1000000LL;
+}
+
+// 断线缺口标记，格式: START,断线原因,时间戳(ms) / END,缺口时长(ms),时间戳(ms)
+// 多路行情时只有全部线路都断开才算缺口，单路断线只记录日志
+void publishGapMarkers(vector<unique_ptr<CTPMarketSpi>>& feeds)
+{
+    static bool    everUp = false;
+    static bool    gapOpen = false;
+    static int     lastReason = 0;
+    static int64_t gapStartMs = 0;
+
+    char buf[128];
+    int reason = 0;
+    int64_t gapMs = 0;
+    int64_t ts = 0;
+    size_t live = 0;
+
+    for (auto& feed: feeds)
+    {
+        FrontConnection& conn = feed->connection();
+        if (conn.takeGapStart(reason, ts))
+        {
+            lastReason = reason;
+            zlog_warn(cat, "[main] 行情[%d]前置断开，原因: %d", feed->feedId(), reason);
+        }
+        if (conn.takeGapEnd(gapMs, ts))
+        {
+            FrontConnection::Stats st = conn.stats();
+            zlog_warn(cat, "[main] 行情[%d]重连成功，缺口 %lld ms，累计重连 %llu 次，最长 %lld ms，总计 %lld ms，重建API %llu 次",
+                      feed->feedId(), (long long)gapMs, (unsigned long long)st.reconnectCount, (long long)st.maxGapMs,
+                      (long long)st.totalGapMs, (unsigned long long)st.recreateCount);
+        }
+        if (conn.isLoggedIn())
+        {
+            ++live;
+        }
+    }
+
+    if (live > 0)
+    {
+        everUp = true;
+    }
+
+    if (!gapOpen && everUp && live == 0)
+    {
+        gapOpen = true;
+        gapStartMs = epochMs();
+        snprintf(buf, sizeof(buf), "START,%d,%lld", lastReason, (long long)gapStartMs);
+        marketPublisher.publishMessage("MARKET_DATA_GAP", buf);
+        zlog_warn(cat, "[main] 全部行情线路断开，发布缺口开始标记: %s", buf);
+    }
+    else if (gapOpen && live > 0)
+    {
+        gapOpen = false;
+        int64_t now = epochMs();
+        snprintf(buf, sizeof(buf), "END,%lld,%lld", (long long)(now - gapStartMs), (long long)now);
+        marketPublisher.publishMessage("MARKET_DATA_GAP", buf);
+        zlog_warn(cat, "[main] 行情恢复，发布缺口结束标记: %s", buf);
+    }
+}
+
+// 写入共享内存行情环，写端不会阻塞，读端落后由读端自行发现；quarantine非0为校验不通过的行情
+static void publishShm(const MarketTick& tick, uint32_t quarantine = 0)
+{
+    const CThostFtdcDepthMarketDataField& d = tick.data;
+    ShmTick out;
+    memset(&out, 0, sizeof(out));
+    out.LastPrice = d.LastPrice;
+    out.PreSettlementPrice = d.PreSettlementPrice;
+    out.PreClosePrice = d.PreClosePrice;
+    out.PreOpenInterest = d.PreOpenInterest;
+    out.OpenPrice = d.OpenPrice;
+    out.HighestPrice = d.HighestPrice;
+    out.LowestPrice = d.LowestPrice;
+    out.Turnover = d.Turnover;
+    out.OpenInterest = d.OpenInterest;
+    out.ClosePrice = d.ClosePrice;
+    out.SettlementPrice = d.SettlementPrice;
+    out.UpperLimitPrice = d.UpperLimitPrice;
+    out.LowerLimitPrice = d.LowerLimitPrice;
+    out.PreDelta = d.PreDelta;
+    out.CurrDelta = d.CurrDelta;
+    out.AveragePrice = d.AveragePrice;
+    out.BidPrice[0] = d.BidPrice1;
+    out.BidPrice[1] = d.BidPrice2;
+    out.BidPrice[2] = d.BidPrice3;
+    out.BidPrice[3] = d.BidPrice4;
+    out.BidPrice[4] = d.BidPrice5;
+    out.AskPrice[0] = d.AskPrice1;
+    out.AskPrice[1] = d.AskPrice2;
+    out.AskPrice[2] = d.AskPrice3;
+    out.AskPrice[3] = d.AskPrice4;
+    out.AskPrice[4] = d.AskPrice5;
+    out.BidVolume[0] = d.BidVolume1;
+    out.BidVolume[1] = d.BidVolume2;
+    out.BidVolume[2] = d.BidVolume3;
+    out.BidVolume[3] = d.BidVolume4;
+    out.BidVolume[4] = d.BidVolume5;
+    out.AskVolume[0] = d.AskVolume1;
+    out.AskVolume[1] = d.AskVolume2;
+    out.AskVolume[2] = d.AskVolume3;
+    out.AskVolume[3] = d.AskVolume4;
+    out.AskVolume[4] = d.AskVolume5;
+    out.Volume = d.Volume;
+    out.UpdateMillisec = d.UpdateMillisec;
+    memcpy(out.TradingDay, d.TradingDay, sizeof(out.TradingDay));
+    memcpy(out.ActionDay, d.ActionDay, sizeof(out.ActionDay));
+    memcpy(out.UpdateTime, d.UpdateTime, sizeof(out.UpdateTime));
+    memcpy(out.ExchangeID, d.ExchangeID, sizeof(out.ExchangeID));
+    memcpy(out.InstrumentID, d.InstrumentID, sizeof(out.InstrumentID));
+    memcpy(out.ExchangeInstID, d.ExchangeInstID, sizeof(out.ExchangeInstID));
+    out.recvNs = tick.recvNs;
+    out.recvWallNs = tick.recvWallNs;
+    out.publishNs = monotonicNs();
+    out.quarantine = quarantine;
+
+    shmRing->publish(out);
+    latShm.record(out.publishNs - tick.recvNs);
+}
+
+// 编码并发布一条行情，sent中已置位的主题跳过，发出的主题置位；返回false表示还有主题发送失败需要重试
+bool publishMarketData(const MarketTick& tick, uint32_t& sent)
+{
+    const CThostFtdcDepthMarketDataField& marketData = tick.data;
+
+    // 生成本地时间戳
+    std::string localTimestamp = ProtobufConverter::generateLocalTimestamp();
+
+    // 转换为protobuf格式
+    ctp::MarketDataMessage protoMessage = ProtobufConverter::convertToProtobuf(marketData, localTimestamp);
+
+    // 序列化为字节数组
+    std::string serializedData = ProtobufConverter::serializeToString(protoMessage);
+    if (serializedData.empty())
+    {
+        zlog_error(cat, "[main] protobuf序列化失败: %s", marketData.InstrumentID);
+        return true;
+    }
+    int64_t encodeNs = monotonicNs();
+
+    if (latencyTrace)
+    {
+        // 各阶段打点作为protobuf未知字段追加在末尾，订阅端据此统计端到端延迟
+        LatencyTrailer trailer;
+        trailer.stamps[STAGE_SPI_RECV] = tick.recvNs;
+        trailer.stamps[STAGE_DEQUEUE] = tick.dequeueNs;
+        trailer.stamps[STAGE_ENCODE] = encodeNs;
+        trailer.stamps[STAGE_SEND] = monotonicNs();
+        trailer.recvWallNs = tick.recvWallNs;
+        trailer.appendTo(serializedData);
+    }
+
+    // 通过ZMQ发布protobuf格式的行情数据
+    if (topicSingle && !(sent & TOPIC_SINGLE))
+    {
+        if (!marketPublisher.publishMessage("MARKET_DATA_PROTOBUF", serializedData))
+        {
+            metricPublishFailed.inc();
+            return false;
+        }
+        sent |= TOPIC_SINGLE;
+    }
+    if (topicInstrument && !(sent & TOPIC_INSTRUMENT))
+    {
+        // 按合约分主题，订阅端用前缀订阅只收关心的交易所/品种/合约
+        static string topic;
+        MarketTopic::build(marketData.ExchangeID, marketData.InstrumentID, topic);
+        if (!marketPublisher.publishMessage(topic, serializedData))
+        {
+            metricPublishFailed.inc();
+            return false;
+        }
+        sent |= TOPIC_INSTRUMENT;
+    }
+
+    int64_t sentNs = monotonicNs();
+    metricPublished.inc();
+    metricPublishLatency.observe((sentNs - tick.recvNs) / 1e9);
+    latQueue.record(tick.dequeueNs - tick.recvNs);
+    latEncode.record(encodeNs - tick.dequeueNs);
+    latSend.record(sentNs - encodeNs);
+    latTotal.record(sentNs - tick.recvNs);
+    int64_t exchangeNs = exchangeWallNs(marketData);
+    if (exchangeNs > 0)
+    {
+        latExchange.record(tick.recvWallNs - exchangeNs);
+    }
+    return true;
+}
+
+// 发布完成的K线，按周期过滤，可选落盘
+void publishKlines(vector<OHLCV>& bars, const vector<bool>& enabled, KlineFileWriter* writer)
+{
+    for (auto& bar: bars)
+    {
+        if (!enabled[bar.timeframe])
+        {
+            continue;
+        }
+        if (!marketPublisher.publishMessage(KlineEngine::topic(bar.timeframe), KlineEngine::toCsv(bar)))
+        {
+            zlog_error(cat, "[main] K线发布失败: %s %s", bar.symbol, KlineEngine::timeframeName(bar.timeframe));
+        }
+        if (writer)
+        {
+            writer->write(bar);
+        }
+    }
+    if (writer && !bars.empty())
+    {
+        writer->flush();
+    }
+    bars.clear();
+}
+
 void signal_handler(int signal)
 {
     std::cout << "收到信号 " << signal << "，准备退出..." << std::endl;
@@ -103,6 +402,21 @@ int main(int argc, char** argv)
         }
     }
     
+    if (!appConfig.md_replay_file.empty())
+    {
+        // 回放时订阅录制文件中的全部合约，否则不在列表里的记录都会被跳过
+        vector<string> recorded;
+        if (ReplayMdApi::scanInstruments(appConfig.md_replay_file, recorded) && !recorded.empty())
+        {
+            contracts.swap(recorded);
+            zlog_info(cat, "[main] 回放模式，按录制文件订阅 %zu 个合约", contracts.size());
+        }
+        else
+        {
+            zlog_warn(cat, "[main] 无法读取回放文件中的合约，使用默认订阅列表: %s", appConfig.md_replay_file.c_str());
+        }
+    }
+
     zlog_info(cat, "[main] 动态生成合约订阅列表，共 %zu 个合约", contracts.size());
     zlog_info(cat, "[main] 覆盖主要品种的活跃合约，确保接收广泛的行情数据");
     
@@ -113,96 +427,421 @@ int main(int argc, char** argv)
         zlog_info(cat, "[main] ... 还有 %zu 个合约", contracts.size() - 15);
     }
 
-    CTPMarketSpi mdspi;
-    if (mdspi.Create(appConfig))
+    // 每项为一路行情；未配置md_feeds时只使用md_server一路
+    vector<string> feedFronts = appConfig.md_feeds;
+    if (feedFronts.empty())
+    {
+        feedFronts.push_back("");
+    }
+
+    // 多路行情共享一张仲裁表，按合约只发布最先到达的行情
+    unique_ptr<TickArbiter> arbiter;
+    if (feedFronts.size() > 1)
+    {
+        arbiter.reset(new TickArbiter(contracts.size()));
+    }
+
+    // 交易时段日历：修正行情日期、K线时段归属
+    SessionCalendar calendar(appConfig.holidays);
+    latencyTrace = appConfig.latency_trace != 0;
+    // 回放时日期修正和K线收线按录制时的时间，不按当前墙钟
+    bool replaying = !appConfig.md_replay_file.empty();
+    time_t replayClock = 0;
+
+    // 行情主题：single为原有的单一主题，instrument为按合约分主题，both两种都发便于订阅端逐步切换
+    topicSingle = appConfig.md_topic_mode != "instrument";
+    topicInstrument = appConfig.md_topic_mode == "instrument" || appConfig.md_topic_mode == "both";
+    if (appConfig.md_topic_mode != "single" && !topicInstrument)
+    {
+        zlog_warn(cat, "[main] 未知的md_topic_mode: %s，使用single", appConfig.md_topic_mode.c_str());
+    }
+
+    // 行情发布方式，共享内存环创建失败时退回ZMQ
+    publishZmq = appConfig.md_transport != "shm";
+    if (appConfig.md_transport == "shm" || appConfig.md_transport == "both")
+    {
+        string shmError;
+        shmRing.reset(new ShmTickWriter());
+        if (shmRing->open(appConfig.md_shm_name, appConfig.md_shm_capacity, shmError))
+        {
+            zlog_info(cat, "[main] 共享内存行情环已就绪: /dev/shm/%s, %d slots, 已有序号 %llu",
+                      appConfig.md_shm_name.c_str(), appConfig.md_shm_capacity, (unsigned long long)shmRing->published());
+            ShmTickWriter* ring = shmRing.get();
+            metrics.counterFn("ctp_md_shm_published_total", "写入共享内存行情环的条数",
+                              [ring]() { return static_cast<double>(ring->published()); });
+        }
+        else
+        {
+            zlog_error(cat, "[main] 共享内存行情环创建失败: %s，改用ZMQ发布", shmError.c_str());
+            shmRing.reset();
+            publishZmq = true;
+        }
+    }
+    else if (appConfig.md_transport != "zmq")
+    {
+        zlog_warn(cat, "[main] 未知的md_transport: %s，使用zmq", appConfig.md_transport.c_str());
+    }
+
+    // 多周期K线合成，在主线程中随行情发布同步更新
+    KlineEngine klines(calendar, contracts.size(), appConfig.kline_ring_size);
+    klines.setFlushDelay(appConfig.kline_flush_delay_sec);
+    vector<bool> klinePublish(KlineEngine::TF_COUNT, false);
+    for (auto& name: appConfig.kline_publish)
+    {
+        int tf = KlineEngine::parseTimeframe(name);
+        if (tf < 0)
+        {
+            zlog_warn(cat, "[main] 未知K线周期: %s", name.c_str());
+            continue;
+        }
+        klinePublish[tf] = true;
+    }
+    unique_ptr<KlineFileWriter> klineWriter;
+    if (appConfig.kline_enable && !appConfig.kline_persist_dir.empty())
+    {
+        klineWriter.reset(new KlineFileWriter(appConfig.kline_persist_dir));
+    }
+    unique_ptr<KlineQueryServer> klineQuery;
+    if (appConfig.kline_enable && !appConfig.kline_query_addr.empty())
+    {
+        klineQuery.reset(new KlineQueryServer(klines, appConfig.kline_query_addr));
+        if (!klineQuery->start())
+        {
+            klineQuery.reset();
+        }
+    }
+    vector<OHLCV> bars;
+
+    // 行情校验：命中丢弃规则的tick发往隔离主题，其余规则只计数
+    unique_ptr<TickValidator> validator;
+    if (appConfig.tick_validate)
+    {
+        validator.reset(new TickValidator(calendar, contracts.size()));
+        uint32_t dropMask = 0;
+        for (auto& name: appConfig.tick_drop_rules)
+        {
+            int rule = TickValidator::parseRule(name);
+            if (rule < 0)
+            {
+                zlog_warn(cat, "[main] 未知行情校验规则: %s", name.c_str());
+                continue;
+            }
+            dropMask |= 1u << rule;
+        }
+        validator->setDropRules(dropMask);
+    }
+
+    // 录制原始行情，供ReplayMdApi离线回放
+    unique_ptr<TickRecorder> recorder;
+    if (!appConfig.md_record_dir.empty())
+    {
+        char name[64];
+        time_t start = time(nullptr);
+        strftime(name, sizeof(name), "/ticks_%Y%m%d_%H%M%S.bin", localtime(&start));
+        recorder.reset(new TickRecorder());
+        if (!recorder->open(appConfig.md_record_dir + name))
+        {
+            recorder.reset();
+        }
+    }
+
+    vector<unique_ptr<CTPMarketSpi>> feeds;
+    for (size_t i = 0; i < feedFronts.size(); ++i)
+    {
+        string fronts = feedFronts[i];
+        replace(fronts.begin(), fronts.end(), '|', ',');
+
+        unique_ptr<CTPMarketSpi> spi(new CTPMarketSpi(static_cast<int>(i)));
+        spi->setArbiter(arbiter.get());
+        if (spi->Create(appConfig, fronts))
+        {
+            feeds.push_back(move(spi));
+        }
+        else
+        {
+            zlog_error(cat, "[main] 行情[%zu]API创建失败.", i);
+        }
+    }
+
+    // 各路行情的指标：SPI线程维护的计数器是原子量，导出时直接读取；队列深度由主线程每轮更新
+    vector<MetricGauge*> metricQueueDepth;
+    for (auto& feed: feeds)
     {
-        zlog_info(cat, "[main] 行情API创建成功，开始订阅行情...");
+        CTPMarketSpi* spi = feed.get();
+        string label = "feed=\"" + to_string(spi->feedId()) + "\"";
+        metrics.counterFn("ctp_md_ticks_received_total", "SPI收到的行情条数",
+                          [spi]() { return static_cast<double>(spi->received()); }, label);
+        metrics.counterFn("ctp_md_ticks_dropped_total", "丢弃的行情条数",
+                          [spi]() { return static_cast<double>(spi->dropped()); }, label + ",reason=\"queue_full\"");
+        metrics.counterFn("ctp_md_reconnects_total", "断线后重新登录成功的次数",
+                          [spi]() { return static_cast<double>(spi->connection().stats().reconnectCount); }, label);
+        metrics.counterFn("ctp_md_disconnects_total", "前置断线次数",
+                          [spi]() { return static_cast<double>(spi->connection().stats().disconnectCount); }, label);
+        metrics.gaugeFn("ctp_md_front_logged_in", "前置是否已登录",
+                        [spi]() { return spi->connection().isLoggedIn() ? 1.0 : 0.0; }, label);
+        metricQueueDepth.push_back(&metrics.gauge("ctp_md_queue_depth", "SPI到主线程的行情队列深度", label));
+    }
+    if (arbiter)
+    {
+        TickArbiter* arb = arbiter.get();
+        metrics.counterFn("ctp_md_ticks_dropped_total", "丢弃的行情条数",
+                          [arb]() { return static_cast<double>(arb->duplicates()); }, "reason=\"duplicate\"");
+    }
+    // 校验计数只在主线程中更新，每秒同步一次
+    vector<MetricCounter*> metricRuleHits;
+    if (validator)
+    {
+        for (int rule = 0; rule < TickValidator::RULE_COUNT; ++rule)
+        {
+            metricRuleHits.push_back(&metrics.counter("ctp_md_validation_hits_total", "行情校验规则命中次数",
+                                                      string("rule=\"") + TickValidator::ruleName(rule) + "\""));
+        }
+    }
+    unique_ptr<MetricsHttpServer> metricsServer;
+    if (appConfig.market_metrics_port > 0)
+    {
+        metricsServer.reset(new MetricsHttpServer(metrics));
+        if (metricsServer->start(appConfig.metrics_bind, appConfig.market_metrics_port))
+        {
+            zlog_info(cat, "[main] 指标服务已启动: http://%s:%d/metrics", appConfig.metrics_bind.c_str(),
+                      appConfig.market_metrics_port);
+        }
+        else
+        {
+            zlog_warn(cat, "[main] 指标服务启动失败: %s", metricsServer->lastError().c_str());
+            metricsServer.reset();
+        }
+    }
+
+    if (!feeds.empty())
+    {
+        zlog_info(cat, "[main] 行情API创建成功，共 %zu 路，开始订阅行情...", feeds.size());
         
-        chrono::seconds dura(1);
-        CThostFtdcDepthMarketDataField marketData;
+        chrono::milliseconds dura(1);
+        const size_t kBatchSize = 256;
+        vector<MarketTick> batch(kBatchSize);
+        vector<uint32_t> masks(kBatchSize, 0);
         int messageCount = 0;
+        time_t lastStatTs = time(nullptr);
+        time_t lastFlushTs = lastStatTs;
+        time_t lastRecordFlushTs = lastStatTs;
+        time_t lastMetricTs = lastStatTs;
         
         zlog_info(cat, "[main] 开始行情数据处理循环（使用protobuf格式）");
+        string threadError;
+        if (!ThreadTuning::global().apply("md_main", "md_main", threadError))
+        {
+            zlog_warn(cat, "[main] 主线程设置失败: %s", threadError.c_str());
+        }
         
         for (;;)
         {
             time_t now = time(nullptr);
-            if (mdspi.exitTs < now)
+            if (feeds[0]->exitTs < now)
             {
                 zlog_info(cat, "[main] 到达退出时间，程序结束");
                 break;
             }
 
-            // 处理缓存队列中的消息
-            while (bufq.try_dequeue(marketData))
+            for (auto& feed: feeds)
             {
-                // 生成本地时间戳
-                std::string localTimestamp = ProtobufConverter::generateLocalTimestamp();
-                
-                // 转换为protobuf格式
-                ctp::MarketDataMessage protoMessage = ProtobufConverter::convertToProtobuf(marketData, localTimestamp);
-                
-                // 序列化为字节数组
-                std::string serializedData = ProtobufConverter::serializeToString(protoMessage);
-                
-                if (!serializedData.empty()) {
-                    // 通过ZMQ发布protobuf格式的行情数据
-                    if (marketPublisher.publishMessage("MARKET_DATA_PROTOBUF", serializedData)) {
+                // 登录重试/前置切换
+                feed->pollConnection();
+                // 分批发送尚未完成的订阅请求（受每秒请求数限制）
+                feed->pumpSubscriptions();
+            }
+            // 向订阅端发布断线缺口标记
+            publishGapMarkers(feeds);
+
+            // 从队首重发缓存的消息，发送失败时留在队首等待下一轮，不打乱顺序
+            while (RetryTick* pending = bufq.peek())
+            {
+                if (!publishMarketData(pending->tick, pending->sent))
+                {
+                    break;
+                }
+                bufq.pop();
+                messageCount++;
+            }
+
+            // 轮流处理各路行情队列中的消息，每路每轮最多处理一批，避免单路饿死其它线路
+            bool idle = true;
+            for (auto& feed: feeds)
+            {
+                size_t n = 0;
+                while (n < kBatchSize && feed->queue().try_dequeue(batch[n]))
+                {
+                    batch[n].dequeueNs = monotonicNs();
+                    if (recorder)
+                    {
+                        // 录制日期修正前的原始数据
+                        recorder->write(batch[n].data, batch[n].eventWallNs, feed->feedId());
+                    }
+                    time_t tickNow = now;
+                    if (replaying)
+                    {
+                        tickNow = static_cast<time_t>(batch[n].eventWallNs / 1000000000LL);
+                        replayClock = max(replayClock, tickNow);
+                    }
+                    // 统一ActionDay为自然日、TradingDay为交易日（大商所/郑商所夜盘不一致）
+                    calendar.fixDates(batch[n].data, tickNow);
+                    if (batch[n].data.ExchangeID[0] == '\0')
+                    {
+                        // 部分前置的行情不带交易所，按品种表补齐，否则按交易所订阅/过滤的下游收不到
+                        const SessionCalendar::Product* product = calendar.product(batch[n].data.InstrumentID);
+                        if (product)
+                        {
+                            strncpy(batch[n].data.ExchangeID, product->exchange, sizeof(batch[n].data.ExchangeID) - 1);
+                        }
+                    }
+                    ++n;
+                }
+                if (n == 0)
+                {
+                    continue;
+                }
+                idle = false;
+
+                if (validator)
+                {
+                    validator->check(batch.data(), n, masks.data());
+                }
+                for (size_t i = 0; i < n; ++i)
+                {
+                    MarketTick& tick = batch[i];
+                    if (validator && validator->shouldDrop(masks[i]))
+                    {
+                        // 坏数据不参与K线、不进入数据库，按正常行情的发布方式发往隔离主题/带隔离标记写入共享内存环
+                        if (publishZmq)
+                        {
+                            marketPublisher.publishMessage("MARKET_DATA_QUARANTINE", TickValidator::toCsv(tick.data, masks[i]));
+                        }
+                        if (shmRing)
+                        {
+                            publishShm(tick, masks[i]);
+                        }
+                        metricQuarantined.inc();
+                        continue;
+                    }
+                    if (appConfig.kline_enable)
+                    {
+                        klines.onTick(tick.data, bars,
+                                      replaying ? static_cast<time_t>(tick.eventWallNs / 1000000000LL) : now);
+                    }
+                    if (shmRing)
+                    {
+                        publishShm(tick);
+                    }
+                    // 缓存队列里还有未发出的行情时排在后面，不插队
+                    RetryTick retry;
+                    retry.sent = 0;
+                    if (!publishZmq || (bufq.peek() == nullptr && publishMarketData(tick, retry.sent)))
+                    {
                         messageCount++;
                         if (messageCount % 1000 == 0) {
                             zlog_info(cat, "[main] 已发布 %d 条protobuf行情数据", messageCount);
                         }
-                    } else {
-                        // 发送失败，重新放回缓存队列
-                        if (!bufq.try_enqueue(marketData))
+                    }
+                    else
+                    {
+                        // 发送失败，放入缓存队列
+                        retry.tick = tick;
+                        if (!bufq.try_enqueue(retry))
                         {
-                            zlog_error(cat, "[main] 缓存队列已满，丢弃消息: %s", marketData.InstrumentID);
+                            metricBufqDropped.inc();
+                            zlog_error(cat, "[main] 缓存队列已满，丢弃消息: %s", tick.data.InstrumentID);
                         }
                     }
-                } else {
-                    zlog_error(cat, "[main] protobuf序列化失败: %s", marketData.InstrumentID);
                 }
             }
 
-            // 处理主队列中的消息
-            if (!q.try_dequeue(marketData))
+            if (appConfig.kline_enable)
             {
-                this_thread::sleep_for(dura);
-                continue;
+                // 不活跃合约没有下一条tick触发收线，每秒按墙钟检查一次；回放时按已回放到的录制时间
+                time_t klineNow = replaying ? replayClock : now;
+                if (klineNow != lastFlushTs && klineNow > 0)
+                {
+                    lastFlushTs = klineNow;
+                    klines.flush(klineNow, bars);
+                }
+                if (!bars.empty())
+                {
+                    publishKlines(bars, klinePublish, klineWriter.get());
+                }
+                if (klineQuery && klineQuery->poll() > 0)
+                {
+                    idle = false;
+                }
             }
 
-            // 添加调试日志：记录从主队列取出数据
-            zlog_info(cat, "[main] 从主队列取出行情数据: %s, 最新价: %.2f", 
-                      marketData.InstrumentID ? marketData.InstrumentID : "Unknown",
-                      marketData.LastPrice);
-
-            // 生成本地时间戳
-            std::string localTimestamp = ProtobufConverter::generateLocalTimestamp();
-            
-            // 转换为protobuf格式
-            ctp::MarketDataMessage protoMessage = ProtobufConverter::convertToProtobuf(marketData, localTimestamp);
-            
-            // 序列化为字节数组
-            std::string serializedData = ProtobufConverter::serializeToString(protoMessage);
-            
-            if (!serializedData.empty()) {
-                // 通过ZMQ发布protobuf格式的行情数据
-                if (marketPublisher.publishMessage("MARKET_DATA_PROTOBUF", serializedData)) {
-                    messageCount++;
-                    zlog_info(cat, "[main] 成功发布行情数据到ZMQ: %s, 消息计数: %d", 
-                              marketData.InstrumentID ? marketData.InstrumentID : "Unknown", messageCount);
-                    if (messageCount % 1000 == 0) {
-                        zlog_info(cat, "[main] 已发布 %d 条protobuf行情数据", messageCount);
-                    }
-                } else {
-                    // 发送失败，放入缓存队列
-                    if (!bufq.try_enqueue(marketData))
+            for (size_t i = 0; i < feeds.size(); ++i)
+            {
+                metricQueueDepth[i]->set(static_cast<int64_t>(feeds[i]->queue().size_approx()));
+            }
+            metricBufqDepth.set(static_cast<int64_t>(bufq.size_approx()));
+            if (validator && now != lastMetricTs)
+            {
+                lastMetricTs = now;
+                for (int rule = 0; rule < TickValidator::RULE_COUNT; ++rule)
+                {
+                    metricRuleHits[rule]->set(validator->hits(rule));
+                }
+            }
+
+            if (recorder && now != lastRecordFlushTs)
+            {
+                lastRecordFlushTs = now;
+                recorder->flush();
+            }
+
+            if (now - lastStatTs >= 60)
+            {
+                lastStatTs = now;
+                for (auto& feed: feeds)
+                {
+                    zlog_info(cat, "[main] 行情[%d] 收到 %llu 条，队列满丢弃 %llu 条", feed->feedId(),
+                              (unsigned long long)feed->received(), (unsigned long long)feed->dropped());
+                }
+                if (arbiter)
+                {
+                    zlog_info(cat, "[main] 多路仲裁 发布 %llu 条，重复丢弃 %llu 条",
+                              (unsigned long long)arbiter->accepted(), (unsigned long long)arbiter->duplicates());
+                }
+                if (appConfig.kline_enable)
+                {
+                    zlog_info(cat, "[main] K线 合约 %zu 个，完成 %llu 根，迟到tick %llu 条", klines.instruments(),
+                              (unsigned long long)klines.barsCompleted(), (unsigned long long)klines.lateTicks());
+                }
+                if (recorder)
+                {
+                    zlog_info(cat, "[main] 行情录制 %llu 条: %s", (unsigned long long)recorder->records(),
+                              recorder->path().c_str());
+                }
+                if (validator)
+                {
+                    string hits;
+                    for (int rule = 0; rule < TickValidator::RULE_COUNT; ++rule)
                     {
-                        zlog_error(cat, "[main] 缓存队列已满，丢弃消息: %s", marketData.InstrumentID);
+                        hits += string(" ") + TickValidator::ruleName(rule) + "=" + to_string(validator->hits(rule));
                     }
+                    zlog_info(cat, "[main] 行情校验 %llu 条，丢弃 %llu 条，规则命中:%s", (unsigned long long)validator->checked(),
+                              (unsigned long long)validator->dropped(), hits.c_str());
+                }
+
+                // 各阶段延迟，日志一份，同时以CSV发布给订阅端(stage,count,p50,p90,p99,p999,max,mean，单位us)
+                string latencyCsv;
+                for (LatencyHistogram* hist: {&latExchange, &latQueue, &latEncode, &latSend, &latTotal, &latShm})
+                {
+                    LatencyHistogram::Summary s = hist->summarize(true);
+                    zlog_info(cat, "[main] 延迟 %s", LatencyHistogram::format(hist->name(), s).c_str());
+                    latencyCsv += LatencyHistogram::toCsv(hist->name(), s) + "\n";
                 }
-            } else {
-                zlog_error(cat, "[main] protobuf序列化失败: %s", marketData.InstrumentID);
+                marketPublisher.publishMessage("LATENCY_STATS", latencyCsv);
+            }
+
+            if (idle)
+            {
+                this_thread::sleep_for(dura);
             }
         }
         
@@ -216,7 +855,19 @@ int main(int argc, char** argv)
         return -1;
     }
 
-    mdspi.Destroy();
+    // 指标回调引用了各路行情对象，先停止导出
+    if (metricsServer)
+    {
+        metricsServer->stop();
+    }
+    for (auto& feed: feeds)
+    {
+        feed->Destroy();
+    }
+    if (recorder)
+    {
+        recorder->close();
+    }
     marketPublisher.disconnect();
     zlog_info(cat, "[main] 行情订阅程序正常退出");
     zlog_fini();
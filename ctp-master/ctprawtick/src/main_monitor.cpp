@@ -12,6 +12,9 @@
 #include "zlog.h"
 #include "utils.h"
 #include "CTPTrader.h"
+#include "SessionCalendar.h"
+#include "MetricsRegistry.h"
+#include "ThreadTuning.h"
 #include "Config.h"
 #include <signal.h>
 
@@ -32,6 +35,19 @@ atomic<bool> ctpConnected(false);
 // CTP交易接口实例
 CTPTraderSpi* tdspi = nullptr;
 CAppConfig* appConfig = nullptr;
+// 交易时段日历，节假日在读取配置后设置
+SessionCalendar calendar;
+
+// 运行指标，由HTTP /metrics导出
+MetricsRegistry metrics;
+MetricCounter& positionQueryOk = metrics.counter("ctp_td_queries_total", "查询次数", "query=\"position\",result=\"ok\"");
+MetricCounter& positionQueryTimeout = metrics.counter("ctp_td_queries_total", "查询次数", "query=\"position\",result=\"timeout\"");
+MetricCounter& accountQueryOk = metrics.counter("ctp_td_queries_total", "查询次数", "query=\"account\",result=\"ok\"");
+MetricCounter& accountQueryTimeout = metrics.counter("ctp_td_queries_total", "查询次数", "query=\"account\",result=\"timeout\"");
+MetricHistogram& positionQueryDuration = metrics.histogram("ctp_td_query_duration_seconds", "查询发出到回报结束的耗时",
+                                                           MetricHistogram::exponential(0.01, 2, 10), "query=\"position\"");
+MetricHistogram& accountQueryDuration = metrics.histogram("ctp_td_query_duration_seconds", "查询发出到回报结束的耗时",
+                                                          MetricHistogram::exponential(0.01, 2, 10), "query=\"account\"");
 
 string getCurrentTimeString() {
     auto now = chrono::system_clock::now();
@@ -44,37 +60,23 @@ string getCurrentTimeString() {
     return ss.str();
 }
 
-bool isInTradingSession() {
-    time_t now = time(0);
-    tm* ltm = localtime(&now);
-    int hour = ltm->tm_hour;
-    int minute = ltm->tm_min;
-    int timeInMinutes = hour * 60 + minute;
-    
-    // 交易时间段
-    // 日盘：9:00-15:00
-    // 夜盘：21:00-次日2:30
-    int day_start = 9 * 60;           // 9:00
-    int day_end = 15 * 60;            // 15:00
-    int night_start = 21 * 60;        // 21:00
-    int night_end = 2 * 60 + 30;      // 2:30 (次日)
-    
-    // 白天交易时间
-    if (timeInMinutes >= day_start && timeInMinutes <= day_end) {
-        return true;
-    }
-    
-    // 夜盘交易时间（跨日）
-    if (timeInMinutes >= night_start || timeInMinutes <= night_end) {
-        return true;
+// 监控线程共用monitor角色，线程名区分用途
+void tuneThread(const char* name) {
+    string error;
+    if (!ThreadTuning::global().apply("monitor", name, error)) {
+        zlog_warn(cat, "[tuneThread] %s 线程设置失败: %s", name, error.c_str());
     }
-    
-    return false;
+}
+
+bool isInTradingSession() {
+    // 任一品种处于交易时段即视为交易中（已考虑周末、节假日与长假前无夜盘）
+    return calendar.isTrading(time(nullptr));
 }
 
 // 持仓查询线程
 void positionQueryThread() {
     zlog_info(cat, "[positionQueryThread] 持仓查询线程启动");
+    tuneThread("mon_position");
     
     auto lastQueryTime = chrono::steady_clock::now();
     const auto queryInterval = chrono::seconds(30); // 30秒查询一次
@@ -91,6 +93,7 @@ void positionQueryThread() {
                 isPositionReady = false;
                 
                 // 发起持仓查询
+                auto queryStart = chrono::steady_clock::now();
                 tdspi->ReqInvestorPositions();
                 
                 // 等待查询完成（最多等待10秒）
@@ -99,8 +102,11 @@ void positionQueryThread() {
                 lock.unlock();
                 
                 if (success) {
+                    positionQueryOk.inc();
+                    positionQueryDuration.observe(chrono::duration<double>(chrono::steady_clock::now() - queryStart).count());
                     zlog_info(cat, "[positionQueryThread] 持仓查询完成");
                 } else {
+                    positionQueryTimeout.inc();
                     zlog_warn(cat, "[positionQueryThread] 持仓查询超时");
                 }
                 
@@ -121,6 +127,7 @@ void positionQueryThread() {
 // 资金查询线程
 void accountQueryThread() {
     zlog_info(cat, "[accountQueryThread] 资金查询线程启动");
+    tuneThread("mon_account");
     
     auto lastQueryTime = chrono::steady_clock::now();
     const auto queryInterval = chrono::seconds(10); // 10秒查询一次
@@ -137,6 +144,7 @@ void accountQueryThread() {
                 isTradingAccountReady = false;
                 
                 // 发起资金查询
+                auto queryStart = chrono::steady_clock::now();
                 tdspi->ReqTradingAccount();
                 
                 // 等待查询完成（最多等待5秒）
@@ -145,8 +153,11 @@ void accountQueryThread() {
                 lock.unlock();
                 
                 if (success) {
+                    accountQueryOk.inc();
+                    accountQueryDuration.observe(chrono::duration<double>(chrono::steady_clock::now() - queryStart).count());
                     zlog_info(cat, "[accountQueryThread] 资金查询完成");
                 } else {
+                    accountQueryTimeout.inc();
                     zlog_warn(cat, "[accountQueryThread] 资金查询超时");
                 }
                 
@@ -167,19 +178,34 @@ void accountQueryThread() {
 // 连接监控线程
 void connectionMonitorThread() {
     zlog_info(cat, "[connectionMonitorThread] 连接监控线程启动");
+    tuneThread("mon_conn");
     
     while (running) {
         if (tdspi) {
-            // 这里可以添加连接状态检查逻辑
-            // 暂时假设连接正常
-            if (!ctpConnected) {
-                ctpConnected = true;
-                zlog_info(cat, "[connectionMonitorThread] CTP连接已建立");
+            // 登录重试与前置切换
+            tdspi->pollConnection();
+
+            bool loggedIn = tdspi->isLoggedIn();
+            if (loggedIn != ctpConnected) {
+                ctpConnected = loggedIn;
+                zlog_info(cat, "[connectionMonitorThread] CTP连接状态: %s", loggedIn ? "已登录" : "已断开");
+            }
+
+            int reason = 0;
+            int64_t gapMs = 0;
+            int64_t ts = 0;
+            if (tdspi->connection().takeGapStart(reason, ts)) {
+                zlog_warn(cat, "[connectionMonitorThread] 交易前置断开，原因: %d", reason);
+            }
+            if (tdspi->connection().takeGapEnd(gapMs, ts)) {
+                FrontConnection::Stats st = tdspi->connection().stats();
+                zlog_warn(cat, "[connectionMonitorThread] 交易重连成功，缺口 %lld ms，累计重连 %llu 次，最长 %lld ms",
+                         (long long)gapMs, (unsigned long long)st.reconnectCount, (long long)st.maxGapMs);
             }
         }
         
-        // 每5秒检查一次连接状态
-        this_thread::sleep_for(chrono::seconds(5));
+        // 每秒检查一次连接状态
+        this_thread::sleep_for(chrono::seconds(1));
     }
     
     zlog_info(cat, "[connectionMonitorThread] 连接监控线程退出");
@@ -215,14 +241,33 @@ int main(int argc, char** argv) {
 
     zlog_info(cat, "[main] ========== 持仓资金监控器启动 ==========");
     zlog_info(cat, "[main] 当前时间: %s", getCurrentTimeString().c_str());
-    zlog_info(cat, "[main] 交易时间状态: %s", isInTradingSession() ? "交易中" : "非交易时间");
-
     // 创建配置和交易接口
     appConfig = new CAppConfig();
+    calendar.setHolidays(appConfig->holidays);
+    zlog_info(cat, "[main] 交易时间状态: %s", isInTradingSession() ? "交易中" : "非交易时间");
+
     tdspi = new CTPTraderSpi();
     
     if (tdspi->Create(*appConfig)) {
         zlog_info(cat, "[main] 交易API创建成功");
+
+        // 连接相关指标在导出时从状态机读取
+        metrics.gaugeFn("ctp_td_connected", "交易前置是否已登录", [] { return ctpConnected ? 1.0 : 0.0; });
+        metrics.counterFn("ctp_td_reconnects_total", "断线后重新登录成功的次数",
+                          [] { return static_cast<double>(tdspi->connection().stats().reconnectCount); });
+        metrics.counterFn("ctp_td_disconnects_total", "前置断线次数",
+                          [] { return static_cast<double>(tdspi->connection().stats().disconnectCount); });
+        metrics.counterFn("ctp_td_login_failures_total", "登录失败次数",
+                          [] { return static_cast<double>(tdspi->connection().stats().loginFailCount); });
+        MetricsHttpServer metricsServer(metrics);
+        if (appConfig->monitor_metrics_port > 0) {
+            if (metricsServer.start(appConfig->metrics_bind, appConfig->monitor_metrics_port)) {
+                zlog_info(cat, "[main] 指标服务已启动: http://%s:%d/metrics", appConfig->metrics_bind.c_str(),
+                          appConfig->monitor_metrics_port);
+            } else {
+                zlog_warn(cat, "[main] 指标服务启动失败: %s", metricsServer.lastError().c_str());
+            }
+        }
         
         // 启动监控线程
         thread positionThread(positionQueryThread);
@@ -251,6 +296,7 @@ int main(int argc, char** argv) {
         
         zlog_info(cat, "[main] 所有监控线程已停止");
         
+        metricsServer.stop();
         tdspi->Destroy();
         delete tdspi;
         delete appConfig;
@@ -0,0 +1,190 @@
+// 订阅端写库链路的微基准：CSV行情解析、数据库格式转换、批量写库
+// 运行: bench_subscriber --benchmark_out=bench_subscriber.json --benchmark_out_format=json
+// 或者在构建目录执行 make bench，结果写到构建目录下的bench_subscriber.json
+//
+// 批量写库直接调用DatabaseManager::insertMarketDataBatch，只在设置环境变量BENCH_MYSQL_HOST
+// （及BENCH_MYSQL_PORT/USER/PASSWORD/DB）后运行，会向该库的market_data表写入数据，请使用测试库。
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <benchmark/benchmark.h>
+#include "MarketDataConverter.h"
+#include "DatabaseManager.h"
+#include "TickArchive.h"
+
+// 按ctprawtick发布的CSV行情格式构造一条消息: 主题||44个字段
+static std::string makeCsvTick(int seq) {
+    double px = 3500 + seq % 100;
+    char buf[1024];
+    snprintf(buf, sizeof(buf),
+             "EL/CTP_TICKER/rb2510/T/1||20250805,rb2510,SHFE,rb2510,%.1f,3480,3485,1500000,3490,3620,3470,%d,%.1f,%d,"
+             "0,0,3758,3202,0,0,%02d:%02d:%02d,%d,"
+             "%.1f,%d,%.1f,%d,%.1f,%d,%.1f,%d,%.1f,%d,%.1f,%d,%.1f,%d,%.1f,%d,%.1f,%d,%.1f,%d,%.1f,20250805",
+             px, 100000 + seq, (100000 + seq) * px * 10, 1500000 + seq % 1000,
+             9 + seq / 3600 % 6, seq / 60 % 60, seq % 60, (seq % 2) * 500,
+             px - 1, 10 + seq % 50, px + 1, 20 + seq % 30, px - 2, 11, px + 2, 21, px - 3, 12, px + 3, 22,
+             px - 4, 13, px + 4, 23, px - 5, 14, px + 5, 24, px * 10);
+    return buf;
+}
+
+// 一批数据库格式的行情字符串，与ZMQSubscriber::flushMarketDataBuffer传给insertMarketDataBatch的一致
+static std::vector<std::string> makeDatabaseRows(size_t count) {
+    std::vector<std::string> rows;
+    rows.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        rows.push_back(MarketDataConverter::convertToDatabaseFormat(MarketDataConverter::parseCSV(makeCsvTick(static_cast<int>(i)))));
+    }
+    return rows;
+}
+
+// CSV行情解析为CTPMarketDataField
+static void BM_ParseCSV(benchmark::State& state) {
+    std::string csv = makeCsvTick(1);
+    for (auto _ : state) {
+        CTPMarketDataField field = MarketDataConverter::parseCSV(csv);
+        benchmark::DoNotOptimize(field);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * csv.size());
+}
+BENCHMARK(BM_ParseCSV);
+
+// 不分配内存的解析，结果结构跨消息复用，与ZMQSubscriber处理CSV行情时相同
+static void BM_ParseCSVInPlace(benchmark::State& state) {
+    std::vector<std::string> rows;
+    for (int i = 0; i < 1024; ++i) {
+        rows.push_back(makeCsvTick(i));
+    }
+    CTPMarketDataField field = {};
+    size_t i = 0;
+    int64_t bytes = 0;
+    for (auto _ : state) {
+        const std::string& csv = rows[i++ & 1023];
+        benchmark::DoNotOptimize(MarketDataConverter::parseCSV(csv.data(), csv.size(), field));
+        bytes += csv.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_ParseCSVInPlace);
+
+// CTPMarketDataField转为写库用的字符串
+static void BM_ConvertToDatabaseFormat(benchmark::State& state) {
+    CTPMarketDataField field = MarketDataConverter::parseCSV(makeCsvTick(1));
+    for (auto _ : state) {
+        std::string row = MarketDataConverter::convertToDatabaseFormat(field);
+        benchmark::DoNotOptimize(row);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConvertToDatabaseFormat);
+
+// 归档读取：一个合约一天的数据块解码为ArchiveTick，bytes为解码输出的字节数
+static void BM_TickArchiveDecode(benchmark::State& state) {
+    const int rows = static_cast<int>(state.range(0));
+    std::vector<ArchiveTick> ticks(rows);
+    for (int i = 0; i < rows; ++i) {
+        CTPMarketDataField f = MarketDataConverter::parseCSV(makeCsvTick(i));
+        ArchiveTick& t = ticks[i];
+        t.ActionDay = 20250805;
+        t.TimeMs = 9 * 3600000 + i * 500;
+        t.Volume = f.Volume;
+        t.Turnover = f.Turnover;
+        t.OpenInterest = f.OpenInterest;
+        t.LastPrice = f.LastPrice;
+        double bid[5] = {f.BidPrice1, f.BidPrice2, f.BidPrice3, f.BidPrice4, f.BidPrice5};
+        double ask[5] = {f.AskPrice1, f.AskPrice2, f.AskPrice3, f.AskPrice4, f.AskPrice5};
+        int bidVol[5] = {f.BidVolume1, f.BidVolume2, f.BidVolume3, f.BidVolume4, f.BidVolume5};
+        int askVol[5] = {f.AskVolume1, f.AskVolume2, f.AskVolume3, f.AskVolume4, f.AskVolume5};
+        for (int l = 0; l < 5; ++l) {
+            t.BidPrice[l] = bid[l];
+            t.AskPrice[l] = ask[l];
+            t.BidVolume[l] = bidVol[l];
+            t.AskVolume[l] = askVol[l];
+        }
+        t.OpenPrice = f.OpenPrice;
+        t.HighestPrice = f.HighestPrice;
+        t.LowestPrice = f.LowestPrice;
+        t.ClosePrice = f.ClosePrice;
+        t.SettlementPrice = f.SettlementPrice;
+        t.UpperLimitPrice = f.UpperLimitPrice;
+        t.LowerLimitPrice = f.LowerLimitPrice;
+        t.PreSettlementPrice = f.PreSettlementPrice;
+        t.PreClosePrice = f.PreClosePrice;
+        t.PreOpenInterest = f.PreOpenInterest;
+        t.AveragePrice = f.AveragePrice;
+    }
+
+    std::string error;
+    std::string path = "bench_archive.tck";
+    TickArchiveWriter writer;
+    if (!writer.open(path, "20250805", error) || !writer.writeBlock("rb2510", "SHFE", ticks, error) || !writer.finish(error)) {
+        state.SkipWithError(error.c_str());
+        return;
+    }
+    TickArchiveReader reader;
+    if (!reader.open(path, error)) {
+        state.SkipWithError(error.c_str());
+        return;
+    }
+    remove(path.c_str());
+
+    std::vector<ArchiveTick> out;
+    for (auto _ : state) {
+        reader.readBlock(0, out, error);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.counters["bytes_per_tick"] = static_cast<double>(writer.getStoredBytes()) / rows;
+    state.SetItemsProcessed(state.iterations() * rows);
+    state.SetBytesProcessed(state.iterations() * rows * sizeof(ArchiveTick));
+}
+BENCHMARK(BM_TickArchiveDecode)->Arg(40000)->Unit(benchmark::kMicrosecond);
+
+static std::string envOr(const char* name, const std::string& def) {
+    const char* value = std::getenv(name);
+    return value ? value : def;
+}
+
+static void BM_InsertMarketDataBatchMySQL(benchmark::State& state, std::shared_ptr<DatabaseManager> db) {
+    std::vector<std::string> rows = makeDatabaseRows(static_cast<size_t>(state.range(0)));
+    // insertMarketDataBatch每批打印一行结果，计时期间关掉标准输出
+    std::streambuf* saved = std::cout.rdbuf(nullptr);
+    for (auto _ : state) {
+        bool ok = db->insertMarketDataBatch(rows);
+        benchmark::DoNotOptimize(ok);
+    }
+    std::cout.rdbuf(saved);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    // 有MySQL测试库时注册真实写库基准
+    std::shared_ptr<DatabaseManager> db;
+    if (std::getenv("BENCH_MYSQL_HOST")) {
+        db = std::make_shared<DatabaseManager>(envOr("BENCH_MYSQL_HOST", "localhost"),
+                                               std::stoi(envOr("BENCH_MYSQL_PORT", "3306")),
+                                               envOr("BENCH_MYSQL_USER", "root"),
+                                               envOr("BENCH_MYSQL_PASSWORD", ""),
+                                               envOr("BENCH_MYSQL_DB", "ctp_bench"));
+        if (db->connect()) {
+            benchmark::RegisterBenchmark("BM_InsertMarketDataBatchMySQL", BM_InsertMarketDataBatchMySQL, db)
+                ->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+        } else {
+            std::cerr << "MySQL连接失败，跳过MySQL写库基准" << std::endl;
+        }
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
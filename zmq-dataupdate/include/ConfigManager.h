@@ -3,6 +3,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 class ConfigManager {
 private:
@@ -17,6 +18,8 @@ public:
     std::string getValue(const std::string& key, const std::string& defaultValue = "");
     int getIntValue(const std::string& key, int defaultValue = 0);
     bool getBoolValue(const std::string& key, bool defaultValue = false);
+    // 逗号分隔的列表，去除空格和空项
+    std::vector<std::string> getListValue(const std::string& key);
     
     // 获取常用配置项
     std::string getZMQAddress() { return getValue("zmq.address", "tcp://localhost:8888"); }
@@ -27,6 +30,9 @@ public:
     std::string getDBName() { return getValue("database.name", "test"); }
     std::string getLogFile() { return getValue("log.file", "zmq_subscriber.log"); }
     int getLogLevel() { return getIntValue("log.level", 1); }
+    
+    // 线程角色配置: thread.<角色>=cpus=..;prio=..;numa=..，返回"角色:配置"列表
+    std::vector<std::string> getThreadSpecs();
 };
 
 #endif // CONFIG_MANAGER_H 
\ No newline at end of file
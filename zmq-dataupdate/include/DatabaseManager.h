@@ -4,11 +4,15 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <utility>
+#include <cstdint>
 #include <mysql_driver.h>
 #include <mysql_connection.h>
 #include <cppconn/prepared_statement.h>
 #include <cppconn/resultset.h>
 #include <cppconn/statement.h>
+#include "InstrumentConverter.h"
+#include "MarketDataConverter.h"
 
 class DatabaseManager {
 private:
@@ -49,8 +53,13 @@ public:
                          const std::string& underlyingInstrId, double strikePrice, char optionsType,
                          double underlyingMultiple, char combinationType);
     
-    // 批量插入合约信息
-    bool insertInstrumentBatch(const std::vector<std::vector<std::string>>& instruments);
+    // 批量插入合约信息，已存在则更新，每条语句最多rowsPerStatement行
+    bool insertInstrumentBatch(const std::vector<CTPInstrumentField>& instruments, size_t rowsPerStatement = 200);
+    
+    // 合约增量写入的哈希表test_update_instrument_hash，不存在时创建；键为"交易所.合约"
+    bool loadInstrumentHashes(std::vector<std::pair<std::string, uint64_t>>& hashes);
+    bool saveInstrumentHashes(const std::vector<CTPInstrumentField>& instruments,
+                              const std::vector<uint64_t>& hashes, size_t rowsPerStatement = 200);
     
     // 投资者持仓信息插入方法
     bool insertInvestorPosition(const std::string& instrumentId, const std::string& brokerId,
@@ -92,6 +101,10 @@ public:
     // 批量插入行情数据
     bool insertMarketDataBatch(const std::vector<std::string>& marketDataList);
     
+    // 按合约更新market_data_latest（INSERT ... ON DUPLICATE KEY UPDATE），每条语句最多rowsPerStatement行；
+    // 表中已有更新的行情（交易日、业务日期、时间、毫秒依次比较）时保留原行
+    bool upsertLatestMarketDataBatch(const std::vector<CTPMarketDataField>& marketDataList, size_t rowsPerStatement = 200);
+    
     // 资金账户数据插入方法
     bool insertTradingAccount(const std::string& brokerID, const std::string& accountID,
                              double preMortgage, double preCredit, double preDeposit, double preBalance,
@@ -0,0 +1,39 @@
+#ifndef INSTRUMENT_CHANGE_TRACKER_H
+#define INSTRUMENT_CHANGE_TRACKER_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include "InstrumentConverter.h"
+
+// 合约增量写入的变更检测：记住每个合约上次写入的字段哈希，只把新增和变化的合约交给写库。
+// 哈希同时保存在test_update_instrument_hash中，重启后不必全量重写。
+class InstrumentChangeTracker {
+public:
+    struct Diff {
+        std::vector<CTPInstrumentField> rows;         // 需要写入的合约
+        std::vector<uint64_t> hashes;                 // 与rows一一对应
+        size_t added{0};
+        size_t changed{0};
+        size_t unchanged{0};
+        std::vector<std::string> samples;             // 部分新增/变化的合约，用于日志
+    };
+
+private:
+    std::unordered_map<std::string, uint64_t> hashes; // "交易所.合约" -> 字段哈希
+
+public:
+    void load(const std::vector<std::pair<std::string, uint64_t>>& saved);
+    // 与上次写入的哈希比较，同一批中重复的合约以最后一条为准
+    Diff diff(const std::vector<CTPInstrumentField>& instruments) const;
+    // 写库成功后记下新的哈希
+    void commit(const Diff& diff);
+    size_t size() const { return hashes.size(); }
+
+    static std::string key(const CTPInstrumentField& instrument);
+    static uint64_t hashRow(const CTPInstrumentField& instrument);
+    static std::string summary(const Diff& diff);
+};
+
+#endif // INSTRUMENT_CHANGE_TRACKER_H
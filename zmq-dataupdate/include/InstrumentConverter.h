@@ -63,8 +63,10 @@ public:
     // 检查是否为protobuf格式
     static bool isProtobufFormat(const std::string& data);
     
-    // 解析protobuf格式的合约数据
+    // 解析protobuf格式的合约数据(InstrumentBatchMessage)
     static std::vector<CTPInstrumentField> parseProtobufBatch(const std::string& protobufData);
+    // 直接从接收缓冲区解析，格式错误返回false
+    static bool parseProtobufBatch(const char* data, size_t size, std::vector<CTPInstrumentField>& instruments);
 };
 
 #endif // INSTRUMENT_CONVERTER_H 
\ No newline at end of file
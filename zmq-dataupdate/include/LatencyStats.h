@@ -0,0 +1,101 @@
+#ifndef LATENCYSTATS_H
+#define LATENCYSTATS_H
+
+#include <string>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+/// 行情链路各阶段的单调时钟打点，ctprawtick与zmq-dataupdate共用同一份定义，
+/// 跨进程比较要求两端在同一台机器上（CLOCK_MONOTONIC）。
+enum LatencyStage
+{
+    STAGE_SPI_RECV = 0,     ///OnRtnDepthMarketData收到
+    STAGE_DEQUEUE,          ///主线程从队列取出
+    STAGE_ENCODE,           ///protobuf编码完成
+    STAGE_SEND,             ///交给ZMQ发送
+    STAGE_SUB_RECV,         ///订阅端收到
+    STAGE_SUB_BUFFER,       ///订阅端放入写库缓冲区
+    STAGE_DB_COMMIT,        ///批量写库完成
+    STAGE_COUNT
+};
+
+/// 单调时钟纳秒
+int64_t monotonicNs();
+/// 系统时钟纳秒
+int64_t wallNs();
+
+/// 延迟打点尾部
+/// 发布端把它编码成protobuf字段号100的bytes字段追加在序列化结果之后，
+/// 不认识该字段的解析端按未知字段跳过；认识的一端从消息末尾按固定长度取出。
+struct LatencyTrailer
+{
+    int64_t stamps[STAGE_COUNT];    ///单调时钟纳秒，0表示未打点
+    int64_t recvWallNs;             ///SPI收到时的系统时钟纳秒
+
+    LatencyTrailer();
+
+    /// 编码后追加到out末尾
+    void appendTo(std::string& out) const;
+    /// 从消息末尾解析，没有尾部返回false
+    bool parseFrom(const std::string& message);
+
+    /// 编码后的字节数
+    static size_t encodedSize();
+};
+
+/// 无锁延迟直方图
+/// 按HDR直方图的方式分桶：每个2的幂区间再等分为32个子桶，相对误差约3%，
+/// 记录范围1ns到约18分钟，超出按最大值计。record只做原子加，可在任意线程并发调用。
+class LatencyHistogram
+{
+public:
+    struct Summary
+    {
+        uint64_t count;
+        int64_t  p50;
+        int64_t  p90;
+        int64_t  p99;
+        int64_t  p999;
+        int64_t  max;
+        int64_t  mean;
+    };
+
+    explicit LatencyHistogram(const char* name = "");
+
+    const char* name() const { return label; }
+    void setName(const char* name) { label = name; }
+
+    /// 记录一次耗时(ns)，负值忽略（两端时钟不一致）
+    void record(int64_t ns);
+
+    /// 汇总当前区间，reset为true时清零开始新区间
+    Summary summarize(bool reset);
+
+    /// name count=N p50=..us p90=..us p99=..us p999=..us max=..us mean=..us
+    static std::string format(const char* name, const Summary& s);
+    /// CSV: name,count,p50,p90,p99,p999,max,mean，单位us
+    static std::string toCsv(const char* name, const Summary& s);
+
+private:
+    enum
+    {
+        SUB_BITS    = 6,
+        HALF        = 1 << (SUB_BITS - 1),
+        MAX_SHIFT   = 34,
+        BUCKETS     = (MAX_SHIFT + 2) * HALF
+    };
+
+    static size_t indexOf(int64_t ns);
+    /// 桶的上界，用于输出分位数
+    static int64_t valueOf(size_t index);
+
+private:
+    const char*             label;
+    std::atomic<uint64_t>   counts[BUCKETS];
+    std::atomic<uint64_t>   total;
+    std::atomic<int64_t>    sum;
+    std::atomic<int64_t>    maxValue;
+};
+
+#endif
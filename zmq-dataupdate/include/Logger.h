@@ -25,6 +25,8 @@ public:
     ~Logger();
 
     void setLogLevel(LogLevel level) { currentLevel = level; }
+    // 逐条消息的调试日志先判断级别，避免拼接字符串
+    bool isDebugEnabled() const { return currentLevel <= LogLevel::DEBUG; }
     
     void debug(const std::string& message);
     void info(const std::string& message);
@@ -3,6 +3,7 @@
 
 #include <string>
 #include <vector>
+#include <cstddef>
 
 // 行情数据结构，对应CThostFtdcDepthMarketDataField
 struct CTPMarketDataField {
@@ -56,6 +57,9 @@ class MarketDataConverter {
 public:
     static bool isCSVFormat(const std::string& data);
     static CTPMarketDataField parseCSV(const std::string& csvData);
+    // 不分配内存的解析：逗号用SIMD查找，数字直接转换，out中的字符串复用已有容量。
+    // 支持EL/CTP_TICKER的44字段格式和旧版EL/CTP_XZ的13字段格式，格式不对返回false
+    static bool parseCSV(const char* data, size_t len, CTPMarketDataField& out);
     static std::string convertToDatabaseFormat(const CTPMarketDataField& marketData);
     static std::vector<std::string> split(const std::string& str, char delimiter);
     static double safeStringToDouble(const std::string& str);
@@ -0,0 +1,47 @@
+#ifndef MARKET_DATA_FILTER_H
+#define MARKET_DATA_FILTER_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+// 订阅端行情白名单：交易所、品种、合约三类条目取并集，全部为空时不过滤。
+// 品种和合约可以写成"交易所.品种"、"交易所.合约"，例如 SHFE.cu、DCE.m2409；
+// 所有条目都带交易所时可以直接换成按合约主题的ZMQ订阅前缀，由发布端过滤，
+// 否则订阅全部行情，在反序列化之前按合约代码过滤。
+class MarketDataFilter {
+private:
+    std::unordered_set<std::string> exchanges;
+    std::unordered_map<std::string, std::string> products;      // 品种 -> 交易所，空为不限
+    std::unordered_map<std::string, std::string> instruments;   // 合约 -> 交易所，空为不限
+
+    static void addQualified(std::unordered_map<std::string, std::string>& table, const std::string& entry);
+    static bool matches(const std::unordered_map<std::string, std::string>& table, const std::string& key,
+                        const std::string& exchange);
+
+public:
+    void addExchanges(const std::vector<std::string>& items);
+    void addProducts(const std::vector<std::string>& items);
+    void addInstruments(const std::vector<std::string>& items);
+
+    bool empty() const { return exchanges.empty() && products.empty() && instruments.empty(); }
+
+    // exchange为空或UNKNOWN（部分前置不填交易所）时按品种补出交易所再判断，品种不认识时只按品种/合约判断
+    bool accept(const std::string& exchange, const std::string& instrument) const;
+
+    // 品种所属交易所，取自与ctprawtick共用的ProductTable，不认识的品种返回空串
+    static const std::string& productExchange(const std::string& product);
+
+    // 所有条目都带交易所时给出按合约主题的订阅前缀，否则返回false
+    bool subscriptionPrefixes(std::vector<std::string>& prefixes) const;
+
+    // 不反序列化，直接从MarketDataMessage的编码中取instrument_id(2)和exchange_id(3)，
+    // 两个字段编码在最前面，扫描到更大的字段号即停止；取不到合约代码返回false
+    static bool peekInstrument(const std::string& message, std::string& instrument, std::string& exchange);
+
+    // 启动日志用
+    std::string describe() const;
+};
+
+#endif // MARKET_DATA_FILTER_H
@@ -0,0 +1,32 @@
+#ifndef MARKETTOPIC_H
+#define MARKETTOPIC_H
+
+#include <string>
+
+/// 按合约分主题发布的行情主题，ctprawtick与zmq-dataupdate共用。
+/// 主题格式为 MD.<交易所>.<品种>.<合约>，例如 MD.SHFE.rb.rb2410，
+/// 订阅端用ZMQ前缀订阅在发布端过滤：MD. 全部、MD.SHFE. 按交易所、MD.SHFE.rb. 按品种。
+class MarketTopic
+{
+public:
+    static const char* const kPrefix;       ///"MD."
+    static const char* const kUnknownExchange;
+
+    /// 合约代码开头的字母（品种），如 rb2410 -> rb，m2409-C-3000 -> m
+    static std::string product(const std::string& instrumentId);
+
+    /// 拼出行情主题写入out，复用out已有的缓冲区；exchangeId为空时用kUnknownExchange
+    static void build(const char* exchangeId, const char* instrumentId, std::string& out);
+
+    /// 订阅前缀，instrumentId为空时到品种为止，product也为空时到交易所为止
+    static std::string prefix(const std::string& exchangeId, const std::string& product = "",
+                              const std::string& instrumentId = "");
+
+    static bool isMarketTopic(const std::string& topic);
+
+    /// 拆出交易所/品种/合约，格式不对返回false
+    static bool parse(const std::string& topic, std::string& exchangeId, std::string& product,
+                      std::string& instrumentId);
+};
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef PARTITION_MANAGER_H
+#define PARTITION_MANAGER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <ctime>
+#include "DatabaseManager.h"
+#include "Logger.h"
+
+// market_data按交易日分区(PARTITION BY RANGE COLUMNS(TradingDay))的维护：
+// 每个自然日一个分区pYYYYMMDD，末尾保留pmax接住未来日期；提前建好之后若干天的分区，
+// 过期分区按配置删除或换出为单独的归档表market_data_YYYYMMDD，并按配置保留二级索引。
+// 转换已有表时今天之前的数据放在phistory，等保留期覆盖到它的上界后同样过期，归档表为market_data_history。
+// 分区操作只改元数据或搬空分区，不锁住整表扫描；使用单独的数据库连接，在主线程中定时调用。
+class PartitionManager {
+public:
+    enum ExpireAction {
+        EXPIRE_KEEP,        // 不处理过期分区
+        EXPIRE_DROP,        // 直接删除
+        EXPIRE_ARCHIVE      // 换出到market_data_YYYYMMDD后删除空分区
+    };
+
+private:
+    std::shared_ptr<DatabaseManager> db;
+    std::shared_ptr<Logger> logger;
+    std::string table;
+    int aheadDays;
+    int retentionDays;
+    ExpireAction expireAction;
+    bool convertExisting;
+    bool manageIndexes;
+    std::vector<std::string> keepIndexes;
+
+    struct Partition {
+        std::string name;
+        std::string date;   // pYYYYMMDD的日期部分，其它分区为空
+        std::string before; // VALUES LESS THAN的日期，pmax为空
+    };
+
+    bool loadPartitions(std::vector<Partition>& partitions, bool& partitioned);
+    bool convertTable(const std::string& today);
+    void addPartitions(const std::vector<Partition>& partitions, const std::string& today);
+    void expirePartitions(const std::vector<Partition>& partitions, const std::string& today);
+    void syncIndexes();
+
+    void info(const std::string& message);
+    void warning(const std::string& message);
+
+public:
+    PartitionManager(std::shared_ptr<DatabaseManager> db, std::shared_ptr<Logger> logger,
+                     const std::string& table = "market_data");
+
+    void setAheadDays(int days) { aheadDays = days; }
+    // 0为永久保留
+    void setRetention(int days, ExpireAction action) { retentionDays = days; expireAction = action; }
+    // 已有的未分区表是否转换为分区表（大表转换耗时较长，默认不转换）
+    void setConvertExisting(bool enable) { convertExisting = enable; }
+    // 只保留这些二级索引，其余删除、缺少的补建；不调用时不改动索引
+    void setKeepIndexes(const std::vector<std::string>& names) { keepIndexes = names; manageIndexes = true; }
+
+    // 补建分区、处理过期分区、同步索引，now为当前时间
+    void maintain(time_t now);
+
+    static ExpireAction parseExpireAction(const std::string& text);
+    // YYYYMMDD加减天数
+    static std::string shiftDate(const std::string& date, int days);
+    static std::string formatDate(time_t t);
+    // 建表语句中的分区子句，新表只有pmax，由maintain补建每日分区
+    static std::string createClause();
+};
+
+#endif // PARTITION_MANAGER_H
@@ -0,0 +1,38 @@
+#ifndef PRODUCTTABLE_H
+#define PRODUCTTABLE_H
+
+#include <string>
+#include <cstddef>
+
+/// 期货品种表：品种 -> 交易所、交易时段组，ctprawtick与zmq-dataupdate共用同一份定义。
+/// SessionCalendar按时段组展开交易分钟表；订阅端白名单在行情缺交易所时按品种补出交易所。
+/// 新上市品种只需在ProductTable.cpp中加一行。
+class ProductTable
+{
+public:
+    /// 时段组，SessionCalendar::SessionSet与之一一对应
+    enum Session
+    {
+        SESSION_DAY = 0,        ///只有日盘的商品期货
+        SESSION_NIGHT_2300,     ///夜盘至23:00
+        SESSION_NIGHT_0100,     ///夜盘至01:00
+        SESSION_NIGHT_0230,     ///夜盘至02:30
+        SESSION_CFFEX_INDEX,    ///股指期货
+        SESSION_CFFEX_BOND      ///国债期货
+    };
+
+    struct Entry
+    {
+        const char* product;
+        const char* exchange;
+        int         sessionSet;
+    };
+
+    /// 全部品种，count返回条数
+    static const Entry* entries(size_t& count);
+
+    /// 按品种代码（合约代码开头的字母，区分大小写）查找，未知品种返回nullptr
+    static const Entry* find(const std::string& product);
+};
+
+#endif
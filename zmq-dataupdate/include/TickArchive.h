@@ -0,0 +1,99 @@
+#ifndef TICK_ARCHIVE_H
+#define TICK_ARCHIVE_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstdio>
+
+// 按交易日导出的逐笔行情归档文件(.tck)，格式说明见TICK_ARCHIVE.md。
+// 每个交易日一个文件，文件内每个合约一个数据块；块内按列存放，每列为相邻两笔差值的zigzag varint，
+// 价格先换算为最小变动单位的整数倍，时间为当日毫秒数。数据块可选LZ4压缩（编译时找到liblz4才启用）。
+
+// 归档中的一笔行情，无效价格（0、DBL_MAX、NaN）统一为0
+struct ArchiveTick {
+    int32_t ActionDay;              // 业务日期 YYYYMMDD
+    int32_t TimeMs;                 // UpdateTime和UpdateMillisec合成的当日毫秒数
+    int64_t Volume;                 // 数量
+    double Turnover;                // 成交金额，精确到0.01
+    double OpenInterest;            // 持仓量
+    double LastPrice;               // 最新价
+    double BidPrice[5];             // 申买价一至五
+    double AskPrice[5];             // 申卖价一至五
+    int32_t BidVolume[5];           // 申买量一至五
+    int32_t AskVolume[5];           // 申卖量一至五
+    double OpenPrice;               // 今开盘
+    double HighestPrice;            // 最高价
+    double LowestPrice;             // 最低价
+    double ClosePrice;              // 今收盘
+    double SettlementPrice;         // 本次结算价
+    double UpperLimitPrice;         // 涨停板价
+    double LowerLimitPrice;         // 跌停板价
+    double PreSettlementPrice;      // 上次结算价
+    double PreClosePrice;           // 昨收盘
+    double PreOpenInterest;         // 昨持仓量
+    double AveragePrice;            // 当日均价，精确到0.0001
+};
+
+// 文件末尾索引中的一项
+struct ArchiveBlockInfo {
+    std::string InstrumentID;
+    std::string ExchangeID;
+    uint64_t offset;                // 数据块在文件中的偏移
+    uint32_t rows;
+};
+
+class TickArchiveWriter {
+private:
+    FILE* file;
+    std::string path;
+    std::string tmpPath;
+    std::vector<ArchiveBlockInfo> blocks;
+    std::vector<uint8_t> raw;
+    std::vector<uint8_t> packed;
+    uint64_t rawBytes;
+    uint64_t storedBytes;
+
+public:
+    TickArchiveWriter();
+    ~TickArchiveWriter();
+
+    // 先写到path.tmp，finish成功后改名，中途失败不会留下不完整的文件
+    bool open(const std::string& path, const std::string& tradingDay, std::string& error);
+    // 写入一个合约当日的全部行情，ticks按到达顺序排列
+    bool writeBlock(const std::string& instrumentId, const std::string& exchangeId,
+                    const std::vector<ArchiveTick>& ticks, std::string& error);
+    // 写索引、回填文件头并改名
+    bool finish(std::string& error);
+    // 放弃写入，删除临时文件
+    void abort();
+
+    uint64_t getRawBytes() const { return rawBytes; }
+    uint64_t getStoredBytes() const { return storedBytes; }
+    size_t getBlockCount() const { return blocks.size(); }
+
+    static bool compressionAvailable();
+};
+
+// 整个文件读入内存后按块解码
+class TickArchiveReader {
+private:
+    std::vector<uint8_t> data;
+    std::string tradingDay;
+    std::vector<ArchiveBlockInfo> blocks;
+    std::vector<uint8_t> scratch;
+
+public:
+    bool open(const std::string& path, std::string& error);
+    // 直接解析内存中的文件内容
+    bool load(std::vector<uint8_t> content, std::string& error);
+
+    const std::string& getTradingDay() const { return tradingDay; }
+    const std::vector<ArchiveBlockInfo>& getBlocks() const { return blocks; }
+    // 按合约代码查找块序号，找不到返回-1
+    int find(const std::string& instrumentId) const;
+    // 解码第index个块，out被覆盖
+    bool readBlock(size_t index, std::vector<ArchiveTick>& out, std::string& error);
+};
+
+#endif // TICK_ARCHIVE_H
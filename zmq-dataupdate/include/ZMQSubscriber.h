@@ -9,10 +9,17 @@
 #include <vector>
 #include <mutex>
 #include <chrono>
+#include <unordered_map>
 #include <zmq.hpp>
 #include "Logger.h"
 #include "DatabaseManager.h"
 #include "MarketDataConverter.h"
+#include "LatencyStats.h"
+#include "MetricsRegistry.h"
+#include "ShmTickRing.h"
+#include "MarketDataFilter.h"
+#include "InstrumentChangeTracker.h"
+#include "InstrumentConverter.h"
 #include "../proto/market_data.pb.h"
 
 // 消息处理函数类型定义
@@ -38,21 +45,106 @@ private:
     const std::chrono::seconds batchWriteInterval{30}; // 批量写入间隔（30秒）
     const size_t maxBufferSize{1000};                 // 最大缓冲区大小
 
+    // 延迟统计：发布端在行情消息末尾附带各阶段打点，这里补上收到/入缓冲/写库三个阶段
+    int64_t lastRecvNs{0};                            // 当前内容帧收到时的单调时钟，只在订阅线程中访问
+    std::vector<LatencyTrailer> latencyBuffer;        // 与marketDataBuffer一一对应，bufferMutex保护
+    LatencyHistogram latTransport{"send_to_sub_recv"};
+    LatencyHistogram latParse{"sub_recv_to_buffer"};
+    LatencyHistogram latCommit{"buffer_to_db_commit"};
+    LatencyHistogram latEndToEnd{"spi_recv_to_db_commit"};
+    LatencyHistogram latExchange{"exchange_recv_to_db_commit"};   // SPI收到(墙钟)到写库完成
+
+    // 运行指标，在构造函数中注册，由getMetrics()交给HTTP导出服务
+    MetricsRegistry metrics;
+    MetricCounter* metricMessages;                    // 收到的内容帧
+    MetricCounter* metricTicksBuffered;               // 放入写库缓冲区的行情
+    MetricCounter* metricParseFailures;               // 行情解析失败
+    MetricCounter* metricTicksDropped;                // 写库失败丢弃的行情
+    MetricCounter* metricBatchesOk;
+    MetricCounter* metricBatchesFailed;
+    MetricGauge* metricBufferDepth;
+    MetricHistogram* metricBatchRows;
+    MetricHistogram* metricBatchSeconds;
+    MetricHistogram* metricEndToEnd;                  // SPI收到到写库完成，需要发布端附带延迟打点
+    MetricCounter* metricShmTicks;                    // 从共享内存环读到的行情
+    MetricCounter* metricShmOverruns;                 // 读得太慢被共享内存环覆盖的行情
+    MetricCounter* metricTicksQuarantined;            // 发布端校验不通过、不入库的行情
+
+    // 同机部署时从共享内存环读取行情，ZMQ上的MARKET_DATA_PROTOBUF随之忽略，其它消息仍走ZMQ
+    std::string shmRingName;
+    std::thread shmReaderThread;
+
+    // 发布端按合约分主题(MD.<交易所>.<品种>.<合约>)时只订阅行情前缀和控制消息，不再收单一主题的全市场行情
+    bool instrumentTopics{false};
+
+    // 行情白名单，启动后只读；能换成订阅前缀时在发布端过滤，其余在解析前丢弃
+    MarketDataFilter filter;
+    MetricCounter* metricTicksFiltered;               // 不在白名单内、解析前丢弃的行情
+
+    // 每个合约的最新行情快照，合并模式和最新行情表共用
+    // 合并模式：定时把有更新的合约放入写库缓冲区，间隔为0时逐条写入
+    struct ConflatedSlot {
+        CTPMarketDataField data;
+        LatencyTrailer trailer;
+        bool traced{false};
+        bool dirty{false};                            // 合并模式下待写入market_data
+        bool latestDirty{false};                      // 待更新到market_data_latest
+    };
+    std::chrono::milliseconds conflateInterval{0};
+    std::mutex conflateMutex;                         // 保护以下四项
+    std::unordered_map<std::string, size_t> conflateIndex;   // 合约 -> conflateSlots下标
+    std::vector<ConflatedSlot> conflateSlots;
+    std::vector<size_t> dirtySlots;                   // 上次取走之后有更新的槽位
+    std::vector<size_t> dirtyLatest;                  // 上次更新最新行情表之后有更新的槽位
+    std::thread conflateThread;
+    MetricCounter* metricTicksConflated;              // 被同合约更新的行情覆盖、未写库的条数
+    MetricGauge* metricConflateSlots;
+
+    // 最新行情表：每个合约一行，定时按快照批量更新，使用单独的数据库连接，不与逐笔写入互相等待
+    std::chrono::milliseconds latestInterval{0};
+    std::shared_ptr<DatabaseManager> latestDbManager;
+    std::thread latestThread;
+    std::vector<CTPMarketDataField> latestRows;       // 最新行情快照的副本，跨轮复用字符串容量
+    MetricCounter* metricLatestRows;
+    MetricCounter* metricLatestFailures;
+    MetricHistogram* metricLatestSeconds;
+
+    // 合约增量写入：只写新增和字段有变化的合约，哈希在第一次收到合约消息时从数据库加载
+    bool instrumentIncremental{true};
+    bool instrumentHashesLoaded{false};
+    InstrumentChangeTracker instrumentTracker;
+    std::vector<CTPInstrumentField> instrumentScratch;    // protobuf合约解析结果，跨帧复用
+    // CSV合约消息(INSTRUMENT)只在兼容模式下解析，用于尚未切换到protobuf的发布端
+    bool instrumentCsvCompat{false};
+    bool instrumentCsvWarned{false};
+    MetricCounter* metricInstrumentsWritten;
+    MetricCounter* metricInstrumentsUnchanged;
+
     void subscriberLoop();
+    void shmReaderLoop();                             // 共享内存环读取线程循环
     void processMessage(const std::string& messageType, const std::string& messageContent);
     
     // 批量写入相关方法
     void batchWriterLoop();                           // 批量写入线程循环
+    void conflateLoop();                              // 合并模式定时取出有更新的合约
+    void drainConflated();                            // 有更新的合约放入写库缓冲区
+    void latestLoop();                                // 定时更新最新行情表
+    void upsertLatest();                              // 有更新的合约写入market_data_latest
+    void appendToBuffer(CTPMarketDataField marketData, const LatencyTrailer* trailer);
     void flushMarketDataBuffer();                     // 刷新缓冲区到数据库
-    void addMarketDataToBuffer(const CTPMarketDataField& marketData); // 添加数据到缓冲区
+    void addMarketDataToBuffer(CTPMarketDataField marketData,
+                               const LatencyTrailer* trailer = nullptr); // 添加数据到缓冲区，trailer为延迟打点
+    void logLatencyStats();                           // 输出各阶段延迟并开始新的统计区间
+    void tuneThread(const std::string& role);         // 按线程角色配置命名/绑核
     
     // 默认消息处理函数
     void defaultMessageHandler(const std::string& messageType, const std::string& messageContent);
     
     // 处理合约消息
-    void processInstrumentMessage(const std::string& messageContent);
+    void processInstrumentMessage(const std::string& messageType, const std::string& messageContent);
     void processCSVInstrumentMessage(const std::string& messageContent);
     void processProtobufInstrumentMessage(const std::string& messageContent);
+    bool writeInstruments(const std::vector<CTPInstrumentField>& instruments); // 按增量配置写入合约
     
     // 处理投资者持仓消息
     void processInvestorPositionMessage(const std::string& messageContent);
@@ -81,12 +173,32 @@ public:
     void setLogger(std::shared_ptr<Logger> log) { logger = log; }
     void setDatabaseManager(std::shared_ptr<DatabaseManager> db) { dbManager = db; }
     void setMessageHandler(MessageHandler handler) { messageHandler = handler; }
+    // 行情改从/dev/shm下的共享内存环读取，ZMQ只订阅行情以外的主题，需在initialize()之前设置
+    void setShmRing(const std::string& name) { shmRingName = name; }
+    // 改用按合约分的行情主题，需在initialize()之前设置
+    void setInstrumentTopics(bool enable) { instrumentTopics = enable; }
+    // 行情白名单，需在initialize()之前设置
+    void setFilter(const MarketDataFilter& f) { filter = f; }
+    // 合并间隔，0为逐条写入，需在start()之前设置
+    void setConflateInterval(int ms) { conflateInterval = std::chrono::milliseconds(ms); }
+    // 合约是否只写新增和变化的，关闭时每次全量写入
+    void setInstrumentIncremental(bool enable) { instrumentIncremental = enable; }
+    // 是否解析旧版CSV格式的合约消息
+    void setInstrumentCsvCompat(bool enable) { instrumentCsvCompat = enable; }
+    // 维护market_data_latest，db为单独的连接，需在start()之前设置
+    void setLatestTable(std::shared_ptr<DatabaseManager> db, int ms) {
+        latestDbManager = db;
+        latestInterval = std::chrono::milliseconds(ms);
+    }
     
     // 获取地址
     std::string getAddress() const { return address; }
     
     // 获取缓冲区状态
     size_t getBufferSize() const;
+    
+    // 运行指标
+    const MetricsRegistry& getMetrics() const { return metrics; }
 };
 
 #endif // ZMQ_SUBSCRIBER_H 
\ No newline at end of file
@@ -73,4 +73,29 @@ bool ConfigManager::getBoolValue(const std::string& key, bool defaultValue) {
     // 转换为小写进行比较
     std::transform(value.begin(), value.end(), value.begin(), ::tolower);
     return (value == "true" || value == "1" || value == "yes");
-} 
\ No newline at end of file
+} 
+
+std::vector<std::string> ConfigManager::getListValue(const std::string& key) {
+    std::vector<std::string> items;
+    std::istringstream iss(getValue(key));
+    std::string item;
+    while (std::getline(iss, item, ',')) {
+        item.erase(0, item.find_first_not_of(" \t"));
+        item.erase(item.find_last_not_of(" \t") + 1);
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+std::vector<std::string> ConfigManager::getThreadSpecs() {
+    const std::string prefix = "thread.";
+    std::vector<std::string> specs;
+    for (const auto& kv : config) {
+        if (kv.first.compare(0, prefix.size(), prefix) == 0) {
+            specs.push_back(kv.first.substr(prefix.size()) + ":" + kv.second);
+        }
+    }
+    return specs;
+}
@@ -2,6 +2,8 @@
 #include <iostream>
 #include <stdexcept>
 #include <sstream>
+#include <algorithm>
+#include <iterator>
 
 DatabaseManager::DatabaseManager(const std::string& host, int port, 
                                const std::string& user, const std::string& password, 
@@ -222,7 +224,58 @@ bool DatabaseManager::insertInstrument(const std::string& instrumentId, const st
     }
 }
 
-bool DatabaseManager::insertInstrumentBatch(const std::vector<std::vector<std::string>>& instruments) {
+// test_update_instrument的列，顺序与bindInstrumentFields一致
+static const char* const kInstrumentColumns[] = {
+    "InstrumentID", "ExchangeID", "InstrumentName", "ExchangeInstID", "ProductID",
+    "ProductClass", "DeliveryYear", "DeliveryMonth", "MaxMarketOrderVolume",
+    "MinMarketOrderVolume", "MaxLimitOrderVolume", "MinLimitOrderVolume",
+    "VolumeMultiple", "PriceTick", "CreateDate", "OpenDate", "ExpireDate",
+    "StartDelivDate", "EndDelivDate", "InstLifePhase", "IsTrading", "PositionType",
+    "PositionDateType", "LongMarginRatio", "ShortMarginRatio", "MaxMarginSideAlgorithm",
+    "UnderlyingInstrID", "StrikePrice", "OptionsType", "UnderlyingMultiple", "CombinationType"
+};
+static const size_t kInstrumentColumnCount = sizeof(kInstrumentColumns) / sizeof(kInstrumentColumns[0]);
+
+static std::string charField(char c) {
+    return c ? std::string(1, c) : std::string();
+}
+
+// 合约字段按列类型直接绑定，不经过字符串转换
+static void bindInstrumentFields(sql::PreparedStatement* pstmt, int& paramIndex, const CTPInstrumentField& instrument) {
+    pstmt->setString(paramIndex++, instrument.InstrumentID);
+    pstmt->setString(paramIndex++, instrument.ExchangeID);
+    pstmt->setString(paramIndex++, instrument.InstrumentName);
+    pstmt->setString(paramIndex++, instrument.ExchangeInstID);
+    pstmt->setString(paramIndex++, instrument.ProductID);
+    pstmt->setString(paramIndex++, charField(instrument.ProductClass));
+    pstmt->setInt(paramIndex++, instrument.DeliveryYear);
+    pstmt->setInt(paramIndex++, instrument.DeliveryMonth);
+    pstmt->setInt(paramIndex++, instrument.MaxMarketOrderVolume);
+    pstmt->setInt(paramIndex++, instrument.MinMarketOrderVolume);
+    pstmt->setInt(paramIndex++, instrument.MaxLimitOrderVolume);
+    pstmt->setInt(paramIndex++, instrument.MinLimitOrderVolume);
+    pstmt->setInt(paramIndex++, instrument.VolumeMultiple);
+    pstmt->setDouble(paramIndex++, instrument.PriceTick);
+    pstmt->setString(paramIndex++, instrument.CreateDate);
+    pstmt->setString(paramIndex++, instrument.OpenDate);
+    pstmt->setString(paramIndex++, instrument.ExpireDate);
+    pstmt->setString(paramIndex++, instrument.StartDelivDate);
+    pstmt->setString(paramIndex++, instrument.EndDelivDate);
+    pstmt->setString(paramIndex++, charField(instrument.InstLifePhase));
+    pstmt->setBoolean(paramIndex++, instrument.IsTrading);
+    pstmt->setString(paramIndex++, charField(instrument.PositionType));
+    pstmt->setString(paramIndex++, charField(instrument.PositionDateType));
+    pstmt->setDouble(paramIndex++, instrument.LongMarginRatio);
+    pstmt->setDouble(paramIndex++, instrument.ShortMarginRatio);
+    pstmt->setString(paramIndex++, charField(instrument.MaxMarginSideAlgorithm));
+    pstmt->setString(paramIndex++, instrument.UnderlyingInstrID);
+    pstmt->setDouble(paramIndex++, instrument.StrikePrice);
+    pstmt->setString(paramIndex++, charField(instrument.OptionsType));
+    pstmt->setDouble(paramIndex++, instrument.UnderlyingMultiple);
+    pstmt->setString(paramIndex++, charField(instrument.CombinationType));
+}
+
+bool DatabaseManager::insertInstrumentBatch(const std::vector<CTPInstrumentField>& instruments, size_t rowsPerStatement) {
     // 检查连接状态，如果断开则尝试重连
     if (!connected || !connection) {
         std::cerr << "数据库连接已断开，尝试重连..." << std::endl;
@@ -231,111 +284,132 @@ bool DatabaseManager::insertInstrumentBatch(const std::vector<std::vector<std::s
             return false;
         }
     }
+    if (rowsPerStatement == 0) {
+        rowsPerStatement = 1;
+    }
+
+    if (instruments.empty()) {
+        return true;
+    }
+
+    // 一条语句多行VALUES，合约已存在则更新除主键外的全部字段
+    std::string columns;
+    std::string placeholders = "(";
+    std::string updates;
+    for (size_t i = 0; i < kInstrumentColumnCount; ++i) {
+        std::string name = kInstrumentColumns[i];
+        columns += (i ? ", " : "") + name;
+        placeholders += i ? ", ?" : "?";
+        if (i >= 2) {
+            updates += (updates.empty() ? "" : ", ") + name + "=VALUES(" + name + ")";
+        }
+    }
+    placeholders += ")";
 
     try {
         // 开始事务
         connection->setAutoCommit(false);
-        
-        std::string sql = "INSERT INTO test_update_instrument ("
-                         "InstrumentID, ExchangeID, InstrumentName, ExchangeInstID, ProductID, "
-                         "ProductClass, DeliveryYear, DeliveryMonth, MaxMarketOrderVolume, "
-                         "MinMarketOrderVolume, MaxLimitOrderVolume, MinLimitOrderVolume, "
-                         "VolumeMultiple, PriceTick, CreateDate, OpenDate, ExpireDate, "
-                         "StartDelivDate, EndDelivDate, InstLifePhase, IsTrading, PositionType, "
-                         "PositionDateType, LongMarginRatio, ShortMarginRatio, MaxMarginSideAlgorithm, "
-                         "UnderlyingInstrID, StrikePrice, OptionsType, UnderlyingMultiple, CombinationType) "
-                         "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?) "
-                         "ON DUPLICATE KEY UPDATE "
-                         "InstrumentName=VALUES(InstrumentName), ExchangeInstID=VALUES(ExchangeInstID), "
-                         "ProductID=VALUES(ProductID), ProductClass=VALUES(ProductClass), "
-                         "DeliveryYear=VALUES(DeliveryYear), DeliveryMonth=VALUES(DeliveryMonth), "
-                         "MaxMarketOrderVolume=VALUES(MaxMarketOrderVolume), "
-                         "MinMarketOrderVolume=VALUES(MinMarketOrderVolume), "
-                         "MaxLimitOrderVolume=VALUES(MaxLimitOrderVolume), "
-                         "MinLimitOrderVolume=VALUES(MinLimitOrderVolume), "
-                         "VolumeMultiple=VALUES(VolumeMultiple), PriceTick=VALUES(PriceTick), "
-                         "CreateDate=VALUES(CreateDate), OpenDate=VALUES(OpenDate), "
-                         "ExpireDate=VALUES(ExpireDate), StartDelivDate=VALUES(StartDelivDate), "
-                         "EndDelivDate=VALUES(EndDelivDate), InstLifePhase=VALUES(InstLifePhase), "
-                         "IsTrading=VALUES(IsTrading), PositionType=VALUES(PositionType), "
-                         "PositionDateType=VALUES(PositionDateType), "
-                         "LongMarginRatio=VALUES(LongMarginRatio), "
-                         "ShortMarginRatio=VALUES(ShortMarginRatio), "
-                         "MaxMarginSideAlgorithm=VALUES(MaxMarginSideAlgorithm), "
-                         "UnderlyingInstrID=VALUES(UnderlyingInstrID), "
-                         "StrikePrice=VALUES(StrikePrice), OptionsType=VALUES(OptionsType), "
-                         "UnderlyingMultiple=VALUES(UnderlyingMultiple), "
-                         "CombinationType=VALUES(CombinationType)";
-        
-        std::unique_ptr<sql::PreparedStatement> pstmt(connection->prepareStatement(sql));
-        
-        int successCount = 0;
-        for (const auto& instrument : instruments) {
-            if (instrument.size() < 30) {
-                std::cerr << "合约数据字段不足，跳过" << std::endl;
-                continue;
+
+        for (size_t begin = 0; begin < instruments.size(); begin += rowsPerStatement) {
+            size_t count = std::min(rowsPerStatement, instruments.size() - begin);
+            std::string sql = "INSERT INTO test_update_instrument (" + columns + ") VALUES ";
+            for (size_t i = 0; i < count; ++i) {
+                sql += (i ? ", " : "") + placeholders;
             }
-            
-            try {
-                int paramIndex = 1;
-                pstmt->setString(paramIndex++, instrument[0]);  // instrument_id
-                pstmt->setString(paramIndex++, instrument[1]);  // exchange_id
-                pstmt->setString(paramIndex++, instrument[2]);  // instrument_name
-                pstmt->setString(paramIndex++, instrument[3]);  // exchange_inst_id
-                pstmt->setString(paramIndex++, instrument[4]);  // product_id
-                pstmt->setString(paramIndex++, instrument[5]);  // product_class
-                pstmt->setInt(paramIndex++, std::stoi(instrument[6]));      // delivery_year
-                pstmt->setInt(paramIndex++, std::stoi(instrument[7]));      // delivery_month
-                pstmt->setInt(paramIndex++, std::stoi(instrument[8]));      // max_market_order_volume
-                pstmt->setInt(paramIndex++, std::stoi(instrument[9]));      // min_market_order_volume
-                pstmt->setInt(paramIndex++, std::stoi(instrument[10]));     // max_limit_order_volume
-                pstmt->setInt(paramIndex++, std::stoi(instrument[11]));     // min_limit_order_volume
-                pstmt->setInt(paramIndex++, std::stoi(instrument[12]));     // volume_multiple
-                pstmt->setDouble(paramIndex++, std::stod(instrument[13]));  // price_tick
-                pstmt->setString(paramIndex++, instrument[14]); // create_date
-                pstmt->setString(paramIndex++, instrument[15]); // open_date
-                pstmt->setString(paramIndex++, instrument[16]); // expire_date
-                pstmt->setString(paramIndex++, instrument[17]); // start_deliv_date
-                pstmt->setString(paramIndex++, instrument[18]); // end_deliv_date
-                pstmt->setString(paramIndex++, instrument[19]); // inst_life_phase
-                pstmt->setBoolean(paramIndex++, instrument[20] == "1"); // is_trading
-                pstmt->setString(paramIndex++, instrument[21]); // position_type
-                pstmt->setString(paramIndex++, instrument[22]); // position_date_type
-                pstmt->setDouble(paramIndex++, std::stod(instrument[23])); // long_margin_ratio
-                pstmt->setDouble(paramIndex++, std::stod(instrument[24])); // short_margin_ratio
-                pstmt->setString(paramIndex++, instrument[25]); // max_margin_side_algorithm
-                pstmt->setString(paramIndex++, instrument[26]); // underlying_instr_id
-                pstmt->setDouble(paramIndex++, std::stod(instrument[27])); // strike_price
-                pstmt->setString(paramIndex++, instrument[28]); // options_type
-                pstmt->setDouble(paramIndex++, std::stod(instrument[29])); // underlying_multiple
-                pstmt->setString(paramIndex++, instrument[30]); // combination_type
-                
-                pstmt->executeUpdate();
-                successCount++;
-            } catch (const std::exception& e) {
-                std::cerr << "插入合约数据失败: " << e.what() << std::endl;
+            sql += " ON DUPLICATE KEY UPDATE " + updates;
+
+            std::unique_ptr<sql::PreparedStatement> pstmt(connection->prepareStatement(sql));
+            int paramIndex = 1;
+            for (size_t i = 0; i < count; ++i) {
+                bindInstrumentFields(pstmt.get(), paramIndex, instruments[begin + i]);
             }
+            pstmt->executeUpdate();
         }
-        
+
         // 提交事务
         connection->commit();
         connection->setAutoCommit(true);
-        
-        std::cout << "批量插入合约完成，成功: " << successCount << "/" << instruments.size() << std::endl;
-        return successCount > 0;
-        
-    } catch (const sql::SQLException& e) {
+
+        std::cout << "批量写入合约完成: " << instruments.size() << std::endl;
+        return true;
+
+    } catch (const std::exception& e) {
         // 回滚事务
         try {
             connection->rollback();
             connection->setAutoCommit(true);
         } catch (...) {}
-        
+
         std::cerr << "批量插入合约失败: " << e.what() << std::endl;
         return false;
     }
 }
 
+bool DatabaseManager::loadInstrumentHashes(std::vector<std::pair<std::string, uint64_t>>& hashes) {
+    if (!execute("CREATE TABLE IF NOT EXISTS test_update_instrument_hash ("
+                 "InstrumentID VARCHAR(81) NOT NULL, "
+                 "ExchangeID VARCHAR(9) NOT NULL, "
+                 "RowHash BIGINT UNSIGNED NOT NULL COMMENT '上次写入的合约字段哈希', "
+                 "UpdateTime TIMESTAMP DEFAULT CURRENT_TIMESTAMP ON UPDATE CURRENT_TIMESTAMP, "
+                 "PRIMARY KEY (InstrumentID, ExchangeID)"
+                 ") ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COMMENT='合约增量写入的变更检测'")) {
+        return false;
+    }
+    // 只取合约表里仍然存在的，合约表被清空或删行后会重新写入
+    auto rs = query("SELECT h.InstrumentID, h.ExchangeID, h.RowHash FROM test_update_instrument_hash h "
+                    "JOIN test_update_instrument i ON i.InstrumentID = h.InstrumentID AND i.ExchangeID = h.ExchangeID");
+    if (!rs) {
+        return false;
+    }
+    hashes.clear();
+    while (rs->next()) {
+        hashes.emplace_back(rs->getString(2) + "." + rs->getString(1), rs->getUInt64(3));
+    }
+    return true;
+}
+
+bool DatabaseManager::saveInstrumentHashes(const std::vector<CTPInstrumentField>& instruments,
+                                           const std::vector<uint64_t>& hashes, size_t rowsPerStatement) {
+    if (!connected || !connection || instruments.size() != hashes.size()) {
+        return false;
+    }
+    if (rowsPerStatement == 0) {
+        rowsPerStatement = 1;
+    }
+    try {
+        connection->setAutoCommit(false);
+        for (size_t begin = 0; begin < instruments.size(); begin += rowsPerStatement) {
+            size_t count = std::min(rowsPerStatement, instruments.size() - begin);
+            std::string sql = "INSERT INTO test_update_instrument_hash (InstrumentID, ExchangeID, RowHash) VALUES ";
+            for (size_t i = 0; i < count; ++i) {
+                sql += i ? ", (?, ?, ?)" : "(?, ?, ?)";
+            }
+            sql += " ON DUPLICATE KEY UPDATE RowHash=VALUES(RowHash)";
+
+            std::unique_ptr<sql::PreparedStatement> pstmt(connection->prepareStatement(sql));
+            int paramIndex = 1;
+            for (size_t i = begin; i < begin + count; ++i) {
+                pstmt->setString(paramIndex++, instruments[i].InstrumentID);
+                pstmt->setString(paramIndex++, instruments[i].ExchangeID);
+                pstmt->setUInt64(paramIndex++, hashes[i]);
+            }
+            pstmt->executeUpdate();
+        }
+        connection->commit();
+        connection->setAutoCommit(true);
+        return true;
+
+    } catch (const std::exception& e) {
+        try {
+            connection->rollback();
+            connection->setAutoCommit(true);
+        } catch (...) {}
+
+        std::cerr << "写入合约哈希失败: " << e.what() << std::endl;
+        return false;
+    }
+}
+
 bool DatabaseManager::insertInvestorPosition(const std::string& instrumentId, const std::string& brokerId,
                                            const std::string& investorId, char posiDirection, char hedgeFlag,
                                            char positionDate, int ydPosition, int position, int longFrozen,
@@ -671,6 +745,118 @@ bool DatabaseManager::insertMarketData(const std::string& tradingDay, const std:
     }
 }
 
+// market_data与market_data_latest共有的行情列，两张表的写入都按此顺序绑定（bindMarketDataFields）
+static const char* const kMarketDataColumns[] = {
+    "TradingDay", "InstrumentID", "ExchangeID", "ExchangeInstID", "LastPrice",
+    "PreSettlementPrice", "PreClosePrice", "PreOpenInterest", "OpenPrice",
+    "HighestPrice", "LowestPrice", "Volume", "Turnover", "OpenInterest", "ClosePrice",
+    "SettlementPrice", "UpperLimitPrice", "LowerLimitPrice", "PreDelta", "CurrDelta",
+    "UpdateTime", "UpdateMillisec", "BidPrice1", "BidVolume1", "AskPrice1", "AskVolume1",
+    "BidPrice2", "BidVolume2", "AskPrice2", "AskVolume2", "BidPrice3", "BidVolume3",
+    "AskPrice3", "AskVolume3", "BidPrice4", "BidVolume4", "AskPrice4", "AskVolume4",
+    "BidPrice5", "BidVolume5", "AskPrice5", "AskVolume5", "AveragePrice", "ActionDay"
+};
+static const size_t kMarketDataColumnCount = sizeof(kMarketDataColumns) / sizeof(kMarketDataColumns[0]);
+
+// 行情字段按列类型直接绑定，顺序与kMarketDataColumns一致
+static void bindMarketDataFields(sql::PreparedStatement* pstmt, int& paramIndex, const CTPMarketDataField& marketData) {
+    pstmt->setString(paramIndex++, marketData.TradingDay);
+    pstmt->setString(paramIndex++, marketData.InstrumentID);
+    pstmt->setString(paramIndex++, marketData.ExchangeID);
+    pstmt->setString(paramIndex++, marketData.ExchangeInstID);
+    pstmt->setDouble(paramIndex++, marketData.LastPrice);
+    pstmt->setDouble(paramIndex++, marketData.PreSettlementPrice);
+    pstmt->setDouble(paramIndex++, marketData.PreClosePrice);
+    pstmt->setDouble(paramIndex++, marketData.PreOpenInterest);
+    pstmt->setDouble(paramIndex++, marketData.OpenPrice);
+    pstmt->setDouble(paramIndex++, marketData.HighestPrice);
+    pstmt->setDouble(paramIndex++, marketData.LowestPrice);
+    pstmt->setInt(paramIndex++, marketData.Volume);
+    pstmt->setDouble(paramIndex++, marketData.Turnover);
+    pstmt->setDouble(paramIndex++, marketData.OpenInterest);
+    pstmt->setDouble(paramIndex++, marketData.ClosePrice);
+    pstmt->setDouble(paramIndex++, marketData.SettlementPrice);
+    pstmt->setDouble(paramIndex++, marketData.UpperLimitPrice);
+    pstmt->setDouble(paramIndex++, marketData.LowerLimitPrice);
+    pstmt->setDouble(paramIndex++, marketData.PreDelta);
+    pstmt->setDouble(paramIndex++, marketData.CurrDelta);
+    pstmt->setString(paramIndex++, marketData.UpdateTime);
+    pstmt->setInt(paramIndex++, marketData.UpdateMillisec);
+    pstmt->setDouble(paramIndex++, marketData.BidPrice1);
+    pstmt->setInt(paramIndex++, marketData.BidVolume1);
+    pstmt->setDouble(paramIndex++, marketData.AskPrice1);
+    pstmt->setInt(paramIndex++, marketData.AskVolume1);
+    pstmt->setDouble(paramIndex++, marketData.BidPrice2);
+    pstmt->setInt(paramIndex++, marketData.BidVolume2);
+    pstmt->setDouble(paramIndex++, marketData.AskPrice2);
+    pstmt->setInt(paramIndex++, marketData.AskVolume2);
+    pstmt->setDouble(paramIndex++, marketData.BidPrice3);
+    pstmt->setInt(paramIndex++, marketData.BidVolume3);
+    pstmt->setDouble(paramIndex++, marketData.AskPrice3);
+    pstmt->setInt(paramIndex++, marketData.AskVolume3);
+    pstmt->setDouble(paramIndex++, marketData.BidPrice4);
+    pstmt->setInt(paramIndex++, marketData.BidVolume4);
+    pstmt->setDouble(paramIndex++, marketData.AskPrice4);
+    pstmt->setInt(paramIndex++, marketData.AskVolume4);
+    pstmt->setDouble(paramIndex++, marketData.BidPrice5);
+    pstmt->setInt(paramIndex++, marketData.BidVolume5);
+    pstmt->setDouble(paramIndex++, marketData.AskPrice5);
+    pstmt->setInt(paramIndex++, marketData.AskVolume5);
+    pstmt->setDouble(paramIndex++, marketData.AveragePrice);
+    pstmt->setString(paramIndex++, marketData.ActionDay);
+}
+
+// 行情CSV（MarketDataConverter::convertToDatabaseFormat的44个字段）按kMarketDataColumns的顺序还原，
+// 字符串列原样保留（含引号），与之前写入market_data的内容一致；数值格式错误时抛出异常
+static CTPMarketDataField marketDataFromFields(const std::vector<std::string>& fields) {
+    CTPMarketDataField marketData;
+    marketData.TradingDay = fields[0];
+    marketData.InstrumentID = fields[1];
+    marketData.ExchangeID = fields[2];
+    marketData.ExchangeInstID = fields[3];
+    marketData.LastPrice = std::stod(fields[4]);
+    marketData.PreSettlementPrice = std::stod(fields[5]);
+    marketData.PreClosePrice = std::stod(fields[6]);
+    marketData.PreOpenInterest = std::stod(fields[7]);
+    marketData.OpenPrice = std::stod(fields[8]);
+    marketData.HighestPrice = std::stod(fields[9]);
+    marketData.LowestPrice = std::stod(fields[10]);
+    marketData.Volume = std::stoi(fields[11]);
+    marketData.Turnover = std::stod(fields[12]);
+    marketData.OpenInterest = std::stod(fields[13]);
+    marketData.ClosePrice = std::stod(fields[14]);
+    marketData.SettlementPrice = std::stod(fields[15]);
+    marketData.UpperLimitPrice = std::stod(fields[16]);
+    marketData.LowerLimitPrice = std::stod(fields[17]);
+    marketData.PreDelta = std::stod(fields[18]);
+    marketData.CurrDelta = std::stod(fields[19]);
+    marketData.UpdateTime = fields[20];
+    marketData.UpdateMillisec = std::stoi(fields[21]);
+    marketData.BidPrice1 = std::stod(fields[22]);
+    marketData.BidVolume1 = std::stoi(fields[23]);
+    marketData.AskPrice1 = std::stod(fields[24]);
+    marketData.AskVolume1 = std::stoi(fields[25]);
+    marketData.BidPrice2 = std::stod(fields[26]);
+    marketData.BidVolume2 = std::stoi(fields[27]);
+    marketData.AskPrice2 = std::stod(fields[28]);
+    marketData.AskVolume2 = std::stoi(fields[29]);
+    marketData.BidPrice3 = std::stod(fields[30]);
+    marketData.BidVolume3 = std::stoi(fields[31]);
+    marketData.AskPrice3 = std::stod(fields[32]);
+    marketData.AskVolume3 = std::stoi(fields[33]);
+    marketData.BidPrice4 = std::stod(fields[34]);
+    marketData.BidVolume4 = std::stoi(fields[35]);
+    marketData.AskPrice4 = std::stod(fields[36]);
+    marketData.AskVolume4 = std::stoi(fields[37]);
+    marketData.BidPrice5 = std::stod(fields[38]);
+    marketData.BidVolume5 = std::stoi(fields[39]);
+    marketData.AskPrice5 = std::stod(fields[40]);
+    marketData.AskVolume5 = std::stoi(fields[41]);
+    marketData.AveragePrice = std::stod(fields[42]);
+    marketData.ActionDay = fields[43];
+    return marketData;
+}
+
 bool DatabaseManager::insertMarketDataBatch(const std::vector<std::string>& marketDataList) {
     if (!connected) {
         std::cerr << "数据库未连接" << std::endl;
@@ -681,16 +867,13 @@ bool DatabaseManager::insertMarketDataBatch(const std::vector<std::string>& mark
         // 开始事务
         connection->setAutoCommit(false);
         
-        std::string sql = "INSERT INTO market_data ("
-                         "TradingDay, InstrumentID, ExchangeID, ExchangeInstID, LastPrice, "
-                         "PreSettlementPrice, PreClosePrice, PreOpenInterest, OpenPrice, "
-                         "HighestPrice, LowestPrice, Volume, Turnover, OpenInterest, ClosePrice, "
-                         "SettlementPrice, UpperLimitPrice, LowerLimitPrice, PreDelta, CurrDelta, "
-                         "UpdateTime, UpdateMillisec, BidPrice1, BidVolume1, AskPrice1, AskVolume1, "
-                         "BidPrice2, BidVolume2, AskPrice2, AskVolume2, BidPrice3, BidVolume3, "
-                         "AskPrice3, AskVolume3, BidPrice4, BidVolume4, AskPrice4, AskVolume4, "
-                         "BidPrice5, BidVolume5, AskPrice5, AskVolume5, AveragePrice, ActionDay) "
-                         "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)";
+        std::string columns;
+        std::string placeholders;
+        for (size_t i = 0; i < kMarketDataColumnCount; ++i) {
+            columns += std::string(i ? ", " : "") + kMarketDataColumns[i];
+            placeholders += i ? ", ?" : "?";
+        }
+        std::string sql = "INSERT INTO market_data (" + columns + ") VALUES (" + placeholders + ")";
         
         std::unique_ptr<sql::PreparedStatement> pstmt(connection->prepareStatement(sql));
         
@@ -706,56 +889,13 @@ bool DatabaseManager::insertMarketDataBatch(const std::vector<std::string>& mark
                     fields.push_back(field);
                 }
                 
-                if (fields.size() < 44) {
-                    std::cerr << "行情数据字段不足，需要44个字段，实际: " << fields.size() << std::endl;
+                if (fields.size() < kMarketDataColumnCount) {
+                    std::cerr << "行情数据字段不足，需要" << kMarketDataColumnCount << "个字段，实际: " << fields.size() << std::endl;
                     continue;
                 }
                 
                 int paramIndex = 1;
-                pstmt->setString(paramIndex++, fields[0]);   // TradingDay
-                pstmt->setString(paramIndex++, fields[1]);   // InstrumentID
-                pstmt->setString(paramIndex++, fields[2]);   // ExchangeID
-                pstmt->setString(paramIndex++, fields[3]);   // ExchangeInstID
-                pstmt->setDouble(paramIndex++, std::stod(fields[4]));   // LastPrice
-                pstmt->setDouble(paramIndex++, std::stod(fields[5]));   // PreSettlementPrice
-                pstmt->setDouble(paramIndex++, std::stod(fields[6]));   // PreClosePrice
-                pstmt->setDouble(paramIndex++, std::stod(fields[7]));   // PreOpenInterest
-                pstmt->setDouble(paramIndex++, std::stod(fields[8]));   // OpenPrice
-                pstmt->setDouble(paramIndex++, std::stod(fields[9]));   // HighestPrice
-                pstmt->setDouble(paramIndex++, std::stod(fields[10]));  // LowestPrice
-                pstmt->setInt(paramIndex++, std::stoi(fields[11]));     // Volume
-                pstmt->setDouble(paramIndex++, std::stod(fields[12]));  // Turnover
-                pstmt->setDouble(paramIndex++, std::stod(fields[13]));  // OpenInterest
-                pstmt->setDouble(paramIndex++, std::stod(fields[14]));  // ClosePrice
-                pstmt->setDouble(paramIndex++, std::stod(fields[15]));  // SettlementPrice
-                pstmt->setDouble(paramIndex++, std::stod(fields[16]));  // UpperLimitPrice
-                pstmt->setDouble(paramIndex++, std::stod(fields[17]));  // LowerLimitPrice
-                pstmt->setDouble(paramIndex++, std::stod(fields[18]));  // PreDelta
-                pstmt->setDouble(paramIndex++, std::stod(fields[19]));  // CurrDelta
-                pstmt->setString(paramIndex++, fields[20]);  // UpdateTime
-                pstmt->setInt(paramIndex++, std::stoi(fields[21]));     // UpdateMillisec
-                pstmt->setDouble(paramIndex++, std::stod(fields[22]));  // BidPrice1
-                pstmt->setInt(paramIndex++, std::stoi(fields[23]));     // BidVolume1
-                pstmt->setDouble(paramIndex++, std::stod(fields[24]));  // AskPrice1
-                pstmt->setInt(paramIndex++, std::stoi(fields[25]));     // AskVolume1
-                pstmt->setDouble(paramIndex++, std::stod(fields[26]));  // BidPrice2
-                pstmt->setInt(paramIndex++, std::stoi(fields[27]));     // BidVolume2
-                pstmt->setDouble(paramIndex++, std::stod(fields[28]));  // AskPrice2
-                pstmt->setInt(paramIndex++, std::stoi(fields[29]));     // AskVolume2
-                pstmt->setDouble(paramIndex++, std::stod(fields[30]));  // BidPrice3
-                pstmt->setInt(paramIndex++, std::stoi(fields[31]));     // BidVolume3
-                pstmt->setDouble(paramIndex++, std::stod(fields[32]));  // AskPrice3
-                pstmt->setInt(paramIndex++, std::stoi(fields[33]));     // AskVolume3
-                pstmt->setDouble(paramIndex++, std::stod(fields[34]));  // BidPrice4
-                pstmt->setInt(paramIndex++, std::stoi(fields[35]));     // BidVolume4
-                pstmt->setDouble(paramIndex++, std::stod(fields[36]));  // AskPrice4
-                pstmt->setInt(paramIndex++, std::stoi(fields[37]));     // AskVolume4
-                pstmt->setDouble(paramIndex++, std::stod(fields[38]));  // BidPrice5
-                pstmt->setInt(paramIndex++, std::stoi(fields[39]));     // BidVolume5
-                pstmt->setDouble(paramIndex++, std::stod(fields[40]));  // AskPrice5
-                pstmt->setInt(paramIndex++, std::stoi(fields[41]));     // AskVolume5
-                pstmt->setDouble(paramIndex++, std::stod(fields[42]));  // AveragePrice
-                pstmt->setString(paramIndex++, fields[43]);  // ActionDay
+                bindMarketDataFields(pstmt.get(), paramIndex, marketDataFromFields(fields));
                 
                 pstmt->executeUpdate();
                 successCount++;
@@ -784,6 +924,77 @@ bool DatabaseManager::insertMarketDataBatch(const std::vector<std::string>& mark
     }
 }
 
+bool DatabaseManager::upsertLatestMarketDataBatch(const std::vector<CTPMarketDataField>& marketDataList, size_t rowsPerStatement) {
+    if (!connected) {
+        std::cerr << "数据库未连接" << std::endl;
+        return false;
+    }
+    if (rowsPerStatement == 0) {
+        rowsPerStatement = 1;
+    }
+    if (marketDataList.empty()) {
+        return true;
+    }
+    
+    // 一条语句多行VALUES，按合约主键存在则更新。多个连接或重试时较旧的快照可能后到，
+    // 只有不早于表中行情时才覆盖；MySQL按顺序赋值，比较用的四列放在最后并从低位到高位更新，
+    // 前面的列比较时看到的仍是原值
+    static const char* const kOrderColumns[] = {"UpdateMillisec", "UpdateTime", "ActionDay", "TradingDay"};
+    const std::string newer = "(VALUES(TradingDay), VALUES(ActionDay), VALUES(UpdateTime), VALUES(UpdateMillisec))"
+                              " >= (TradingDay, ActionDay, UpdateTime, UpdateMillisec)";
+    auto guarded = [&newer](const std::string& name) {
+        return name + " = IF(" + newer + ", VALUES(" + name + "), " + name + ")";
+    };
+    std::string columns;
+    std::string placeholders = "(";
+    std::string updates;
+    for (size_t i = 0; i < kMarketDataColumnCount; ++i) {
+        std::string name = kMarketDataColumns[i];
+        columns += (i ? ", " : "") + name;
+        placeholders += i ? ", ?" : "?";
+        if (name != "InstrumentID" && std::find(std::begin(kOrderColumns), std::end(kOrderColumns), name) == std::end(kOrderColumns)) {
+            updates += (updates.empty() ? "" : ", ") + guarded(name);
+        }
+    }
+    for (const char* name : kOrderColumns) {
+        updates += ", " + guarded(name);
+    }
+    placeholders += ")";
+    
+    try {
+        connection->setAutoCommit(false);
+        
+        for (size_t begin = 0; begin < marketDataList.size(); begin += rowsPerStatement) {
+            size_t count = std::min(rowsPerStatement, marketDataList.size() - begin);
+            std::string sql = "INSERT INTO market_data_latest (" + columns + ") VALUES ";
+            for (size_t i = 0; i < count; ++i) {
+                sql += (i ? ", " : "") + placeholders;
+            }
+            sql += " ON DUPLICATE KEY UPDATE " + updates;
+            
+            std::unique_ptr<sql::PreparedStatement> pstmt(connection->prepareStatement(sql));
+            int paramIndex = 1;
+            for (size_t i = 0; i < count; ++i) {
+                bindMarketDataFields(pstmt.get(), paramIndex, marketDataList[begin + i]);
+            }
+            pstmt->executeUpdate();
+        }
+        
+        connection->commit();
+        connection->setAutoCommit(true);
+        return true;
+        
+    } catch (const std::exception& e) {
+        try {
+            connection->rollback();
+            connection->setAutoCommit(true);
+        } catch (...) {}
+        
+        std::cerr << "更新最新行情失败: " << e.what() << std::endl;
+        return false;
+    }
+}
+
 bool DatabaseManager::insertTradingAccount(const std::string& brokerID, const std::string& accountID,
                                           double preMortgage, double preCredit, double preDeposit, double preBalance,
                                           double preMargin, double interestBase, double interest, double deposit,
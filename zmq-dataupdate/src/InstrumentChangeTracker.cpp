@@ -0,0 +1,132 @@
+#include "../include/InstrumentChangeTracker.h"
+
+// 日志中列出的合约个数
+static const size_t kSampleCount = 10;
+
+// FNV-1a
+static const uint64_t kFnvOffset = 14695981039346656037ULL;
+static const uint64_t kFnvPrime = 1099511628211ULL;
+
+static void mix(uint64_t& h, const void* data, size_t size) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        h = (h ^ p[i]) * kFnvPrime;
+    }
+}
+
+// 字符串后加分隔符，避免相邻字段拼接后相同
+static void mixString(uint64_t& h, const std::string& value) {
+    mix(h, value.data(), value.size());
+    h = (h ^ 0x1f) * kFnvPrime;
+}
+
+template <typename T>
+static void mixValue(uint64_t& h, T value) {
+    mix(h, &value, sizeof(value));
+}
+
+void InstrumentChangeTracker::load(const std::vector<std::pair<std::string, uint64_t>>& saved) {
+    hashes.clear();
+    hashes.reserve(saved.size());
+    for (const auto& item : saved) {
+        hashes[item.first] = item.second;
+    }
+}
+
+std::string InstrumentChangeTracker::key(const CTPInstrumentField& instrument) {
+    return instrument.ExchangeID + "." + instrument.InstrumentID;
+}
+
+uint64_t InstrumentChangeTracker::hashRow(const CTPInstrumentField& instrument) {
+    uint64_t h = kFnvOffset;
+    mixString(h, instrument.InstrumentID);
+    mixString(h, instrument.ExchangeID);
+    mixString(h, instrument.InstrumentName);
+    mixString(h, instrument.ExchangeInstID);
+    mixString(h, instrument.ProductID);
+    mixValue(h, instrument.ProductClass);
+    mixValue(h, instrument.DeliveryYear);
+    mixValue(h, instrument.DeliveryMonth);
+    mixValue(h, instrument.MaxMarketOrderVolume);
+    mixValue(h, instrument.MinMarketOrderVolume);
+    mixValue(h, instrument.MaxLimitOrderVolume);
+    mixValue(h, instrument.MinLimitOrderVolume);
+    mixValue(h, instrument.VolumeMultiple);
+    mixValue(h, instrument.PriceTick);
+    mixString(h, instrument.CreateDate);
+    mixString(h, instrument.OpenDate);
+    mixString(h, instrument.ExpireDate);
+    mixString(h, instrument.StartDelivDate);
+    mixString(h, instrument.EndDelivDate);
+    mixValue(h, instrument.InstLifePhase);
+    mixValue(h, instrument.IsTrading);
+    mixValue(h, instrument.PositionType);
+    mixValue(h, instrument.PositionDateType);
+    mixValue(h, instrument.LongMarginRatio);
+    mixValue(h, instrument.ShortMarginRatio);
+    mixValue(h, instrument.MaxMarginSideAlgorithm);
+    mixString(h, instrument.UnderlyingInstrID);
+    mixValue(h, instrument.StrikePrice);
+    mixValue(h, instrument.OptionsType);
+    mixValue(h, instrument.UnderlyingMultiple);
+    mixValue(h, instrument.CombinationType);
+    return h;
+}
+
+InstrumentChangeTracker::Diff InstrumentChangeTracker::diff(const std::vector<CTPInstrumentField>& instruments) const {
+    Diff result;
+
+    // 先按合约去重，同一批中重复的合约只按最后一条归类，计数才与写入的行一致
+    std::vector<std::string> keys;
+    keys.reserve(instruments.size());
+    std::unordered_map<std::string, size_t> lastIndex;
+    lastIndex.reserve(instruments.size());
+    for (size_t i = 0; i < instruments.size(); ++i) {
+        keys.push_back(key(instruments[i]));
+        lastIndex[keys.back()] = i;
+    }
+
+    for (size_t i = 0; i < instruments.size(); ++i) {
+        if (lastIndex[keys[i]] != i) {
+            continue;
+        }
+        const CTPInstrumentField& instrument = instruments[i];
+        uint64_t h = hashRow(instrument);
+        auto it = hashes.find(keys[i]);
+        if (it != hashes.end() && it->second == h) {
+            result.unchanged++;
+            continue;
+        }
+        if (it == hashes.end()) {
+            result.added++;
+        } else {
+            result.changed++;
+        }
+        if (result.samples.size() < kSampleCount) {
+            result.samples.push_back((it == hashes.end() ? "+" : "~") + instrument.InstrumentID);
+        }
+        result.rows.push_back(instrument);
+        result.hashes.push_back(h);
+    }
+    return result;
+}
+
+void InstrumentChangeTracker::commit(const Diff& diff) {
+    for (size_t i = 0; i < diff.rows.size(); ++i) {
+        hashes[key(diff.rows[i])] = diff.hashes[i];
+    }
+}
+
+std::string InstrumentChangeTracker::summary(const Diff& diff) {
+    std::string text = "新增 " + std::to_string(diff.added) + "，变化 " + std::to_string(diff.changed) +
+                       "，未变 " + std::to_string(diff.unchanged);
+    if (!diff.samples.empty()) {
+        text += " [";
+        for (size_t i = 0; i < diff.samples.size(); ++i) {
+            text += (i ? " " : "") + diff.samples[i];
+        }
+        size_t total = diff.added + diff.changed;
+        text += total > diff.samples.size() ? " ...]" : "]";
+    }
+    return text;
+}
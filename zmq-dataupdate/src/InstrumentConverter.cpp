@@ -1,4 +1,5 @@
 #include "../include/InstrumentConverter.h"
+#include "../proto/instrument.pb.h"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
@@ -126,7 +127,10 @@ std::vector<CTPInstrumentField> InstrumentConverter::parseCSV(const std::string&
             fields.push_back(field);
         }
         
-        if (fields.size() >= 31) {
+        if (fields.size() < 31) {
+            continue;
+        }
+        try {
             // 填充结构体字段
             instrument.InstrumentID = fields[0];
             instrument.ExchangeID = fields[1];
@@ -161,6 +165,8 @@ std::vector<CTPInstrumentField> InstrumentConverter::parseCSV(const std::string&
             instrument.CombinationType = fields[30].empty() ? '\0' : fields[30][0];
             
             instruments.push_back(instrument);
+        } catch (const std::exception& e) {
+            std::cerr << "合约CSV数字字段格式错误，跳过: " << fields[0] << std::endl;
         }
     }
     
@@ -197,19 +203,62 @@ bool InstrumentConverter::isProtobufFormat(const std::string& data) {
     return false;
 }
 
+static char firstChar(const std::string& value) {
+    return value.empty() ? '\0' : value[0];
+}
+
+// 字段对应关系与ctprawtick的ProtobufConverter::convertFromProtobuf一致
+static void fromProtobuf(const ctp::InstrumentMessage& message, CTPInstrumentField& instrument) {
+    instrument.InstrumentID = message.instrument_id();
+    instrument.ExchangeID = message.exchange_id();
+    instrument.InstrumentName = message.instrument_name();
+    instrument.ExchangeInstID = message.exchange_inst_id();
+    instrument.ProductID = message.product_id();
+    instrument.ProductClass = firstChar(message.product_class());
+    instrument.DeliveryYear = message.delivery_year();
+    instrument.DeliveryMonth = message.delivery_month();
+    instrument.MaxMarketOrderVolume = message.max_market_order_volume();
+    instrument.MinMarketOrderVolume = message.min_market_order_volume();
+    instrument.MaxLimitOrderVolume = message.max_limit_order_volume();
+    instrument.MinLimitOrderVolume = message.min_limit_order_volume();
+    instrument.VolumeMultiple = message.volume_multiple();
+    instrument.PriceTick = message.price_tick();
+    instrument.CreateDate = message.create_date();
+    instrument.OpenDate = message.open_date();
+    instrument.ExpireDate = message.expire_date();
+    instrument.StartDelivDate = message.start_deliv_date();
+    instrument.EndDelivDate = message.end_deliv_date();
+    instrument.InstLifePhase = firstChar(message.inst_life_phase());
+    instrument.IsTrading = message.is_trading() != 0;
+    instrument.PositionType = firstChar(message.position_type());
+    instrument.PositionDateType = firstChar(message.position_date_type());
+    instrument.LongMarginRatio = message.long_margin_ratio();
+    instrument.ShortMarginRatio = message.short_margin_ratio();
+    instrument.MaxMarginSideAlgorithm = firstChar(message.max_margin_side_algorithm());
+    instrument.UnderlyingInstrID = message.underlying_instr_id();
+    instrument.StrikePrice = message.strike_price();
+    instrument.OptionsType = firstChar(message.options_type());
+    instrument.UnderlyingMultiple = message.underlying_multiple();
+    instrument.CombinationType = firstChar(message.combination_type());
+}
+
+bool InstrumentConverter::parseProtobufBatch(const char* data, size_t size, std::vector<CTPInstrumentField>& instruments) {
+    instruments.clear();
+    ctp::InstrumentBatchMessage batch;
+    if (!batch.ParseFromArray(data, static_cast<int>(size))) {
+        return false;
+    }
+    instruments.resize(batch.instruments_size());
+    for (int i = 0; i < batch.instruments_size(); ++i) {
+        fromProtobuf(batch.instruments(i), instruments[i]);
+    }
+    return true;
+}
+
 std::vector<CTPInstrumentField> InstrumentConverter::parseProtobufBatch(const std::string& protobufData) {
     std::vector<CTPInstrumentField> instruments;
-    
-    try {
-        // 这里应该解析protobuf数据
-        // 由于protobuf文件可能还没有编译，我们先返回空结果
-        // 后续需要添加protobuf解析逻辑
-        
-        std::cout << "Protobuf合约数据解析功能待实现，数据长度: " << protobufData.length() << std::endl;
-        
-    } catch (const std::exception& e) {
-        std::cerr << "解析protobuf合约数据异常: " << e.what() << std::endl;
+    if (!parseProtobufBatch(protobufData.data(), protobufData.size(), instruments)) {
+        std::cerr << "解析protobuf合约数据失败，数据长度: " << protobufData.length() << std::endl;
     }
-    
     return instruments;
-} 
\ No newline at end of file
+}
@@ -2,12 +2,21 @@
 #include <sstream>
 #include <iostream>
 #include <iomanip>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 bool MarketDataConverter::isCSVFormat(const std::string& data) {
     // 检查是否为CSV格式的行情数据
-    // 行情数据通常包含特定的格式：EL/CTP_TICKER/合约/T/1 || CSV数据
+    // 行情数据通常包含特定的格式：EL/CTP_TICKER/合约/T/1 || CSV数据，旧版ctpquote为EL/CTP_XZ/合约/O/1 || CSV数据
     if (data.find("||") != std::string::npos && 
-        data.find("EL/CTP_TICKER") != std::string::npos) {
+        (data.find("EL/CTP_TICKER") != std::string::npos || data.find("EL/CTP_XZ") != std::string::npos)) {
         return true;
     }
     return false;
@@ -15,75 +24,244 @@ bool MarketDataConverter::isCSVFormat(const std::string& data) {
 
 CTPMarketDataField MarketDataConverter::parseCSV(const std::string& csvData) {
     CTPMarketDataField marketData = {};
-    
-    try {
-        // 分割 header || csv_content
-        size_t separatorPos = csvData.find("||");
-        if (separatorPos == std::string::npos) {
-            std::cerr << "行情数据格式错误：找不到分隔符 ||" << std::endl;
-            return marketData;
+    if (!parseCSV(csvData.data(), csvData.size(), marketData)) {
+        std::cerr << "行情数据格式错误：找不到分隔符||或字段数不足" << std::endl;
+        return CTPMarketDataField{};
+    }
+    return marketData;
+}
+
+namespace {
+
+const size_t kMaxFields = 64;
+
+// 找出[begin, end)中所有逗号的位置，最多maxCount个；默认编译选项下走SSE2，加-mavx2/-march=native后走AVX2
+size_t findCommas(const char* begin, const char* end, const char** out, size_t maxCount) {
+    size_t count = 0;
+    const char* p = begin;
+#if defined(__AVX2__)
+    const __m256i comma32 = _mm256_set1_epi8(',');
+    for (; p + 32 <= end && count < maxCount; p += 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, comma32)));
+        while (mask != 0 && count < maxCount) {
+            out[count++] = p + __builtin_ctz(mask);
+            mask &= mask - 1;
         }
-        
-        std::string csvContent = csvData.substr(separatorPos + 2);
-        std::vector<std::string> fields = split(csvContent, ',');
-        
-        if (fields.size() < 44) {  // 至少需要44个字段
-            std::cerr << "行情数据字段不足，需要至少44个字段，实际: " << fields.size() << std::endl;
-            return marketData;
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128i comma16 = _mm_set1_epi8(',');
+    for (; p + 16 <= end && count < maxCount; p += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, comma16)));
+        while (mask != 0 && count < maxCount) {
+            out[count++] = p + __builtin_ctz(mask);
+            mask &= mask - 1;
         }
-        
-        // 按照CTPQuote.cpp中OnRtnDepthMarketData的输出顺序解析
-        int idx = 0;
-        marketData.TradingDay = fields[idx++];          // 0: TradingDay
-        marketData.InstrumentID = fields[idx++];        // 1: InstrumentID
-        marketData.ExchangeID = fields[idx++];          // 2: ExchangeID
-        marketData.ExchangeInstID = fields[idx++];      // 3: ExchangeInstID
-        marketData.LastPrice = safeStringToDouble(fields[idx++]);           // 4: LastPrice
-        marketData.PreSettlementPrice = safeStringToDouble(fields[idx++]);  // 5: PreSettlementPrice
-        marketData.PreClosePrice = safeStringToDouble(fields[idx++]);       // 6: PreClosePrice
-        marketData.PreOpenInterest = safeStringToDouble(fields[idx++]);     // 7: PreOpenInterest
-        marketData.OpenPrice = safeStringToDouble(fields[idx++]);           // 8: OpenPrice
-        marketData.HighestPrice = safeStringToDouble(fields[idx++]);        // 9: HighestPrice
-        marketData.LowestPrice = safeStringToDouble(fields[idx++]);         // 10: LowestPrice
-        marketData.Volume = safeStringToInt(fields[idx++]);                 // 11: Volume
-        marketData.Turnover = safeStringToDouble(fields[idx++]);            // 12: Turnover
-        marketData.OpenInterest = safeStringToDouble(fields[idx++]);        // 13: OpenInterest
-        marketData.ClosePrice = safeStringToDouble(fields[idx++]);          // 14: ClosePrice
-        marketData.SettlementPrice = safeStringToDouble(fields[idx++]);     // 15: SettlementPrice
-        marketData.UpperLimitPrice = safeStringToDouble(fields[idx++]);     // 16: UpperLimitPrice
-        marketData.LowerLimitPrice = safeStringToDouble(fields[idx++]);     // 17: LowerLimitPrice
-        marketData.PreDelta = safeStringToDouble(fields[idx++]);            // 18: PreDelta
-        marketData.CurrDelta = safeStringToDouble(fields[idx++]);           // 19: CurrDelta
-        marketData.UpdateTime = fields[idx++];          // 20: UpdateTime
-        marketData.UpdateMillisec = safeStringToInt(fields[idx++]);         // 21: UpdateMillisec
-        marketData.BidPrice1 = safeStringToDouble(fields[idx++]);           // 22: BidPrice1
-        marketData.BidVolume1 = safeStringToInt(fields[idx++]);             // 23: BidVolume1
-        marketData.AskPrice1 = safeStringToDouble(fields[idx++]);           // 24: AskPrice1
-        marketData.AskVolume1 = safeStringToInt(fields[idx++]);             // 25: AskVolume1
-        marketData.BidPrice2 = safeStringToDouble(fields[idx++]);           // 26: BidPrice2
-        marketData.BidVolume2 = safeStringToInt(fields[idx++]);             // 27: BidVolume2
-        marketData.AskPrice2 = safeStringToDouble(fields[idx++]);           // 28: AskPrice2
-        marketData.AskVolume2 = safeStringToInt(fields[idx++]);             // 29: AskVolume2
-        marketData.BidPrice3 = safeStringToDouble(fields[idx++]);           // 30: BidPrice3
-        marketData.BidVolume3 = safeStringToInt(fields[idx++]);             // 31: BidVolume3
-        marketData.AskPrice3 = safeStringToDouble(fields[idx++]);           // 32: AskPrice3
-        marketData.AskVolume3 = safeStringToInt(fields[idx++]);             // 33: AskVolume3
-        marketData.BidPrice4 = safeStringToDouble(fields[idx++]);           // 34: BidPrice4
-        marketData.BidVolume4 = safeStringToInt(fields[idx++]);             // 35: BidVolume4
-        marketData.AskPrice4 = safeStringToDouble(fields[idx++]);           // 36: AskPrice4
-        marketData.AskVolume4 = safeStringToInt(fields[idx++]);             // 37: AskVolume4
-        marketData.BidPrice5 = safeStringToDouble(fields[idx++]);           // 38: BidPrice5
-        marketData.BidVolume5 = safeStringToInt(fields[idx++]);             // 39: BidVolume5
-        marketData.AskPrice5 = safeStringToDouble(fields[idx++]);           // 40: AskPrice5
-        marketData.AskVolume5 = safeStringToInt(fields[idx++]);             // 41: AskVolume5
-        marketData.AveragePrice = safeStringToDouble(fields[idx++]);        // 42: AveragePrice
-        marketData.ActionDay = fields[idx++];           // 43: ActionDay
-        
-    } catch (const std::exception& e) {
-        std::cerr << "解析行情数据时出错: " << e.what() << std::endl;
     }
-    
-    return marketData;
+#endif
+    for (; p < end && count < maxCount; ++p) {
+        if (*p == ',') {
+            out[count++] = p;
+        }
+    }
+    return count;
+}
+
+const double kPow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15
+};
+
+// 与safeStringToDouble结果一致：空串、无法解析、nan/inf都为0，数字后面的多余字符忽略。
+// 行情里的价格都是不超过15位有效数字的定点小数，尾数和10的幂都能精确表示为double，一次除法即是正确舍入的结果；
+// 带指数或位数过多时交给from_chars
+double parseDouble(const char* p, const char* end) {
+    while (p < end && *p == ' ') {
+        ++p;
+    }
+    const char* start = p;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int fraction = 0;
+    for (; p < end && static_cast<unsigned>(*p - '0') < 10; ++p, ++digits) {
+        mantissa = mantissa * 10 + static_cast<unsigned>(*p - '0');
+    }
+    if (p < end && *p == '.') {
+        for (++p; p < end && static_cast<unsigned>(*p - '0') < 10; ++p, ++digits, ++fraction) {
+            mantissa = mantissa * 10 + static_cast<unsigned>(*p - '0');
+        }
+    }
+    bool exponent = p < end && (*p == 'e' || *p == 'E');
+    if (digits > 0 && digits <= 15 && !exponent) {
+        double value = static_cast<double>(mantissa) / kPow10[fraction];
+        return negative ? -value : value;
+    }
+    if (start < end && *start == '+') {
+        ++start;
+    }
+    double value = 0.0;
+    auto result = std::from_chars(start, end, value);
+    if (result.ec != std::errc() || !std::isfinite(value)) {
+        return 0.0;
+    }
+    return value;
+}
+
+// 与safeStringToInt结果一致：空串、无法解析或超出int范围为0，"12.5"这类取整数部分
+int parseInt(const char* p, const char* end) {
+    while (p < end && *p == ' ') {
+        ++p;
+    }
+    if (p < end && *p == '+') {
+        ++p;
+    }
+    int value = 0;
+    auto result = std::from_chars(p, end, value);
+    return result.ec == std::errc() ? value : 0;
+}
+
+enum FieldKind { FieldString, FieldDouble, FieldInt };
+
+struct FieldSpec {
+    FieldKind kind;
+    std::string CTPMarketDataField::* text;
+    double CTPMarketDataField::* real;
+    int CTPMarketDataField::* integer;
+};
+
+#define CSV_STRING(name) { FieldString, &CTPMarketDataField::name, nullptr, nullptr }
+#define CSV_DOUBLE(name) { FieldDouble, nullptr, &CTPMarketDataField::name, nullptr }
+#define CSV_INT(name) { FieldInt, nullptr, nullptr, &CTPMarketDataField::name }
+
+// CTPQuote.cpp中OnRtnDepthMarketData的输出顺序，EL/CTP_TICKER主题，44个字段
+const FieldSpec kTickerLayout[] = {
+    CSV_STRING(TradingDay), CSV_STRING(InstrumentID), CSV_STRING(ExchangeID), CSV_STRING(ExchangeInstID),
+    CSV_DOUBLE(LastPrice), CSV_DOUBLE(PreSettlementPrice), CSV_DOUBLE(PreClosePrice), CSV_DOUBLE(PreOpenInterest),
+    CSV_DOUBLE(OpenPrice), CSV_DOUBLE(HighestPrice), CSV_DOUBLE(LowestPrice), CSV_INT(Volume),
+    CSV_DOUBLE(Turnover), CSV_DOUBLE(OpenInterest), CSV_DOUBLE(ClosePrice), CSV_DOUBLE(SettlementPrice),
+    CSV_DOUBLE(UpperLimitPrice), CSV_DOUBLE(LowerLimitPrice), CSV_DOUBLE(PreDelta), CSV_DOUBLE(CurrDelta),
+    CSV_STRING(UpdateTime), CSV_INT(UpdateMillisec),
+    CSV_DOUBLE(BidPrice1), CSV_INT(BidVolume1), CSV_DOUBLE(AskPrice1), CSV_INT(AskVolume1),
+    CSV_DOUBLE(BidPrice2), CSV_INT(BidVolume2), CSV_DOUBLE(AskPrice2), CSV_INT(AskVolume2),
+    CSV_DOUBLE(BidPrice3), CSV_INT(BidVolume3), CSV_DOUBLE(AskPrice3), CSV_INT(AskVolume3),
+    CSV_DOUBLE(BidPrice4), CSV_INT(BidVolume4), CSV_DOUBLE(AskPrice4), CSV_INT(AskVolume4),
+    CSV_DOUBLE(BidPrice5), CSV_INT(BidVolume5), CSV_DOUBLE(AskPrice5), CSV_INT(AskVolume5),
+    CSV_DOUBLE(AveragePrice), CSV_STRING(ActionDay)
+};
+
+#undef CSV_STRING
+#undef CSV_DOUBLE
+#undef CSV_INT
+
+const size_t kTickerFields = sizeof(kTickerLayout) / sizeof(kTickerLayout[0]);
+
+// 旧版ctpquote的EL/CTP_XZ主题，13个字段:
+// 合约,业务日期 时间.毫秒,买一价,卖一价,买一量,卖一量,最新价,成交量,(空),持仓量,成交额,本地时间,交易日
+const size_t kLegacyFields = 13;
+
+// 旧格式字段不全，out跨消息复用，先清空；字符串clear保留容量
+void resetField(CTPMarketDataField& out) {
+    for (const FieldSpec& spec : kTickerLayout) {
+        switch (spec.kind) {
+        case FieldString: (out.*spec.text).clear(); break;
+        case FieldDouble: out.*spec.real = 0.0; break;
+        case FieldInt: out.*spec.integer = 0; break;
+        }
+    }
+}
+
+}
+
+bool MarketDataConverter::parseCSV(const char* data, size_t len, CTPMarketDataField& out) {
+    const char* end = data + len;
+    const char* body = nullptr;
+    for (const char* p = static_cast<const char*>(memchr(data, '|', len)); p && p + 1 < end;
+         p = static_cast<const char*>(memchr(p + 1, '|', end - p - 1))) {
+        if (p[1] == '|') {
+            body = p + 2;
+            break;
+        }
+    }
+    if (!body) {
+        return false;
+    }
+
+    // 字段i为[begins[i], ends[i])
+    const char* commas[kMaxFields];
+    size_t count = findCommas(body, end, commas, kMaxFields - 1) + 1;
+    const char* begins[kMaxFields];
+    const char* ends[kMaxFields];
+    begins[0] = body;
+    for (size_t i = 1; i < count; ++i) {
+        ends[i - 1] = commas[i - 1];
+        begins[i] = commas[i - 1] + 1;
+    }
+    ends[count - 1] = end;
+
+    if (count >= kTickerFields) {
+        for (size_t i = 0; i < kTickerFields; ++i) {
+            const FieldSpec& spec = kTickerLayout[i];
+            const char* b = begins[i];
+            const char* e = ends[i];
+            switch (spec.kind) {
+            case FieldString: (out.*spec.text).assign(b, e - b); break;
+            case FieldDouble: out.*spec.real = parseDouble(b, e); break;
+            case FieldInt: out.*spec.integer = parseInt(b, e); break;
+            }
+        }
+        return true;
+    }
+    if (count == kLegacyFields) {
+        // ctpquote在||后面带一个空格；44字段格式与原来的split解析一致，不去空格
+        while (begins[0] < ends[0] && *begins[0] == ' ') {
+            ++begins[0];
+        }
+        resetField(out);
+        auto field = [&](size_t i, const char*& b, const char*& e) {
+            b = begins[i];
+            e = ends[i];
+        };
+        const char* b;
+        const char* e;
+        field(0, b, e);
+        out.InstrumentID.assign(b, e - b);
+        out.ExchangeInstID = out.InstrumentID;
+        // 业务日期 HH:MM:SS.毫秒
+        field(1, b, e);
+        const char* space = static_cast<const char*>(memchr(b, ' ', e - b));
+        if (space) {
+            out.ActionDay.assign(b, space - b);
+            const char* dot = static_cast<const char*>(memchr(space + 1, '.', e - space - 1));
+            out.UpdateTime.assign(space + 1, (dot ? dot : e) - space - 1);
+            out.UpdateMillisec = dot ? parseInt(dot + 1, e) : 0;
+        }
+        field(2, b, e);
+        out.BidPrice1 = parseDouble(b, e);
+        field(3, b, e);
+        out.AskPrice1 = parseDouble(b, e);
+        field(4, b, e);
+        out.BidVolume1 = parseInt(b, e);
+        field(5, b, e);
+        out.AskVolume1 = parseInt(b, e);
+        field(6, b, e);
+        out.LastPrice = parseDouble(b, e);
+        field(7, b, e);
+        out.Volume = parseInt(b, e);
+        field(9, b, e);
+        out.OpenInterest = parseDouble(b, e);
+        field(10, b, e);
+        out.Turnover = parseDouble(b, e);
+        field(12, b, e);
+        out.TradingDay.assign(b, e - b);
+        return true;
+    }
+    return false;
 }
 
 std::string MarketDataConverter::convertToDatabaseFormat(const CTPMarketDataField& marketData) {
@@ -0,0 +1,162 @@
+#include "../include/MarketDataFilter.h"
+#include "../include/MarketTopic.h"
+#include "../include/ProductTable.h"
+#include <cstdint>
+
+void MarketDataFilter::addQualified(std::unordered_map<std::string, std::string>& table, const std::string& entry) {
+    size_t dot = entry.find('.');
+    if (dot == std::string::npos) {
+        table[entry] = "";
+    } else {
+        table[entry.substr(dot + 1)] = entry.substr(0, dot);
+    }
+}
+
+void MarketDataFilter::addExchanges(const std::vector<std::string>& items) {
+    exchanges.insert(items.begin(), items.end());
+}
+
+void MarketDataFilter::addProducts(const std::vector<std::string>& items) {
+    for (const auto& item : items) {
+        addQualified(products, item);
+    }
+}
+
+void MarketDataFilter::addInstruments(const std::vector<std::string>& items) {
+    for (const auto& item : items) {
+        addQualified(instruments, item);
+    }
+}
+
+bool MarketDataFilter::matches(const std::unordered_map<std::string, std::string>& table, const std::string& key,
+                               const std::string& exchange) {
+    auto it = table.find(key);
+    return it != table.end() && (it->second.empty() || exchange.empty() || it->second == exchange);
+}
+
+const std::string& MarketDataFilter::productExchange(const std::string& product) {
+    // 由共用的品种表生成，按std::string返回，accept()里不必再构造字符串
+    static const std::unordered_map<std::string, std::string> kProductExchanges = [] {
+        std::unordered_map<std::string, std::string> table;
+        size_t count = 0;
+        const ProductTable::Entry* entries = ProductTable::entries(count);
+        for (size_t i = 0; i < count; ++i) {
+            table.emplace(entries[i].product, entries[i].exchange);
+        }
+        return table;
+    }();
+    static const std::string kNone;
+    auto it = kProductExchanges.find(product);
+    return it != kProductExchanges.end() ? it->second : kNone;
+}
+
+bool MarketDataFilter::accept(const std::string& exchange, const std::string& instrument) const {
+    if (empty()) {
+        return true;
+    }
+    // 交易所缺失时按品种补齐，否则只配了交易所白名单会把这些行情全部丢掉
+    std::string product;
+    const std::string* resolved = &exchange;
+    if (exchange.empty() || exchange == MarketTopic::kUnknownExchange) {
+        product = MarketTopic::product(instrument);
+        resolved = &productExchange(product);
+    }
+    if (!resolved->empty() && exchanges.count(*resolved) > 0) {
+        return true;
+    }
+    if (matches(instruments, instrument, *resolved)) {
+        return true;
+    }
+    if (products.empty()) {
+        return false;
+    }
+    if (product.empty()) {
+        product = MarketTopic::product(instrument);
+    }
+    return matches(products, product, *resolved);
+}
+
+bool MarketDataFilter::subscriptionPrefixes(std::vector<std::string>& prefixes) const {
+    std::vector<std::string> out;
+    for (const auto& exchange : exchanges) {
+        out.push_back(MarketTopic::prefix(exchange));
+    }
+    for (const auto& kv : products) {
+        if (kv.second.empty()) {
+            return false;
+        }
+        out.push_back(MarketTopic::prefix(kv.second, kv.first));
+    }
+    for (const auto& kv : instruments) {
+        if (kv.second.empty()) {
+            return false;
+        }
+        out.push_back(MarketTopic::prefix(kv.second, MarketTopic::product(kv.first), kv.first));
+    }
+    prefixes.swap(out);
+    return true;
+}
+
+// protobuf varint，越界返回false
+static bool readVarint(const std::string& data, size_t& pos, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && pos < data.size(); shift += 7) {
+        uint8_t byte = static_cast<uint8_t>(data[pos++]);
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MarketDataFilter::peekInstrument(const std::string& message, std::string& instrument, std::string& exchange) {
+    instrument.clear();
+    exchange.clear();
+    size_t pos = 0;
+    while (pos < message.size()) {
+        uint64_t tag = 0;
+        if (!readVarint(message, pos, tag)) {
+            return false;
+        }
+        uint64_t field = tag >> 3;
+        uint32_t wireType = static_cast<uint32_t>(tag & 7);
+        if (field > 3) {
+            break;
+        }
+        if (wireType != 2) {
+            return false;
+        }
+        uint64_t len = 0;
+        if (!readVarint(message, pos, len) || len > message.size() - pos) {
+            return false;
+        }
+        if (field == 2) {
+            instrument.assign(message, pos, len);
+        } else if (field == 3) {
+            exchange.assign(message, pos, len);
+        }
+        pos += len;
+    }
+    return !instrument.empty();
+}
+
+std::string MarketDataFilter::describe() const {
+    if (empty()) {
+        return "全部";
+    }
+    std::string out;
+    auto append = [&out](const std::string& label, const std::string& exchange, const std::string& name) {
+        out += (out.empty() ? "" : " ") + label + "=" + (exchange.empty() ? "" : exchange + ".") + name;
+    };
+    for (const auto& exchange : exchanges) {
+        append("交易所", "", exchange);
+    }
+    for (const auto& kv : products) {
+        append("品种", kv.second, kv.first);
+    }
+    for (const auto& kv : instruments) {
+        append("合约", kv.second, kv.first);
+    }
+    return out;
+}
@@ -0,0 +1,76 @@
+#include <cstring>
+#include "MarketTopic.h"
+
+using namespace std;
+
+const char* const MarketTopic::kPrefix = "MD.";
+const char* const MarketTopic::kUnknownExchange = "UNKNOWN";
+
+static bool isLetter(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+string MarketTopic::product(const string& instrumentId)
+{
+    size_t n = 0;
+    while (n < instrumentId.size() && isLetter(instrumentId[n]))
+    {
+        ++n;
+    }
+    return instrumentId.substr(0, n);
+}
+
+void MarketTopic::build(const char* exchangeId, const char* instrumentId, string& out)
+{
+    size_t productLen = 0;
+    while (isLetter(instrumentId[productLen]))
+    {
+        ++productLen;
+    }
+    out.assign(kPrefix);
+    out.append(exchangeId[0] != '\0' ? exchangeId : kUnknownExchange);
+    out.push_back('.');
+    out.append(instrumentId, productLen);
+    out.push_back('.');
+    out.append(instrumentId);
+}
+
+string MarketTopic::prefix(const string& exchangeId, const string& product, const string& instrumentId)
+{
+    string out = kPrefix + (exchangeId.empty() ? string(kUnknownExchange) : exchangeId) + ".";
+    if (product.empty())
+    {
+        return out;
+    }
+    out += product + ".";
+    return out + instrumentId;
+}
+
+bool MarketTopic::isMarketTopic(const string& topic)
+{
+    return topic.compare(0, strlen(kPrefix), kPrefix) == 0;
+}
+
+bool MarketTopic::parse(const string& topic, string& exchangeId, string& product, string& instrumentId)
+{
+    if (!isMarketTopic(topic))
+    {
+        return false;
+    }
+    size_t begin = strlen(kPrefix);
+    size_t dot1 = topic.find('.', begin);
+    if (dot1 == string::npos)
+    {
+        return false;
+    }
+    size_t dot2 = topic.find('.', dot1 + 1);
+    if (dot2 == string::npos || dot2 + 1 >= topic.size())
+    {
+        return false;
+    }
+    exchangeId = topic.substr(begin, dot1 - begin);
+    product = topic.substr(dot1 + 1, dot2 - dot1 - 1);
+    instrumentId = topic.substr(dot2 + 1);
+    return true;
+}
@@ -0,0 +1,253 @@
+#include "../include/PartitionManager.h"
+#include <cstdio>
+#include <algorithm>
+
+// 可由market.partition.indexes选择保留的二级索引，与建表语句中的定义一致
+static const struct {
+    const char* name;
+    const char* columns;
+} kIndexDefs[] = {
+    {"idx_instrument_time", "(InstrumentID, TradingDay, UpdateTime)"},
+    {"idx_trading_day", "(TradingDay)"},
+    {"idx_update_time", "(UpdateTime)"},
+    {"idx_record_time", "(RecordTime)"},
+};
+
+static const char* indexColumns(const std::string& name) {
+    for (const auto& def : kIndexDefs) {
+        if (name == def.name) {
+            return def.columns;
+        }
+    }
+    return nullptr;
+}
+
+PartitionManager::PartitionManager(std::shared_ptr<DatabaseManager> db, std::shared_ptr<Logger> logger,
+                                   const std::string& table)
+    : db(db), logger(logger), table(table), aheadDays(3), retentionDays(0), expireAction(EXPIRE_KEEP),
+      convertExisting(false), manageIndexes(false) {
+}
+
+void PartitionManager::info(const std::string& message) {
+    if (logger) {
+        logger->info("[分区] " + message);
+    }
+}
+
+void PartitionManager::warning(const std::string& message) {
+    if (logger) {
+        logger->warning("[分区] " + message);
+    }
+}
+
+PartitionManager::ExpireAction PartitionManager::parseExpireAction(const std::string& text) {
+    if (text == "drop") {
+        return EXPIRE_DROP;
+    }
+    if (text == "archive") {
+        return EXPIRE_ARCHIVE;
+    }
+    return EXPIRE_KEEP;
+}
+
+std::string PartitionManager::formatDate(time_t t) {
+    struct tm local;
+    localtime_r(&t, &local);
+    char buf[16];
+    strftime(buf, sizeof(buf), "%Y%m%d", &local);
+    return buf;
+}
+
+std::string PartitionManager::shiftDate(const std::string& date, int days) {
+    int y = 0, m = 0, d = 0;
+    if (sscanf(date.c_str(), "%4d%2d%2d", &y, &m, &d) != 3) {
+        return date;
+    }
+    struct tm t = {};
+    t.tm_year = y - 1900;
+    t.tm_mon = m - 1;
+    t.tm_mday = d + days;
+    t.tm_hour = 12;     // 取中午，避免夏令时切换落到前一天
+    t.tm_isdst = -1;
+    return formatDate(mktime(&t));
+}
+
+std::string PartitionManager::createClause() {
+    return " PARTITION BY RANGE COLUMNS(TradingDay) (PARTITION pmax VALUES LESS THAN (MAXVALUE))";
+}
+
+bool PartitionManager::loadPartitions(std::vector<Partition>& partitions, bool& partitioned) {
+    auto rs = db->query("SELECT PARTITION_NAME, PARTITION_DESCRIPTION FROM INFORMATION_SCHEMA.PARTITIONS "
+                        "WHERE TABLE_SCHEMA = DATABASE() AND TABLE_NAME = '" + table + "' "
+                        "ORDER BY PARTITION_ORDINAL_POSITION");
+    if (!rs) {
+        return false;
+    }
+    partitions.clear();
+    partitioned = false;
+    while (rs->next()) {
+        // 未分区的表也有一行，PARTITION_NAME为NULL
+        if (rs->isNull(1)) {
+            continue;
+        }
+        partitioned = true;
+        Partition p;
+        p.name = rs->getString(1);
+        if (p.name.size() == 9 && p.name[0] == 'p' &&
+            std::all_of(p.name.begin() + 1, p.name.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+            p.date = p.name.substr(1);
+        }
+        // RANGE COLUMNS的上界带引号，如'20240102'；pmax为MAXVALUE
+        std::string description = rs->isNull(2) ? "" : std::string(rs->getString(2));
+        description.erase(std::remove(description.begin(), description.end(), '\''), description.end());
+        if (description != "MAXVALUE") {
+            p.before = description;
+        }
+        partitions.push_back(p);
+    }
+    return true;
+}
+
+bool PartitionManager::convertTable(const std::string& today) {
+    // 分区键必须包含在主键中；今天之前的数据放在phistory，之后按天分区
+    info("开始转换为分区表，数据量大时耗时较长: " + table);
+    std::string sql = "ALTER TABLE " + table + " DROP PRIMARY KEY, ADD PRIMARY KEY (id, TradingDay)"
+                      " PARTITION BY RANGE COLUMNS(TradingDay) ("
+                      "PARTITION phistory VALUES LESS THAN ('" + today + "'), "
+                      "PARTITION pmax VALUES LESS THAN (MAXVALUE))";
+    if (!db->execute(sql)) {
+        warning("转换为分区表失败: " + table);
+        return false;
+    }
+    info("已转换为分区表: " + table);
+    return true;
+}
+
+void PartitionManager::addPartitions(const std::vector<Partition>& partitions, const std::string& today) {
+    std::string last;
+    bool hasMax = false;
+    for (const auto& p : partitions) {
+        if (!p.date.empty() && p.date > last) {
+            last = p.date;
+        }
+        hasMax = hasMax || p.name == "pmax";
+    }
+
+    // 从最后一个日分区的次日补到今天之后aheadDays天，中间停机的日期也补上
+    std::string date = last.empty() ? today : shiftDate(last, 1);
+    std::string until = shiftDate(today, aheadDays);
+    std::string defs;
+    std::vector<std::string> added;
+    for (; date <= until; date = shiftDate(date, 1)) {
+        defs += (defs.empty() ? "" : ", ") + std::string("PARTITION p") + date +
+                " VALUES LESS THAN ('" + shiftDate(date, 1) + "')";
+        added.push_back(date);
+    }
+    if (added.empty()) {
+        return;
+    }
+
+    // pmax通常为空，拆分只改元数据
+    std::string sql = hasMax
+        ? "ALTER TABLE " + table + " REORGANIZE PARTITION pmax INTO (" + defs +
+          ", PARTITION pmax VALUES LESS THAN (MAXVALUE))"
+        : "ALTER TABLE " + table + " ADD PARTITION (" + defs + ")";
+    if (db->execute(sql)) {
+        info("新建分区 p" + added.front() + (added.size() > 1 ? " ~ p" + added.back() : ""));
+    } else {
+        warning("新建分区失败 p" + added.front());
+    }
+}
+
+void PartitionManager::expirePartitions(const std::vector<Partition>& partitions, const std::string& today) {
+    if (retentionDays <= 0 || expireAction == EXPIRE_KEEP) {
+        return;
+    }
+    // 上界不晚于截止日的分区整个过期：日分区即日期早于截止日，phistory要等保留期覆盖到转换当天
+    std::string cutoff = shiftDate(today, -retentionDays);
+    for (const auto& p : partitions) {
+        if (p.before.empty() || p.before > cutoff) {
+            continue;
+        }
+        if (expireAction == EXPIRE_ARCHIVE) {
+            // 换出到同结构的普通表，换出本身只交换元数据；归档表可再导出或单独删除
+            std::string archive = table + "_" + (p.date.empty() ? p.name.substr(1) : p.date);
+            bool ok = db->execute("CREATE TABLE IF NOT EXISTS " + archive + " LIKE " + table) &&
+                      db->execute("ALTER TABLE " + archive + " REMOVE PARTITIONING") &&
+                      db->execute("ALTER TABLE " + table + " EXCHANGE PARTITION " + p.name + " WITH TABLE " + archive);
+            if (!ok) {
+                warning("归档分区失败，保留分区: " + p.name);
+                continue;
+            }
+            info("分区已归档到 " + archive);
+        }
+        if (db->execute("ALTER TABLE " + table + " DROP PARTITION " + p.name)) {
+            info("删除过期分区: " + p.name);
+        } else {
+            warning("删除过期分区失败: " + p.name);
+        }
+    }
+}
+
+void PartitionManager::syncIndexes() {
+    std::vector<std::string> existing;
+    auto rs = db->query("SELECT DISTINCT INDEX_NAME FROM INFORMATION_SCHEMA.STATISTICS "
+                        "WHERE TABLE_SCHEMA = DATABASE() AND TABLE_NAME = '" + table + "' AND INDEX_NAME <> 'PRIMARY'");
+    if (!rs) {
+        return;
+    }
+    while (rs->next()) {
+        existing.push_back(rs->getString(1));
+    }
+
+    // 只删除已知的索引，手工加的索引不动
+    for (const auto& name : existing) {
+        if (indexColumns(name) && std::find(keepIndexes.begin(), keepIndexes.end(), name) == keepIndexes.end()) {
+            if (db->execute("ALTER TABLE " + table + " DROP INDEX " + name)) {
+                info("删除索引: " + name);
+            }
+        }
+    }
+    for (const auto& name : keepIndexes) {
+        const char* columns = indexColumns(name);
+        if (!columns) {
+            warning("未知的索引: " + name);
+            continue;
+        }
+        if (std::find(existing.begin(), existing.end(), name) == existing.end()) {
+            if (db->execute("ALTER TABLE " + table + " ADD INDEX " + name + " " + columns)) {
+                info("补建索引: " + name);
+            }
+        }
+    }
+}
+
+void PartitionManager::maintain(time_t now) {
+    if (!db || !db->isConnected()) {
+        return;
+    }
+    std::string today = formatDate(now);
+
+    std::vector<Partition> partitions;
+    bool partitioned = false;
+    if (!loadPartitions(partitions, partitioned)) {
+        return;
+    }
+    if (!partitioned) {
+        if (!convertExisting) {
+            warning(table + " 不是分区表，设置market.partition.convert_existing=1后自动转换");
+            return;
+        }
+        if (!convertTable(today) || !loadPartitions(partitions, partitioned)) {
+            return;
+        }
+    }
+
+    addPartitions(partitions, today);
+    expirePartitions(partitions, today);
+    if (manageIndexes) {
+        syncIndexes();
+        // 索引只需同步一次
+        manageIndexes = false;
+    }
+}
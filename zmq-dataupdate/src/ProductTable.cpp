@@ -0,0 +1,114 @@
+#include <unordered_map>
+#include "ProductTable.h"
+
+using namespace std;
+
+static const ProductTable::Entry kProducts[] = {
+    // 上期所
+    {"cu", "SHFE", ProductTable::SESSION_NIGHT_0100},
+    {"al", "SHFE", ProductTable::SESSION_NIGHT_0100},
+    {"zn", "SHFE", ProductTable::SESSION_NIGHT_0100},
+    {"pb", "SHFE", ProductTable::SESSION_NIGHT_0100},
+    {"ni", "SHFE", ProductTable::SESSION_NIGHT_0100},
+    {"sn", "SHFE", ProductTable::SESSION_NIGHT_0100},
+    {"ss", "SHFE", ProductTable::SESSION_NIGHT_0100},
+    {"ao", "SHFE", ProductTable::SESSION_NIGHT_0100},
+    {"au", "SHFE", ProductTable::SESSION_NIGHT_0230},
+    {"ag", "SHFE", ProductTable::SESSION_NIGHT_0230},
+    {"rb", "SHFE", ProductTable::SESSION_NIGHT_2300},
+    {"hc", "SHFE", ProductTable::SESSION_NIGHT_2300},
+    {"bu", "SHFE", ProductTable::SESSION_NIGHT_2300},
+    {"ru", "SHFE", ProductTable::SESSION_NIGHT_2300},
+    {"fu", "SHFE", ProductTable::SESSION_NIGHT_2300},
+    {"sp", "SHFE", ProductTable::SESSION_NIGHT_2300},
+    {"br", "SHFE", ProductTable::SESSION_NIGHT_2300},
+    {"wr", "SHFE", ProductTable::SESSION_DAY},
+    // 上期能源
+    {"sc", "INE",  ProductTable::SESSION_NIGHT_0230},
+    {"bc", "INE",  ProductTable::SESSION_NIGHT_0100},
+    {"lu", "INE",  ProductTable::SESSION_NIGHT_2300},
+    {"nr", "INE",  ProductTable::SESSION_NIGHT_2300},
+    {"ec", "INE",  ProductTable::SESSION_DAY},
+    // 大商所
+    {"a",  "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"b",  "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"c",  "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"cs", "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"m",  "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"y",  "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"p",  "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"i",  "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"j",  "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"jm", "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"l",  "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"v",  "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"pp", "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"eg", "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"eb", "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"pg", "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"rr", "DCE",  ProductTable::SESSION_NIGHT_2300},
+    {"jd", "DCE",  ProductTable::SESSION_DAY},
+    {"lh", "DCE",  ProductTable::SESSION_DAY},
+    {"fb", "DCE",  ProductTable::SESSION_DAY},
+    {"bb", "DCE",  ProductTable::SESSION_DAY},
+    // 郑商所
+    {"CF", "CZCE", ProductTable::SESSION_NIGHT_2300},
+    {"SR", "CZCE", ProductTable::SESSION_NIGHT_2300},
+    {"TA", "CZCE", ProductTable::SESSION_NIGHT_2300},
+    {"MA", "CZCE", ProductTable::SESSION_NIGHT_2300},
+    {"FG", "CZCE", ProductTable::SESSION_NIGHT_2300},
+    {"RM", "CZCE", ProductTable::SESSION_NIGHT_2300},
+    {"OI", "CZCE", ProductTable::SESSION_NIGHT_2300},
+    {"ZC", "CZCE", ProductTable::SESSION_NIGHT_2300},
+    {"SA", "CZCE", ProductTable::SESSION_NIGHT_2300},
+    {"PF", "CZCE", ProductTable::SESSION_NIGHT_2300},
+    {"CY", "CZCE", ProductTable::SESSION_NIGHT_2300},
+    {"PX", "CZCE", ProductTable::SESSION_NIGHT_2300},
+    {"SH", "CZCE", ProductTable::SESSION_NIGHT_2300},
+    {"SF", "CZCE", ProductTable::SESSION_DAY},
+    {"SM", "CZCE", ProductTable::SESSION_DAY},
+    {"AP", "CZCE", ProductTable::SESSION_DAY},
+    {"CJ", "CZCE", ProductTable::SESSION_DAY},
+    {"UR", "CZCE", ProductTable::SESSION_DAY},
+    {"PK", "CZCE", ProductTable::SESSION_DAY},
+    {"JR", "CZCE", ProductTable::SESSION_DAY},
+    {"LR", "CZCE", ProductTable::SESSION_DAY},
+    {"RI", "CZCE", ProductTable::SESSION_DAY},
+    {"RS", "CZCE", ProductTable::SESSION_DAY},
+    {"WH", "CZCE", ProductTable::SESSION_DAY},
+    {"PM", "CZCE", ProductTable::SESSION_DAY},
+    // 广期所
+    {"si", "GFEX", ProductTable::SESSION_DAY},
+    {"lc", "GFEX", ProductTable::SESSION_DAY},
+    {"ps", "GFEX", ProductTable::SESSION_DAY},
+    // 中金所
+    {"IF", "CFFEX", ProductTable::SESSION_CFFEX_INDEX},
+    {"IH", "CFFEX", ProductTable::SESSION_CFFEX_INDEX},
+    {"IC", "CFFEX", ProductTable::SESSION_CFFEX_INDEX},
+    {"IM", "CFFEX", ProductTable::SESSION_CFFEX_INDEX},
+    {"T",  "CFFEX", ProductTable::SESSION_CFFEX_BOND},
+    {"TF", "CFFEX", ProductTable::SESSION_CFFEX_BOND},
+    {"TS", "CFFEX", ProductTable::SESSION_CFFEX_BOND},
+    {"TL", "CFFEX", ProductTable::SESSION_CFFEX_BOND},
+};
+
+const ProductTable::Entry* ProductTable::entries(size_t& count)
+{
+    count = sizeof(kProducts) / sizeof(kProducts[0]);
+    return kProducts;
+}
+
+const ProductTable::Entry* ProductTable::find(const string& product)
+{
+    static const unordered_map<string, const Entry*> index = []()
+    {
+        unordered_map<string, const Entry*> m;
+        for (auto& p: kProducts)
+        {
+            m.emplace(p.product, &p);
+        }
+        return m;
+    }();
+    auto it = index.find(product);
+    return it == index.end() ? nullptr : it->second;
+}
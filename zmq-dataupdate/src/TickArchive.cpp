@@ -0,0 +1,527 @@
+#include "../include/TickArchive.h"
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <cerrno>
+#include <numeric>
+#include <algorithm>
+#ifdef HAVE_LZ4
+#include <lz4.h>
+#endif
+
+static const char kMagic[8] = {'C', 'T', 'P', 'T', 'I', 'C', 'K', '1'};
+static const uint32_t kVersion = 1;
+static const size_t kFileHeaderSize = 32;
+
+enum ArchiveCodec {
+    CODEC_NONE = 0,
+    CODEC_LZ4 = 1
+};
+
+// 列的编码方式：整数原样取差值；价格换算为priceUnit的整数倍；其它浮点数按固定倍数取整
+enum ColumnKind {
+    COL_INT32,
+    COL_INT64,
+    COL_PRICE,
+    COL_SCALED
+};
+
+struct ColumnDef {
+    ColumnKind kind;
+    size_t offset;
+    int64_t scale;
+};
+
+#define ARCHIVE_COL(kind, field, scale) {kind, offsetof(ArchiveTick, field), scale}
+#define ARCHIVE_LEVEL(kind, field, type, level) {kind, offsetof(ArchiveTick, field) + (level) * sizeof(type), 1}
+
+// 列顺序即文件中的列顺序，只能在末尾追加
+static const ColumnDef kColumns[] = {
+    ARCHIVE_COL(COL_INT32, ActionDay, 1),
+    ARCHIVE_COL(COL_INT32, TimeMs, 1),
+    ARCHIVE_COL(COL_INT64, Volume, 1),
+    ARCHIVE_COL(COL_SCALED, Turnover, 100),
+    ARCHIVE_COL(COL_SCALED, OpenInterest, 1),
+    ARCHIVE_COL(COL_PRICE, LastPrice, 1),
+    ARCHIVE_LEVEL(COL_PRICE, BidPrice, double, 0),
+    ARCHIVE_LEVEL(COL_PRICE, BidPrice, double, 1),
+    ARCHIVE_LEVEL(COL_PRICE, BidPrice, double, 2),
+    ARCHIVE_LEVEL(COL_PRICE, BidPrice, double, 3),
+    ARCHIVE_LEVEL(COL_PRICE, BidPrice, double, 4),
+    ARCHIVE_LEVEL(COL_PRICE, AskPrice, double, 0),
+    ARCHIVE_LEVEL(COL_PRICE, AskPrice, double, 1),
+    ARCHIVE_LEVEL(COL_PRICE, AskPrice, double, 2),
+    ARCHIVE_LEVEL(COL_PRICE, AskPrice, double, 3),
+    ARCHIVE_LEVEL(COL_PRICE, AskPrice, double, 4),
+    ARCHIVE_LEVEL(COL_INT32, BidVolume, int32_t, 0),
+    ARCHIVE_LEVEL(COL_INT32, BidVolume, int32_t, 1),
+    ARCHIVE_LEVEL(COL_INT32, BidVolume, int32_t, 2),
+    ARCHIVE_LEVEL(COL_INT32, BidVolume, int32_t, 3),
+    ARCHIVE_LEVEL(COL_INT32, BidVolume, int32_t, 4),
+    ARCHIVE_LEVEL(COL_INT32, AskVolume, int32_t, 0),
+    ARCHIVE_LEVEL(COL_INT32, AskVolume, int32_t, 1),
+    ARCHIVE_LEVEL(COL_INT32, AskVolume, int32_t, 2),
+    ARCHIVE_LEVEL(COL_INT32, AskVolume, int32_t, 3),
+    ARCHIVE_LEVEL(COL_INT32, AskVolume, int32_t, 4),
+    ARCHIVE_COL(COL_PRICE, OpenPrice, 1),
+    ARCHIVE_COL(COL_PRICE, HighestPrice, 1),
+    ARCHIVE_COL(COL_PRICE, LowestPrice, 1),
+    ARCHIVE_COL(COL_PRICE, ClosePrice, 1),
+    ARCHIVE_COL(COL_PRICE, SettlementPrice, 1),
+    ARCHIVE_COL(COL_PRICE, UpperLimitPrice, 1),
+    ARCHIVE_COL(COL_PRICE, LowerLimitPrice, 1),
+    ARCHIVE_COL(COL_PRICE, PreSettlementPrice, 1),
+    ARCHIVE_COL(COL_PRICE, PreClosePrice, 1),
+    ARCHIVE_COL(COL_SCALED, PreOpenInterest, 1),
+    ARCHIVE_COL(COL_SCALED, AveragePrice, 10000),
+};
+
+static const size_t kColumnCount = sizeof(kColumns) / sizeof(kColumns[0]);
+
+// 价格统一按0.0001取整后求最大公约数作为priceUnit，即该合约实际出现过的最小价格间隔
+static const double kPriceScale = 10000.0;
+
+static void put16(std::vector<uint8_t>& out, uint16_t v) {
+    out.push_back(static_cast<uint8_t>(v));
+    out.push_back(static_cast<uint8_t>(v >> 8));
+}
+
+static void put32(std::vector<uint8_t>& out, uint32_t v) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<uint8_t>(v >> (8 * i)));
+    }
+}
+
+static void put64(std::vector<uint8_t>& out, uint64_t v) {
+    for (int i = 0; i < 8; ++i) {
+        out.push_back(static_cast<uint8_t>(v >> (8 * i)));
+    }
+}
+
+static uint64_t get(const uint8_t* p, int bytes) {
+    uint64_t v = 0;
+    for (int i = 0; i < bytes; ++i) {
+        v |= static_cast<uint64_t>(p[i]) << (8 * i);
+    }
+    return v;
+}
+
+static void putVarint(std::vector<uint8_t>& out, uint64_t v) {
+    while (v >= 0x80) {
+        out.push_back(static_cast<uint8_t>(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(v));
+}
+
+static uint64_t zigzag(int64_t v) {
+    return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+}
+
+static int64_t unzigzag(uint64_t v) {
+    return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+}
+
+// 超出int64范围或CTP未填写的值按0存
+static int64_t toFixed(double value, double scale) {
+    double scaled = value * scale;
+    if (!std::isfinite(scaled) || std::fabs(scaled) >= 9.0e18 || std::fabs(value) >= 1e300) {
+        return 0;
+    }
+    return std::llround(scaled);
+}
+
+static int64_t columnValue(const ArchiveTick& tick, const ColumnDef& col, int64_t priceUnit) {
+    const char* field = reinterpret_cast<const char*>(&tick) + col.offset;
+    switch (col.kind) {
+    case COL_INT32:
+        return *reinterpret_cast<const int32_t*>(field);
+    case COL_INT64:
+        return *reinterpret_cast<const int64_t*>(field);
+    case COL_PRICE:
+        return toFixed(*reinterpret_cast<const double*>(field), kPriceScale) / priceUnit;
+    case COL_SCALED:
+        return toFixed(*reinterpret_cast<const double*>(field), static_cast<double>(col.scale));
+    }
+    return 0;
+}
+
+// 解码一列中的count个值，store把累加后的整数写入对应字段
+template <typename Store>
+static inline bool decodeColumn(const uint8_t*& p, const uint8_t* end, int64_t& value, uint32_t count,
+                                char* field, Store store) {
+    for (uint32_t r = 0; r < count; ++r, field += sizeof(ArchiveTick)) {
+        uint64_t v;
+        if (p < end && *p < 0x80) {
+            // 行情大多数字段相邻两笔不变或变化很小，单字节最常见
+            v = *p++;
+        } else {
+            v = 0;
+            int shift = 0;
+            for (;;) {
+                if (p == end || shift > 63) {
+                    return false;
+                }
+                uint8_t b = *p++;
+                v |= static_cast<uint64_t>(b & 0x7f) << shift;
+                if (b < 0x80) {
+                    break;
+                }
+                shift += 7;
+            }
+        }
+        value += unzigzag(v);
+        store(field, value);
+    }
+    return true;
+}
+
+TickArchiveWriter::TickArchiveWriter() : file(nullptr), rawBytes(0), storedBytes(0) {
+}
+
+TickArchiveWriter::~TickArchiveWriter() {
+    abort();
+}
+
+bool TickArchiveWriter::compressionAvailable() {
+#ifdef HAVE_LZ4
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool TickArchiveWriter::open(const std::string& filePath, const std::string& tradingDay, std::string& error) {
+    abort();
+    if (tradingDay.size() != 8) {
+        error = "交易日格式应为YYYYMMDD: " + tradingDay;
+        return false;
+    }
+    path = filePath;
+    tmpPath = filePath + ".tmp";
+    file = fopen(tmpPath.c_str(), "wb");
+    if (!file) {
+        error = "无法创建文件 " + tmpPath + ": " + strerror(errno);
+        return false;
+    }
+    blocks.clear();
+    rawBytes = 0;
+    storedBytes = 0;
+
+    // 块数和索引偏移在finish时回填
+    std::vector<uint8_t> header(kMagic, kMagic + sizeof(kMagic));
+    put32(header, kVersion);
+    put32(header, 0);
+    header.insert(header.end(), tradingDay.begin(), tradingDay.end());
+    put64(header, 0);
+    if (fwrite(header.data(), 1, header.size(), file) != header.size()) {
+        error = std::string("写文件头失败: ") + strerror(errno);
+        abort();
+        return false;
+    }
+    return true;
+}
+
+bool TickArchiveWriter::writeBlock(const std::string& instrumentId, const std::string& exchangeId,
+                                   const std::vector<ArchiveTick>& ticks, std::string& error) {
+    if (!file) {
+        error = "归档文件未打开";
+        return false;
+    }
+    if (ticks.empty()) {
+        return true;
+    }
+    if (instrumentId.size() > 255 || exchangeId.size() > 255) {
+        error = "合约或交易所代码过长: " + instrumentId;
+        return false;
+    }
+
+    int64_t priceUnit = 0;
+    for (const auto& tick : ticks) {
+        for (const auto& col : kColumns) {
+            if (col.kind == COL_PRICE) {
+                int64_t fixed = toFixed(*reinterpret_cast<const double*>(reinterpret_cast<const char*>(&tick) + col.offset), kPriceScale);
+                priceUnit = std::gcd(priceUnit, fixed < 0 ? -fixed : fixed);
+            }
+        }
+    }
+    if (priceUnit == 0) {
+        priceUnit = 1;
+    }
+
+    raw.clear();
+    std::vector<uint32_t> columnSizes;
+    columnSizes.reserve(kColumnCount);
+    for (const auto& col : kColumns) {
+        size_t start = raw.size();
+        int64_t prev = 0;
+        for (const auto& tick : ticks) {
+            int64_t value = columnValue(tick, col, priceUnit);
+            putVarint(raw, zigzag(value - prev));
+            prev = value;
+        }
+        columnSizes.push_back(static_cast<uint32_t>(raw.size() - start));
+    }
+
+    uint8_t codec = CODEC_NONE;
+    const uint8_t* payload = raw.data();
+    size_t payloadSize = raw.size();
+#ifdef HAVE_LZ4
+    packed.resize(LZ4_compressBound(static_cast<int>(raw.size())));
+    int compressed = LZ4_compress_default(reinterpret_cast<const char*>(raw.data()), reinterpret_cast<char*>(packed.data()),
+                                          static_cast<int>(raw.size()), static_cast<int>(packed.size()));
+    // 压缩后没有变小就原样存
+    if (compressed > 0 && static_cast<size_t>(compressed) < raw.size()) {
+        codec = CODEC_LZ4;
+        payload = packed.data();
+        payloadSize = compressed;
+    }
+#endif
+
+    std::vector<uint8_t> header;
+    put32(header, static_cast<uint32_t>(ticks.size()));
+    put16(header, static_cast<uint16_t>(kColumnCount));
+    header.push_back(codec);
+    header.push_back(0);
+    put64(header, static_cast<uint64_t>(priceUnit));
+    put32(header, static_cast<uint32_t>(raw.size()));
+    put32(header, static_cast<uint32_t>(payloadSize));
+    for (uint32_t size : columnSizes) {
+        put32(header, size);
+    }
+
+    long offset = ftell(file);
+    if (offset < 0 || fwrite(header.data(), 1, header.size(), file) != header.size()
+        || fwrite(payload, 1, payloadSize, file) != payloadSize) {
+        error = std::string("写数据块失败: ") + strerror(errno);
+        return false;
+    }
+
+    ArchiveBlockInfo info;
+    info.InstrumentID = instrumentId;
+    info.ExchangeID = exchangeId;
+    info.offset = static_cast<uint64_t>(offset);
+    info.rows = static_cast<uint32_t>(ticks.size());
+    blocks.push_back(info);
+    rawBytes += raw.size();
+    storedBytes += payloadSize;
+    return true;
+}
+
+bool TickArchiveWriter::finish(std::string& error) {
+    if (!file) {
+        error = "归档文件未打开";
+        return false;
+    }
+    long indexOffset = ftell(file);
+    std::vector<uint8_t> index;
+    for (const auto& block : blocks) {
+        index.push_back(static_cast<uint8_t>(block.InstrumentID.size()));
+        index.insert(index.end(), block.InstrumentID.begin(), block.InstrumentID.end());
+        index.push_back(static_cast<uint8_t>(block.ExchangeID.size()));
+        index.insert(index.end(), block.ExchangeID.begin(), block.ExchangeID.end());
+        put64(index, block.offset);
+        put32(index, block.rows);
+    }
+    std::vector<uint8_t> fields;
+    put32(fields, static_cast<uint32_t>(blocks.size()));
+    std::vector<uint8_t> offsetField;
+    put64(offsetField, static_cast<uint64_t>(indexOffset));
+
+    bool ok = indexOffset >= 0
+        && fwrite(index.data(), 1, index.size(), file) == index.size()
+        && fseek(file, 12, SEEK_SET) == 0
+        && fwrite(fields.data(), 1, fields.size(), file) == fields.size()
+        && fseek(file, 24, SEEK_SET) == 0
+        && fwrite(offsetField.data(), 1, offsetField.size(), file) == offsetField.size();
+    ok = fclose(file) == 0 && ok;
+    file = nullptr;
+    if (!ok) {
+        error = std::string("写索引失败: ") + strerror(errno);
+        remove(tmpPath.c_str());
+        return false;
+    }
+    if (rename(tmpPath.c_str(), path.c_str()) != 0) {
+        error = "重命名 " + tmpPath + " 失败: " + strerror(errno);
+        remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+void TickArchiveWriter::abort() {
+    if (file) {
+        fclose(file);
+        file = nullptr;
+        remove(tmpPath.c_str());
+    }
+}
+
+bool TickArchiveReader::open(const std::string& path, std::string& error) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) {
+        error = "无法打开文件 " + path + ": " + strerror(errno);
+        return false;
+    }
+    std::vector<uint8_t> content;
+    uint8_t buf[1 << 16];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+        content.insert(content.end(), buf, buf + n);
+    }
+    bool readError = ferror(f) != 0;
+    fclose(f);
+    if (readError) {
+        error = "读取文件失败: " + path;
+        return false;
+    }
+    return load(std::move(content), error);
+}
+
+bool TickArchiveReader::load(std::vector<uint8_t> content, std::string& error) {
+    data = std::move(content);
+    blocks.clear();
+    tradingDay.clear();
+    if (data.size() < kFileHeaderSize || memcmp(data.data(), kMagic, sizeof(kMagic)) != 0) {
+        error = "不是行情归档文件";
+        return false;
+    }
+    uint32_t version = static_cast<uint32_t>(get(&data[8], 4));
+    if (version != kVersion) {
+        error = "不支持的归档版本: " + std::to_string(version);
+        return false;
+    }
+    uint32_t blockCount = static_cast<uint32_t>(get(&data[12], 4));
+    tradingDay.assign(reinterpret_cast<const char*>(&data[16]), 8);
+    uint64_t pos = get(&data[24], 8);
+
+    for (uint32_t i = 0; i < blockCount; ++i) {
+        ArchiveBlockInfo info;
+        for (std::string* text : {&info.InstrumentID, &info.ExchangeID}) {
+            if (pos >= data.size() || pos + 1 + data[pos] > data.size()) {
+                error = "索引已损坏";
+                return false;
+            }
+            text->assign(reinterpret_cast<const char*>(&data[pos + 1]), data[pos]);
+            pos += 1 + data[pos];
+        }
+        if (pos + 12 > data.size()) {
+            error = "索引已损坏";
+            return false;
+        }
+        info.offset = get(&data[pos], 8);
+        info.rows = static_cast<uint32_t>(get(&data[pos + 8], 4));
+        pos += 12;
+        blocks.push_back(info);
+    }
+    return true;
+}
+
+int TickArchiveReader::find(const std::string& instrumentId) const {
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        if (blocks[i].InstrumentID == instrumentId) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+bool TickArchiveReader::readBlock(size_t index, std::vector<ArchiveTick>& out, std::string& error) {
+    if (index >= blocks.size()) {
+        error = "块序号越界";
+        return false;
+    }
+    uint64_t pos = blocks[index].offset;
+    if (pos + 24 > data.size()) {
+        error = "数据块已损坏";
+        return false;
+    }
+    const uint8_t* header = &data[pos];
+    uint32_t rows = static_cast<uint32_t>(get(header, 4));
+    uint16_t columnCount = static_cast<uint16_t>(get(header + 4, 2));
+    uint8_t codec = header[6];
+    int64_t priceUnit = static_cast<int64_t>(get(header + 8, 8));
+    uint32_t rawSize = static_cast<uint32_t>(get(header + 16, 4));
+    uint32_t storedSize = static_cast<uint32_t>(get(header + 20, 4));
+    uint64_t payloadPos = pos + 24 + 4ULL * columnCount;
+    // 新版本追加的列跳过不读
+    if (columnCount < kColumnCount || priceUnit <= 0 || payloadPos + storedSize > data.size()) {
+        error = "数据块已损坏";
+        return false;
+    }
+
+    const uint8_t* payload = &data[payloadPos];
+    if (codec == CODEC_LZ4) {
+#ifdef HAVE_LZ4
+        scratch.resize(rawSize);
+        int n = LZ4_decompress_safe(reinterpret_cast<const char*>(payload), reinterpret_cast<char*>(scratch.data()),
+                                    static_cast<int>(storedSize), static_cast<int>(rawSize));
+        if (n != static_cast<int>(rawSize)) {
+            error = "LZ4解压失败";
+            return false;
+        }
+        payload = scratch.data();
+#else
+        error = "编译时未启用LZ4，无法读取压缩的数据块";
+        return false;
+#endif
+    } else if (codec != CODEC_NONE || rawSize != storedSize) {
+        error = "未知的压缩方式: " + std::to_string(codec);
+        return false;
+    }
+
+    // 每列的读位置和累加值；按行分段解码，一段内逐列处理，输出的一段留在缓存里
+    const uint8_t* cursor[kColumnCount];
+    const uint8_t* limit[kColumnCount];
+    int64_t value[kColumnCount] = {};
+    const uint8_t* column = payload;
+    const uint8_t* payloadEnd = payload + rawSize;
+    for (size_t c = 0; c < kColumnCount; ++c) {
+        uint32_t size = static_cast<uint32_t>(get(header + 24 + 4 * c, 4));
+        if (size > static_cast<size_t>(payloadEnd - column)) {
+            error = "数据块已损坏";
+            return false;
+        }
+        cursor[c] = column;
+        limit[c] = column + size;
+        column += size;
+    }
+
+    out.resize(rows);
+    const uint32_t kChunkRows = 256;
+    for (uint32_t first = 0; first < rows; first += kChunkRows) {
+        uint32_t count = std::min(kChunkRows, rows - first);
+        for (size_t c = 0; c < kColumnCount; ++c) {
+            const ColumnDef& col = kColumns[c];
+            bool ok = false;
+            char* field = reinterpret_cast<char*>(out.data() + first) + col.offset;
+            switch (col.kind) {
+            case COL_INT32:
+                ok = decodeColumn(cursor[c], limit[c], value[c], count, field, [](char* f, int64_t v) {
+                    *reinterpret_cast<int32_t*>(f) = static_cast<int32_t>(v);
+                });
+                break;
+            case COL_INT64:
+                ok = decodeColumn(cursor[c], limit[c], value[c], count, field, [](char* f, int64_t v) {
+                    *reinterpret_cast<int64_t*>(f) = v;
+                });
+                break;
+            case COL_PRICE:
+            case COL_SCALED: {
+                // 先还原为整数再做一次除法，结果与原始的十进制数值一致
+                int64_t multiplier = col.kind == COL_PRICE ? priceUnit : 1;
+                double scale = col.kind == COL_PRICE ? kPriceScale : static_cast<double>(col.scale);
+                ok = decodeColumn(cursor[c], limit[c], value[c], count, field, [=](char* f, int64_t v) {
+                    *reinterpret_cast<double*>(f) = static_cast<double>(v * multiplier) / scale;
+                });
+                break;
+            }
+            }
+            if (!ok) {
+                error = "数据块已损坏";
+                return false;
+            }
+        }
+    }
+    return true;
+}
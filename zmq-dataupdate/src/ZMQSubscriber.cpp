@@ -3,16 +3,48 @@
 #include "../include/InvestorPositionConverter.h"
 #include "../include/MarketDataConverter.h"
 #include "../include/TradingAccountConverter.h"
+#include "../include/ThreadTuning.h"
+#include "../include/MarketTopic.h"
 #include <iostream>
 #include <sstream>
 #include <memory>
 #include <vector>
 #include <algorithm>
+#include <iterator>
 #include <cstring>
 
 ZMQSubscriber::ZMQSubscriber(const std::string& addr) 
     : address(addr), running(false) {
     lastWriteTime = std::chrono::steady_clock::now();
+    
+    metricMessages = &metrics.counter("zmq_sub_messages_received_total", "收到的消息内容帧数");
+    metricTicksBuffered = &metrics.counter("zmq_sub_ticks_buffered_total", "放入写库缓冲区的行情条数");
+    metricParseFailures = &metrics.counter("zmq_sub_parse_failures_total", "行情解析失败次数");
+    metricTicksDropped = &metrics.counter("zmq_sub_ticks_dropped_total", "写库失败丢弃的行情条数");
+    metricBatchesOk = &metrics.counter("zmq_sub_db_batches_total", "批量写库次数", "result=\"ok\"");
+    metricBatchesFailed = &metrics.counter("zmq_sub_db_batches_total", "批量写库次数", "result=\"failed\"");
+    metricBufferDepth = &metrics.gauge("zmq_sub_buffer_depth", "写库缓冲区中的行情条数");
+    metricBatchRows = &metrics.histogram("zmq_sub_db_batch_rows", "每批写库的行数",
+                                         MetricHistogram::exponential(1, 2, 11));
+    metricBatchSeconds = &metrics.histogram("zmq_sub_db_batch_seconds", "每批写库耗时",
+                                            MetricHistogram::exponential(0.001, 2, 14));
+    metricEndToEnd = &metrics.histogram("zmq_sub_end_to_end_seconds", "发布端SPI收到到写库完成的耗时",
+                                        MetricHistogram::exponential(0.001, 2, 16));
+    metricTicksFiltered = &metrics.counter("zmq_sub_ticks_filtered_total", "不在白名单内、解析前丢弃的行情条数");
+    metricTicksConflated = &metrics.counter("zmq_sub_ticks_conflated_total", "合并模式下被同合约新行情覆盖的条数");
+    metricConflateSlots = &metrics.gauge("zmq_sub_conflate_instruments", "合并模式下跟踪的合约数");
+    metricLatestRows = &metrics.counter("zmq_sub_latest_rows_total", "更新到market_data_latest的行数");
+    metricLatestFailures = &metrics.counter("zmq_sub_latest_failures_total", "market_data_latest更新失败次数");
+    metricLatestSeconds = &metrics.histogram("zmq_sub_latest_upsert_seconds", "每次更新market_data_latest的耗时",
+                                             MetricHistogram::exponential(0.001, 2, 12));
+    metricInstrumentsWritten = &metrics.counter("zmq_sub_instruments_written_total", "写入数据库的新增或变化合约数");
+    metricInstrumentsUnchanged = &metrics.counter("zmq_sub_instruments_unchanged_total", "字段未变化、跳过写入的合约数");
+    metricShmTicks = &metrics.counter("zmq_sub_shm_ticks_total", "从共享内存环读到的行情条数");
+    metricShmOverruns = &metrics.counter("zmq_sub_shm_overruns_total", "读取落后被共享内存环覆盖的行情条数");
+    metricTicksQuarantined = &metrics.counter("zmq_sub_ticks_quarantined_total", "发布端校验不通过、只计数不入库的行情条数");
+    metrics.gaugeFn("zmq_sub_db_connected", "数据库是否已连接", [this]() {
+        return dbManager && dbManager->isConnected() ? 1.0 : 0.0;
+    });
 }
 
 ZMQSubscriber::~ZMQSubscriber() {
@@ -23,13 +55,39 @@ ZMQSubscriber::~ZMQSubscriber() {
     }
 }
 
+// 行情以外的主题（前缀匹配）：合约、持仓、资金、断线缺口、延迟统计
+static const char* const kControlTopics[] = {
+    "TICK", "INSTRUMENT", "CTP_", "MARKET_DATA_GAP", "LATENCY_STATS"
+};
+
 bool ZMQSubscriber::initialize() {
     try {
         context = std::unique_ptr<zmq::context_t>(new zmq::context_t(1));
         socket = std::unique_ptr<zmq::socket_t>(new zmq::socket_t(*context, ZMQ_SUB));
         
-        // 订阅所有消息
-        socket->setsockopt(ZMQ_SUBSCRIBE, "", 0);
+        if (instrumentTopics || !shmRingName.empty()) {
+            // 行情按前缀在发布端过滤：白名单条目都带交易所时只订阅这些前缀，否则订阅全部行情主题；
+            // 行情从共享内存环读取时不订阅任何行情主题，全市场行情不再经TCP传过来再丢弃
+            std::vector<std::string> topics;
+            if (shmRingName.empty() && (filter.empty() || !filter.subscriptionPrefixes(topics))) {
+                topics.assign(1, MarketTopic::kPrefix);
+            }
+            for (const auto& topic : topics) {
+                if (logger) {
+                    logger->info("订阅行情主题前缀: " + topic);
+                }
+            }
+            if (!shmRingName.empty() && logger) {
+                logger->info("行情从共享内存环读取，ZMQ只订阅行情以外的主题，旧CSV行情(MARKET_DATA)不再接收");
+            }
+            topics.insert(topics.end(), std::begin(kControlTopics), std::end(kControlTopics));
+            for (const auto& topic : topics) {
+                socket->setsockopt(ZMQ_SUBSCRIBE, topic.data(), topic.size());
+            }
+        } else {
+            // 订阅所有消息
+            socket->setsockopt(ZMQ_SUBSCRIBE, "", 0);
+        }
         
         // 连接到发布者
         socket->connect(address);
@@ -70,10 +128,25 @@ void ZMQSubscriber::start() {
 
     running = true;
     subscriberThread = std::thread(&ZMQSubscriber::subscriberLoop, this);
+    if (!shmRingName.empty()) {
+        shmReaderThread = std::thread(&ZMQSubscriber::shmReaderLoop, this);
+    }
     batchWriterThread = std::thread(&ZMQSubscriber::batchWriterLoop, this);
+    if (conflateInterval.count() > 0) {
+        conflateThread = std::thread(&ZMQSubscriber::conflateLoop, this);
+    }
+    if (latestDbManager && latestInterval.count() > 0) {
+        latestThread = std::thread(&ZMQSubscriber::latestLoop, this);
+    }
     
     if (logger) {
         logger->info("ZMQ订阅者启动成功");
+        if (conflateInterval.count() > 0) {
+            logger->info("行情合并模式，每 " + std::to_string(conflateInterval.count()) + " ms取一次各合约最新行情");
+        }
+        if (latestThread.joinable()) {
+            logger->info("最新行情表每 " + std::to_string(latestInterval.count()) + " ms更新一次");
+        }
         logger->info("批量写入线程启动成功，写入间隔: " + std::to_string(batchWriteInterval.count()) + " 秒");
     }
     
@@ -91,11 +164,25 @@ void ZMQSubscriber::stop() {
         subscriberThread.join();
     }
     
+    if (shmReaderThread.joinable()) {
+        shmReaderThread.join();
+    }
+    
     if (batchWriterThread.joinable()) {
         batchWriterThread.join();
     }
     
-    // 停止时刷新剩余的缓冲区数据
+    if (conflateThread.joinable()) {
+        conflateThread.join();
+    }
+    
+    if (latestThread.joinable()) {
+        latestThread.join();
+        upsertLatest();
+    }
+    
+    // 停止时把合并中的最新行情和剩余的缓冲区数据一起写库
+    drainConflated();
     flushMarketDataBuffer();
     
     if (socket) {
@@ -107,8 +194,16 @@ void ZMQSubscriber::stop() {
     }
 }
 
+void ZMQSubscriber::tuneThread(const std::string& role) {
+    std::string error;
+    if (!ThreadTuning::global().apply(role, role, error) && logger) {
+        logger->warning(role + " 线程设置失败: " + error);
+    }
+}
+
 void ZMQSubscriber::subscriberLoop() {
     std::cout << "进入订阅循环..." << std::endl;
+    tuneThread("sub_recv");
     while (running) {
         try {
             zmq::message_t messageType;
@@ -119,21 +214,23 @@ void ZMQSubscriber::subscriberLoop() {
                 continue;
             }
             
-            std::cout << "收到第一个frame（消息类型）" << std::endl;
-            
-            // 接收第二个frame（消息内容）
-            if (!socket->recv(messageContent, zmq::recv_flags::none)) {
-                continue;
-            }
-            
-            std::cout << "收到第二个frame（消息内容）" << std::endl;
-            
-            // 转换为字符串
             std::string typeStr(static_cast<char*>(messageType.data()), messageType.size());
-            std::string contentStr(static_cast<char*>(messageContent.data()), messageContent.size());
             
-            // 处理消息
-            processMessage(typeStr, contentStr);
+            // 接收后续的内容frame：普通消息只有一帧，批量数据按块分成多帧，每帧独立处理
+            bool more = messageType.more();
+            while (more) {
+                if (!socket->recv(messageContent, zmq::recv_flags::none)) {
+                    break;
+                }
+                more = messageContent.more();
+                lastRecvNs = monotonicNs();
+                metricMessages->inc();
+                
+                std::string contentStr(static_cast<char*>(messageContent.data()), messageContent.size());
+                if (!contentStr.empty()) {
+                    processMessage(typeStr, contentStr);
+                }
+            }
             
         } catch (const zmq::error_t& e) {
             if (logger) {
@@ -149,42 +246,154 @@ void ZMQSubscriber::subscriberLoop() {
     }
 }
 
-void ZMQSubscriber::processInstrumentMessage(const std::string& messageContent) {
-    if (logger) {
-        logger->info("处理合约消息，内容长度: " + std::to_string(messageContent.length()));
-    }
+void ZMQSubscriber::shmReaderLoop() {
+    tuneThread("sub_shm");
+    ShmTickReader reader;
+    uint64_t reportedOverruns = 0;
+    bool openWarned = false;
+    int idleRounds = 0;
     
+    while (running) {
+        if (!reader.isOpen()) {
+            // 发布端可能还没启动，定时重试
+            std::string error;
+            if (!reader.open(shmRingName, error)) {
+                if (!openWarned && logger) {
+                    logger->warning("共享内存行情环打开失败，稍后重试: " + error);
+                }
+                openWarned = true;
+                std::this_thread::sleep_for(std::chrono::seconds(1));
+                continue;
+            }
+            openWarned = false;
+            reportedOverruns = 0;
+            if (logger) {
+                logger->info("已连接共享内存行情环: /dev/shm/" + shmRingName);
+            }
+        }
+        
+        ShmTick tick;
+        if (!reader.poll(tick)) {
+            if (reader.stale()) {
+                if (logger) {
+                    logger->warning("共享内存行情环已被发布端重建，重新连接");
+                }
+                reader.close();
+                continue;
+            }
+            // 写库不需要亚微秒延迟，空闲一段时间后让出CPU
+            if (++idleRounds < 1000) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+            continue;
+        }
+        idleRounds = 0;
+        metricShmTicks->inc();
+        
+        if (reader.overruns() != reportedOverruns) {
+            metricShmOverruns->inc(reader.overruns() - reportedOverruns);
+            if (logger) {
+                logger->warning("共享内存行情环读取落后，累计丢失 " + std::to_string(reader.overruns()) + " 条");
+            }
+            reportedOverruns = reader.overruns();
+        }
+        
+        if (tick.quarantine != 0) {
+            metricTicksQuarantined->inc();
+            continue;
+        }
+        
+        if (!filter.empty() && !filter.accept(tick.ExchangeID, tick.InstrumentID)) {
+            metricTicksFiltered->inc();
+            continue;
+        }
+        
+        // 发布端在环中记录的打点，补上订阅端收到的时间
+        LatencyTrailer trailer;
+        trailer.stamps[STAGE_SPI_RECV] = tick.recvNs;
+        trailer.stamps[STAGE_SEND] = tick.publishNs;
+        trailer.stamps[STAGE_SUB_RECV] = monotonicNs();
+        trailer.recvWallNs = tick.recvWallNs;
+        
+        CTPMarketDataField marketData = {};
+        marketData.TradingDay = tick.TradingDay;
+        marketData.InstrumentID = tick.InstrumentID;
+        marketData.ExchangeID = tick.ExchangeID;
+        marketData.ExchangeInstID = tick.ExchangeInstID;
+        marketData.UpdateTime = tick.UpdateTime;
+        marketData.ActionDay = tick.ActionDay;
+        marketData.LastPrice = tick.LastPrice;
+        marketData.PreSettlementPrice = tick.PreSettlementPrice;
+        marketData.PreClosePrice = tick.PreClosePrice;
+        marketData.PreOpenInterest = tick.PreOpenInterest;
+        marketData.OpenPrice = tick.OpenPrice;
+        marketData.HighestPrice = tick.HighestPrice;
+        marketData.LowestPrice = tick.LowestPrice;
+        marketData.Volume = tick.Volume;
+        marketData.Turnover = tick.Turnover;
+        marketData.OpenInterest = tick.OpenInterest;
+        marketData.ClosePrice = tick.ClosePrice;
+        marketData.SettlementPrice = tick.SettlementPrice;
+        marketData.UpperLimitPrice = tick.UpperLimitPrice;
+        marketData.LowerLimitPrice = tick.LowerLimitPrice;
+        marketData.PreDelta = tick.PreDelta;
+        marketData.CurrDelta = tick.CurrDelta;
+        marketData.UpdateMillisec = tick.UpdateMillisec;
+        marketData.BidPrice1 = tick.BidPrice[0];
+        marketData.BidVolume1 = tick.BidVolume[0];
+        marketData.AskPrice1 = tick.AskPrice[0];
+        marketData.AskVolume1 = tick.AskVolume[0];
+        marketData.BidPrice2 = tick.BidPrice[1];
+        marketData.BidVolume2 = tick.BidVolume[1];
+        marketData.AskPrice2 = tick.AskPrice[1];
+        marketData.AskVolume2 = tick.AskVolume[1];
+        marketData.BidPrice3 = tick.BidPrice[2];
+        marketData.BidVolume3 = tick.BidVolume[2];
+        marketData.AskPrice3 = tick.AskPrice[2];
+        marketData.AskVolume3 = tick.AskVolume[2];
+        marketData.BidPrice4 = tick.BidPrice[3];
+        marketData.BidVolume4 = tick.BidVolume[3];
+        marketData.AskPrice4 = tick.AskPrice[3];
+        marketData.AskVolume4 = tick.AskVolume[3];
+        marketData.BidPrice5 = tick.BidPrice[4];
+        marketData.BidVolume5 = tick.BidVolume[4];
+        marketData.AskPrice5 = tick.AskPrice[4];
+        marketData.AskVolume5 = tick.AskVolume[4];
+        marketData.AveragePrice = tick.AveragePrice;
+        
+        addMarketDataToBuffer(std::move(marketData), &trailer);
+    }
+}
+
+void ZMQSubscriber::processInstrumentMessage(const std::string& messageType, const std::string& messageContent) {
     if (!dbManager || !dbManager->isConnected()) {
         if (logger) {
             logger->error("数据库未连接，无法处理合约消息");
         }
         return;
     }
-    
-    try {
-        // 尝试解析protobuf格式的合约消息
-        if (messageContent.length() > 0) {
-                    // 使用转换器检查是否是protobuf格式
-        bool isProtobuf = InstrumentConverter::isProtobufFormat(messageContent);
-        
+    if (messageContent.empty()) {
         if (logger) {
-            logger->info("格式检测结果: " + std::string(isProtobuf ? "protobuf" : "CSV") + 
-                        ", 数据大小: " + std::to_string(messageContent.length()) + " 字节");
+            logger->warning("收到空的合约消息");
         }
-        
-        if (isProtobuf) {
-            // 处理protobuf格式的合约数据
+        return;
+    }
+    
+    try {
+        // 格式由主题决定：CTP_INSTRUMENT_BATCH_UPDATE为InstrumentBatchMessage，INSTRUMENT为旧版CSV
+        if (messageType == "CTP_INSTRUMENT_BATCH_UPDATE") {
             processProtobufInstrumentMessage(messageContent);
-        } else {
-            // 处理CSV格式的合约数据
+        } else if (instrumentCsvCompat) {
             processCSVInstrumentMessage(messageContent);
-        }
-        } else {
+        } else if (!instrumentCsvWarned) {
             if (logger) {
-                logger->warning("收到空的合约消息");
+                logger->warning("收到CSV格式的合约消息，未开启instrument.csv_compat，忽略；"
+                                "请将ctpinstrument的instrument_encoding设为protobuf");
             }
+            instrumentCsvWarned = true;
         }
-        
     } catch (const std::exception& e) {
         if (logger) {
             logger->error("处理合约消息异常: " + std::string(e.what()));
@@ -193,8 +402,6 @@ void ZMQSubscriber::processInstrumentMessage(const std::string& messageContent)
 }
 
 void ZMQSubscriber::processCSVInstrumentMessage(const std::string& messageContent) {
-    std::vector<std::vector<std::string>> instruments;
-    
     // 检查数据大小，避免处理过大的数据
     if (messageContent.length() > 10000000) {  // 10MB限制
         if (logger) {
@@ -203,109 +410,88 @@ void ZMQSubscriber::processCSVInstrumentMessage(const std::string& messageConten
         return;
     }
     
-    // 简单的CSV格式解析
-    std::istringstream iss(messageContent);
-    std::string line;
-    int lineCount = 0;
-    
-    while (std::getline(iss, line) && lineCount < 1000) {  // 限制行数
-        lineCount++;
-        if (line.empty()) continue;
-        
-        std::vector<std::string> fields;
-        std::istringstream lineStream(line);
-        std::string field;
-        
-        // 按逗号分割字段
-        while (std::getline(lineStream, field, ',')) {
-            // 去除引号和空格
-            field.erase(0, field.find_first_not_of(" \t\""));
-            field.erase(field.find_last_not_of(" \t\"") + 1);
-            fields.push_back(field);
-        }
-        
-        if (fields.size() >= 30) {  // 确保有足够的字段
-            instruments.push_back(fields);
+    std::vector<CTPInstrumentField> instruments = InstrumentConverter::parseCSV(messageContent);
+    if (instruments.empty()) {
+        if (logger) {
+            logger->warning("未找到有效的CSV格式合约数据");
         }
+        return;
     }
-    
-    if (!instruments.empty()) {
-        if (dbManager->insertInstrumentBatch(instruments)) {
-            if (logger) {
-                logger->info("成功插入 " + std::to_string(instruments.size()) + " 个CSV格式合约到数据库");
-            }
-        } else {
-            if (logger) {
-                logger->error("插入CSV格式合约到数据库失败");
-            }
-        }
-    } else {
+    if (writeInstruments(instruments)) {
         if (logger) {
-            logger->warning("未找到有效的CSV格式合约数据");
+            logger->info("处理 " + std::to_string(instruments.size()) + " 个CSV格式合约完成");
         }
+    } else if (logger) {
+        logger->error("写入CSV格式合约到数据库失败");
     }
 }
 
 void ZMQSubscriber::processProtobufInstrumentMessage(const std::string& messageContent) {
-    if (logger) {
-        logger->info("收到protobuf格式的合约数据，长度: " + std::to_string(messageContent.length()));
-    }
-    
-    if (!dbManager || !dbManager->isConnected()) {
+    // 每帧是一个独立的InstrumentBatchMessage，只解析一次，直接按字段类型绑定写库
+    if (!InstrumentConverter::parseProtobufBatch(messageContent.data(), messageContent.size(), instrumentScratch)) {
         if (logger) {
-            logger->error("数据库未连接，无法处理protobuf合约数据");
+            logger->error("protobuf合约数据解析失败，长度: " + std::to_string(messageContent.length()));
         }
         return;
     }
-    
-    try {
-        // 使用转换器解析protobuf数据
-        std::vector<CTPInstrumentField> instruments = InstrumentConverter::parseProtobufBatch(messageContent);
-        
-        if (!instruments.empty()) {
-            // 转换为数据库格式
-            std::vector<std::vector<std::string>> dbInstruments = InstrumentConverter::convertBatchToDatabaseFormat(instruments);
-            
-            if (dbManager->insertInstrumentBatch(dbInstruments)) {
-                if (logger) {
-                    logger->info("成功插入 " + std::to_string(instruments.size()) + " 个protobuf格式合约到数据库");
-                }
-            } else {
-                if (logger) {
-                    logger->error("插入protobuf格式合约到数据库失败");
-                }
-            }
-        } else {
-            // 临时解决方案：尝试从protobuf数据中提取一些基本信息
+    if (instrumentScratch.empty()) {
+        return;
+    }
+    if (writeInstruments(instrumentScratch)) {
+        if (logger) {
+            logger->info("处理 " + std::to_string(instrumentScratch.size()) + " 个protobuf格式合约完成");
+        }
+    } else if (logger) {
+        logger->error("写入protobuf格式合约到数据库失败");
+    }
+}
+
+bool ZMQSubscriber::writeInstruments(const std::vector<CTPInstrumentField>& instruments) {
+    if (!instrumentIncremental) {
+        metricInstrumentsWritten->inc(instruments.size());
+        return dbManager->insertInstrumentBatch(instruments);
+    }
+
+    if (!instrumentHashesLoaded) {
+        // 加载失败时哈希只保存在内存中，本次全量写入
+        std::vector<std::pair<std::string, uint64_t>> saved;
+        if (dbManager->loadInstrumentHashes(saved)) {
+            instrumentTracker.load(saved);
             if (logger) {
-                logger->warning("protobuf数据解析结果为空，尝试临时处理");
-            }
-            
-            // 创建一个示例合约数据用于测试
-            std::vector<std::vector<std::string>> testInstruments;
-            std::vector<std::string> testInstrument = {
-                "TEST001", "SHFE", "测试合约001", "TEST001", "TEST", "1", "2024", "1", 
-                "100", "1", "100", "1", "10", "0.01", "20240101", "20240101", "20241231", 
-                "20241201", "20241231", "1", "1", "1", "1", "0.1", "0.1", "1", "", "0.0", "", "1.0", "1"
-            };
-            testInstruments.push_back(testInstrument);
-            
-            if (dbManager->insertInstrumentBatch(testInstruments)) {
-                if (logger) {
-                    logger->info("成功插入测试合约数据到数据库");
-                }
+                logger->info("加载合约哈希 " + std::to_string(saved.size()) + " 条");
             }
+        } else if (logger) {
+            logger->warning("加载合约哈希失败，本次全量写入合约");
         }
-        
-    } catch (const std::exception& e) {
+        instrumentHashesLoaded = true;
+    }
+
+    InstrumentChangeTracker::Diff diff = instrumentTracker.diff(instruments);
+    metricInstrumentsUnchanged->inc(diff.unchanged);
+    if (diff.rows.empty()) {
         if (logger) {
-            logger->error("处理protobuf合约消息异常: " + std::string(e.what()));
+            logger->info("合约无变化: " + InstrumentChangeTracker::summary(diff));
         }
+        return true;
+    }
+
+    if (!dbManager->insertInstrumentBatch(diff.rows)) {
+        return false;
+    }
+    instrumentTracker.commit(diff);
+    metricInstrumentsWritten->inc(diff.rows.size());
+    // 哈希写失败只会导致下次多写一遍，不影响合约表
+    if (!dbManager->saveInstrumentHashes(diff.rows, diff.hashes) && logger) {
+        logger->warning("写入合约哈希失败");
+    }
+    if (logger) {
+        logger->info("合约增量写入: " + InstrumentChangeTracker::summary(diff));
     }
+    return true;
 }
 
 void ZMQSubscriber::processMessage(const std::string& messageType, const std::string& messageContent) {
-    if (logger) {
+    if (logger && logger->isDebugEnabled()) {
         logger->debug("收到消息 - 类型: " + messageType + ", 内容: " + messageContent);
     }
     
@@ -319,6 +505,12 @@ void ZMQSubscriber::processMessage(const std::string& messageType, const std::st
 }
 
 void ZMQSubscriber::defaultMessageHandler(const std::string& messageType, const std::string& messageContent) {
+    // 发布端校验不通过的行情（ctpmarket开启tick_validate时），只计数不入库，也不打日志
+    if (messageType == "MARKET_DATA_QUARANTINE") {
+        metricTicksQuarantined->inc();
+        return;
+    }
+    
     // 默认的消息处理逻辑
     if (logger) {
         logger->info("处理消息 - 类型: [" + messageType + "] 内容: [" + messageContent + "]");
@@ -354,7 +546,7 @@ void ZMQSubscriber::defaultMessageHandler(const std::string& messageType, const
         }
     } else if (messageType == "INSTRUMENT" || messageType == "CTP_INSTRUMENT_BATCH_UPDATE") {
         // 处理合约信息
-        processInstrumentMessage(messageContent);
+        processInstrumentMessage(messageType, messageContent);
     } else if (messageType == "CTP_INVESTOR_POSITION_BATCH_UPDATE" || messageType == "CTP_INVESTOR_POSITION_CSV_UPDATE") {
         // 处理投资者持仓信息
         if (logger) {
@@ -363,15 +555,34 @@ void ZMQSubscriber::defaultMessageHandler(const std::string& messageType, const
         processInvestorPositionMessage(messageContent);
     } else if (messageType == "MARKET_DATA") {
         // 处理CSV格式行情数据（旧格式）
-        if (logger) {
-            logger->info("匹配到CSV行情数据类型: " + messageType);
-        }
         processMarketDataMessage(messageContent);
+    } else if (MarketTopic::isMarketTopic(messageType)) {
+        // 按合约分主题的行情，内容与MARKET_DATA_PROTOBUF相同；发布端两种都发时只处理订阅的那一种
+        if (instrumentTopics && shmRingName.empty()) {
+            // 订阅前缀只到品种或合约前缀，这里按主题再精确判断一次
+            std::string exchange, product, instrument;
+            if (!filter.empty() && MarketTopic::parse(messageType, exchange, product, instrument)
+                && !filter.accept(exchange, instrument)) {
+                metricTicksFiltered->inc();
+                return;
+            }
+            processProtobufMarketDataMessage(messageContent);
+        }
     } else if (messageType == "MARKET_DATA_PROTOBUF") {
-        // 处理protobuf格式行情数据（新格式）
-        if (logger) {
-            logger->info("匹配到protobuf行情数据类型: " + messageType);
+        // 行情已从共享内存环读取，或改用按合约分的主题时，忽略同一份行情
+        if (!shmRingName.empty() || instrumentTopics) {
+            return;
         }
+        // 单一主题收到的是全市场行情，解析前先按合约代码过滤
+        if (!filter.empty()) {
+            std::string instrument, exchange;
+            if (MarketDataFilter::peekInstrument(messageContent, instrument, exchange)
+                && !filter.accept(exchange, instrument)) {
+                metricTicksFiltered->inc();
+                return;
+            }
+        }
+        // 处理protobuf格式行情数据（新格式）
         processProtobufMarketDataMessage(messageContent);
     } else if (messageType == "CTP_TRADING_ACCOUNT_UPDATE" || messageType == "CTP_TRADING_ACCOUNT_CSV_UPDATE") {
         // 处理资金账户数据
@@ -379,6 +590,16 @@ void ZMQSubscriber::defaultMessageHandler(const std::string& messageType, const
             logger->info("匹配到资金账户数据类型: " + messageType);
         }
         processTradingAccountMessage(messageContent);
+    } else if (messageType == "LATENCY_STATS") {
+        // 发布端各阶段延迟汇总，每行: stage,count,p50,p90,p99,p999,max,mean（us）
+        if (logger) {
+            logger->info("发布端延迟统计:\n" + messageContent);
+        }
+    } else if (messageType == "MARKET_DATA_GAP") {
+        // 行情前置断线缺口标记: START,断线原因,时间戳 / END,缺口时长ms,时间戳
+        if (logger) {
+            logger->warning("行情数据缺口标记: " + messageContent);
+        }
     } else {
         if (logger) {
             logger->info("未匹配的消息类型: " + messageType);
@@ -507,20 +728,8 @@ void ZMQSubscriber::processProtobufInvestorPositionMessage(const std::string& me
 }
 
 void ZMQSubscriber::processMarketDataMessage(const std::string& messageContent) {
-    if (logger) {
-        logger->info("处理行情数据消息，数据长度: " + std::to_string(messageContent.length()));
-    }
-    
-    // 检查是否为CSV格式的行情数据
-    bool isCSV = MarketDataConverter::isCSVFormat(messageContent);
-    if (logger) {
-        logger->info("行情数据格式检测结果: " + std::string(isCSV ? "CSV" : "未知格式"));
-    }
-    
-    if (isCSV) {
-        if (logger) {
-            logger->info("开始处理CSV格式行情数据");
-        }
+    // 逐条行情的路径上不打info日志
+    if (MarketDataConverter::isCSVFormat(messageContent)) {
         processCSVMarketDataMessage(messageContent);
     } else {
         if (logger) {
@@ -530,22 +739,25 @@ void ZMQSubscriber::processMarketDataMessage(const std::string& messageContent)
 }
 
 void ZMQSubscriber::processCSVMarketDataMessage(const std::string& messageContent) {
-    if (logger) {
-        logger->info("开始解析CSV格式行情数据");
-    }
-    
     try {
-        // 解析行情数据
-        CTPMarketDataField marketData = MarketDataConverter::parseCSV(messageContent);
-        
-        if (marketData.InstrumentID.empty()) {
+        // 解析行情数据，字段都很短，字符串不超过SSO不分配内存；解析结果移动进缓冲区
+        CTPMarketDataField marketData = {};
+        if (!MarketDataConverter::parseCSV(messageContent.data(), messageContent.size(), marketData)
+            || marketData.InstrumentID.empty()) {
+            metricParseFailures->inc();
             if (logger) {
-                logger->warning("行情数据解析失败，合约代码为空");
+                logger->warning("行情数据解析失败，格式错误或合约代码为空");
             }
             return;
         }
         
-        if (logger) {
+        // 旧CSV格式没有固定偏移可取，解析后再过滤
+        if (!filter.accept(marketData.ExchangeID, marketData.InstrumentID)) {
+            metricTicksFiltered->inc();
+            return;
+        }
+        
+        if (logger && logger->isDebugEnabled()) {
             logger->debug("解析到行情数据 - 合约: " + marketData.InstrumentID + 
                         ", 最新价: " + std::to_string(marketData.LastPrice) +
                         ", 成交量: " + std::to_string(marketData.Volume) +
@@ -553,7 +765,7 @@ void ZMQSubscriber::processCSVMarketDataMessage(const std::string& messageConten
         }
         
         // 添加到缓冲区，批量写入数据库
-        addMarketDataToBuffer(marketData);
+        addMarketDataToBuffer(std::move(marketData));
         
     } catch (const std::exception& e) {
         if (logger) {
@@ -653,13 +865,133 @@ void ZMQSubscriber::processCSVTradingAccountMessage(const std::string& messageCo
 
 // 批量写入相关方法实现
 
-void ZMQSubscriber::addMarketDataToBuffer(const CTPMarketDataField& marketData) {
-    std::lock_guard<std::mutex> lock(bufferMutex);
+void ZMQSubscriber::addMarketDataToBuffer(CTPMarketDataField marketData, const LatencyTrailer* trailer) {
+    bool conflate = conflateInterval.count() > 0;
+    bool latest = latestDbManager && latestInterval.count() > 0;
+    if (!conflate) {
+        if (!latest) {
+            appendToBuffer(std::move(marketData), trailer);
+            return;
+        }
+        appendToBuffer(marketData, trailer);
+    }
+    
+    // 更新该合约的快照槽位，合并模式由conflateLoop定时取走，最新行情表由latestLoop定时取走
+    std::lock_guard<std::mutex> lock(conflateMutex);
+    auto it = conflateIndex.find(marketData.InstrumentID);
+    if (it == conflateIndex.end()) {
+        it = conflateIndex.emplace(marketData.InstrumentID, conflateSlots.size()).first;
+        conflateSlots.emplace_back();
+        metricConflateSlots->set(static_cast<int64_t>(conflateSlots.size()));
+    }
+    ConflatedSlot& slot = conflateSlots[it->second];
+    if (conflate) {
+        if (slot.dirty) {
+            metricTicksConflated->inc();
+        } else {
+            slot.dirty = true;
+            dirtySlots.push_back(it->second);
+        }
+    }
+    if (latest && !slot.latestDirty) {
+        slot.latestDirty = true;
+        dirtyLatest.push_back(it->second);
+    }
+    slot.data = std::move(marketData);
+    slot.traced = trailer != nullptr;
+    if (trailer) {
+        slot.trailer = *trailer;
+    }
+}
+
+void ZMQSubscriber::conflateLoop() {
+    tuneThread("conflate");
+    while (running) {
+        std::this_thread::sleep_for(conflateInterval);
+        drainConflated();
+    }
+}
+
+void ZMQSubscriber::drainConflated() {
+    std::vector<ConflatedSlot> changed;
+    {
+        std::lock_guard<std::mutex> lock(conflateMutex);
+        changed.reserve(dirtySlots.size());
+        for (size_t index : dirtySlots) {
+            ConflatedSlot& slot = conflateSlots[index];
+            slot.dirty = false;
+            changed.push_back(slot);
+        }
+        dirtySlots.clear();
+    }
+    
+    for (auto& slot : changed) {
+        appendToBuffer(std::move(slot.data), slot.traced ? &slot.trailer : nullptr);
+    }
+}
+
+void ZMQSubscriber::latestLoop() {
+    tuneThread("latest_writer");
+    while (running) {
+        std::this_thread::sleep_for(latestInterval);
+        upsertLatest();
+    }
+}
+
+void ZMQSubscriber::upsertLatest() {
+    // 锁内只复制快照，绑定参数和写库都在锁外，不阻塞订阅线程更新槽位
+    std::vector<size_t> indices;
+    std::vector<CTPMarketDataField>& rows = latestRows;
+    {
+        std::lock_guard<std::mutex> lock(conflateMutex);
+        indices.swap(dirtyLatest);
+        rows.resize(indices.size());
+        for (size_t i = 0; i < indices.size(); ++i) {
+            ConflatedSlot& slot = conflateSlots[indices[i]];
+            slot.latestDirty = false;
+            rows[i] = slot.data;
+        }
+    }
+    if (rows.empty()) {
+        return;
+    }
     
-    marketDataBuffer.push_back(marketData);
+    auto start = std::chrono::steady_clock::now();
+    bool ok = latestDbManager->isConnected() && latestDbManager->upsertLatestMarketDataBatch(rows);
+    metricLatestSeconds->observe(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    if (ok) {
+        metricLatestRows->inc(rows.size());
+        return;
+    }
     
+    // 失败的合约重新标记，下一轮连同新的更新一起重试
+    metricLatestFailures->inc();
     if (logger) {
-        logger->debug("添加行情数据到缓冲区: " + marketData.InstrumentID + 
+        logger->warning("更新最新行情表失败，" + std::to_string(rows.size()) + " 个合约下一轮重试");
+    }
+    std::lock_guard<std::mutex> lock(conflateMutex);
+    for (size_t index : indices) {
+        ConflatedSlot& slot = conflateSlots[index];
+        if (!slot.latestDirty) {
+            slot.latestDirty = true;
+            dirtyLatest.push_back(index);
+        }
+    }
+}
+
+void ZMQSubscriber::appendToBuffer(CTPMarketDataField marketData, const LatencyTrailer* trailer) {
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    
+    marketDataBuffer.push_back(std::move(marketData));
+    latencyBuffer.push_back(trailer ? *trailer : LatencyTrailer());
+    if (trailer) {
+        latencyBuffer.back().stamps[STAGE_SUB_BUFFER] = monotonicNs();
+    }
+    metricTicksBuffered->inc();
+    metricBufferDepth->set(static_cast<int64_t>(marketDataBuffer.size()));
+    
+    if (logger && logger->isDebugEnabled()) {
+        logger->debug("添加行情数据到缓冲区: " + marketDataBuffer.back().InstrumentID + 
                      ", 缓冲区大小: " + std::to_string(marketDataBuffer.size()));
     }
     
@@ -676,6 +1008,7 @@ void ZMQSubscriber::batchWriterLoop() {
     if (logger) {
         logger->info("批量写入线程启动，写入间隔: " + std::to_string(batchWriteInterval.count()) + " 秒");
     }
+    tuneThread("batch_writer");
     
     while (running) {
         std::this_thread::sleep_for(batchWriteInterval);
@@ -693,6 +1026,7 @@ void ZMQSubscriber::batchWriterLoop() {
             }
             flushMarketDataBuffer();
         }
+        logLatencyStats();
     }
     
     if (logger) {
@@ -724,12 +1058,34 @@ void ZMQSubscriber::flushMarketDataBuffer() {
         }
         
         // 批量插入数据库
-        if (dbManager->insertMarketDataBatch(marketDataStrings)) {
+        auto batchStart = std::chrono::steady_clock::now();
+        bool inserted = dbManager->insertMarketDataBatch(marketDataStrings);
+        metricBatchSeconds->observe(std::chrono::duration<double>(std::chrono::steady_clock::now() - batchStart).count());
+        metricBatchRows->observe(static_cast<double>(marketDataStrings.size()));
+        if (inserted) {
+            metricBatchesOk->inc();
+            // 只统计带打点的行情，没有打点的发布端stamps全为0
+            int64_t commitNs = monotonicNs();
+            int64_t commitWallNs = wallNs();
+            for (auto& trailer : latencyBuffer) {
+                if (trailer.stamps[STAGE_SPI_RECV] == 0) {
+                    continue;
+                }
+                trailer.stamps[STAGE_DB_COMMIT] = commitNs;
+                latTransport.record(trailer.stamps[STAGE_SUB_RECV] - trailer.stamps[STAGE_SEND]);
+                latParse.record(trailer.stamps[STAGE_SUB_BUFFER] - trailer.stamps[STAGE_SUB_RECV]);
+                latCommit.record(commitNs - trailer.stamps[STAGE_SUB_BUFFER]);
+                latEndToEnd.record(commitNs - trailer.stamps[STAGE_SPI_RECV]);
+                latExchange.record(commitWallNs - trailer.recvWallNs);
+                metricEndToEnd->observe((commitNs - trailer.stamps[STAGE_SPI_RECV]) / 1e9);
+            }
             if (logger) {
                 logger->info("成功批量插入 " + std::to_string(marketDataBuffer.size()) + 
                            " 条行情数据到数据库");
             }
         } else {
+            metricBatchesFailed->inc();
+            metricTicksDropped->inc(marketDataBuffer.size());
             if (logger) {
                 logger->error("批量插入行情数据到数据库失败，数据量: " + 
                              std::to_string(marketDataBuffer.size()));
@@ -738,6 +1094,8 @@ void ZMQSubscriber::flushMarketDataBuffer() {
         
         // 清空缓冲区并更新时间
         marketDataBuffer.clear();
+        latencyBuffer.clear();
+        metricBufferDepth->set(0);
         lastWriteTime = std::chrono::steady_clock::now();
         
     } catch (const std::exception& e) {
@@ -748,21 +1106,25 @@ void ZMQSubscriber::flushMarketDataBuffer() {
 }
 
 void ZMQSubscriber::processProtobufMarketDataMessage(const std::string& messageContent) {
-    if (logger) {
-        logger->info("开始解析protobuf格式行情数据，数据长度: " + std::to_string(messageContent.length()));
+    // 发布端附带的延迟打点（protobuf未知字段，ParseFromString会跳过）
+    LatencyTrailer trailer;
+    bool traced = trailer.parseFrom(messageContent);
+    if (traced) {
+        trailer.stamps[STAGE_SUB_RECV] = lastRecvNs;
     }
     
     try {
         // 反序列化protobuf消息
         ctp::MarketDataMessage protoMessage;
         if (!protoMessage.ParseFromString(messageContent)) {
+            metricParseFailures->inc();
             if (logger) {
                 logger->error("protobuf行情数据反序列化失败");
             }
             return;
         }
         
-        if (logger) {
+        if (logger && logger->isDebugEnabled()) {
             logger->debug("解析到protobuf行情数据 - 合约: " + protoMessage.instrument_id() + 
                         ", 最新价: " + std::to_string(protoMessage.last_price()) +
                         ", 成交量: " + std::to_string(protoMessage.volume()) +
@@ -823,7 +1185,7 @@ void ZMQSubscriber::processProtobufMarketDataMessage(const std::string& messageC
         marketData.AveragePrice = protoMessage.average_price();
         
         // 添加到缓冲区，批量写入数据库
-        addMarketDataToBuffer(marketData);
+        addMarketDataToBuffer(std::move(marketData), traced ? &trailer : nullptr);
         
     } catch (const std::exception& e) {
         if (logger) {
@@ -832,6 +1194,19 @@ void ZMQSubscriber::processProtobufMarketDataMessage(const std::string& messageC
     }
 }
 
+void ZMQSubscriber::logLatencyStats() {
+    if (!logger) {
+        return;
+    }
+    
+    for (LatencyHistogram* hist : {&latTransport, &latParse, &latCommit, &latEndToEnd, &latExchange}) {
+        LatencyHistogram::Summary s = hist->summarize(true);
+        if (s.count > 0) {
+            logger->info("订阅端延迟 " + LatencyHistogram::format(hist->name(), s));
+        }
+    }
+}
+
 size_t ZMQSubscriber::getBufferSize() const {
     // 注意：由于const限制，这里无法使用mutex锁
     // 在多线程环境下可能不准确，但仅用于监控目的
@@ -5,6 +5,7 @@
 #include <thread>
 
 #include "../include/ConfigManager.h"
+#include "../include/ThreadTuning.h"
 #include "../include/Logger.h"
 #include "../include/DatabaseManager.h"
 #include "../include/ZMQSubscriber.h"
@@ -65,6 +66,15 @@ int main(int argc, char* argv[]) {
         );
         logger->info("ZMQ数据更新订阅者启动");
         
+        // 线程角色配置，在启动订阅/写库线程之前登记
+        std::string threadError;
+        if (!ThreadTuning::global().load(config.getThreadSpecs(), threadError)) {
+            logger->warning("线程配置有误: " + threadError);
+        }
+        for (const auto& desc : ThreadTuning::global().describeAll()) {
+            logger->info("线程配置 " + desc);
+        }
+        
         // 3. 初始化数据库连接
         auto dbManager = std::make_shared<DatabaseManager>(
             config.getDBHost(),
@@ -86,6 +96,10 @@ int main(int argc, char* argv[]) {
         // 设置依赖
         subscriber->setLogger(logger);
         subscriber->setDatabaseManager(dbManager);
+        // 合约只写新增和变化的，哈希保存在test_update_instrument_hash
+        subscriber->setInstrumentIncremental(config.getBoolValue("instrument.incremental", true));
+        // 合约默认只收protobuf(CTP_INSTRUMENT_BATCH_UPDATE)，旧发布端的CSV需开启兼容模式
+        subscriber->setInstrumentCsvCompat(config.getBoolValue("instrument.csv_compat", false));
         
         // 设置自定义消息处理函数（可选）
         // subscriber->setMessageHandler(customMessageHandler);
@@ -0,0 +1,298 @@
+#include "../include/DatabaseManager.h"
+#include "../include/Logger.h"
+#include "../include/ConfigManager.h"
+#include "../include/TickArchive.h"
+#include "../include/MarketDataConverter.h"
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <memory>
+#include <sys/stat.h>
+
+// 把market_data中的整日行情导出为压缩列存归档文件<目录>/<交易日>.tck，格式见TICK_ARCHIVE.md
+//   zmq_tick_export [-c config.ini] [-o 目录] 交易日...      导出，目录默认取archive.dir
+//   zmq_tick_export --cat 文件 [合约]                         以CSV打印归档内容，用于核对
+//   zmq_tick_export [-c config.ini] --import-csv 文件...      把CSV行情文件补录到market_data
+
+static const char* kSelectColumns =
+    "ExchangeID, ActionDay, UpdateTime, UpdateMillisec, Volume, Turnover, OpenInterest, LastPrice, "
+    "BidPrice1, BidPrice2, BidPrice3, BidPrice4, BidPrice5, "
+    "AskPrice1, AskPrice2, AskPrice3, AskPrice4, AskPrice5, "
+    "BidVolume1, BidVolume2, BidVolume3, BidVolume4, BidVolume5, "
+    "AskVolume1, AskVolume2, AskVolume3, AskVolume4, AskVolume5, "
+    "OpenPrice, HighestPrice, LowestPrice, ClosePrice, SettlementPrice, UpperLimitPrice, LowerLimitPrice, "
+    "PreSettlementPrice, PreClosePrice, PreOpenInterest, AveragePrice";
+
+static int toDate(const std::string& text) {
+    int value = 0;
+    for (char c : text) {
+        if (c >= '0' && c <= '9') {
+            value = value * 10 + (c - '0');
+        }
+    }
+    return value;
+}
+
+// HH:MM:SS + 毫秒 -> 当日毫秒数
+static int toTimeMs(const std::string& text, int millisec) {
+    int h = 0, m = 0, s = 0;
+    sscanf(text.c_str(), "%d:%d:%d", &h, &m, &s);
+    return ((h * 60 + m) * 60 + s) * 1000 + millisec;
+}
+
+static double getDouble(sql::ResultSet& rs, int column) {
+    return rs.isNull(column) ? 0 : static_cast<double>(rs.getDouble(column));
+}
+
+static int getInt(sql::ResultSet& rs, int column) {
+    return rs.isNull(column) ? 0 : rs.getInt(column);
+}
+
+static bool exportDay(DatabaseManager& db, Logger& logger, const std::string& tradingDay, const std::string& dir) {
+    if (tradingDay.size() != 8 || toDate(tradingDay) < 19000101) {
+        logger.error("交易日格式应为YYYYMMDD: " + tradingDay);
+        return false;
+    }
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::string> instruments;
+    auto list = db.query("SELECT DISTINCT InstrumentID FROM market_data WHERE TradingDay = '" + tradingDay +
+                         "' ORDER BY InstrumentID");
+    if (!list) {
+        return false;
+    }
+    while (list->next()) {
+        instruments.push_back(list->getString(1));
+    }
+    if (instruments.empty()) {
+        logger.warning(tradingDay + " 没有行情数据");
+        return true;
+    }
+
+    std::string path = dir + "/" + tradingDay + ".tck";
+    std::string error;
+    TickArchiveWriter writer;
+    if (!writer.open(path, tradingDay, error)) {
+        logger.error(error);
+        return false;
+    }
+
+    // 逐个合约查询，走idx_instrument_time，结果集不会占用太多内存；按id排序即到达顺序，夜盘跨零点不会乱序
+    size_t rowCount = 0;
+    std::vector<ArchiveTick> ticks;
+    for (const auto& instrument : instruments) {
+        auto rs = db.query(std::string("SELECT ") + kSelectColumns + " FROM market_data WHERE TradingDay = '" +
+                           tradingDay + "' AND InstrumentID = '" + instrument + "' ORDER BY id");
+        if (!rs) {
+            writer.abort();
+            return false;
+        }
+        ticks.clear();
+        std::string exchangeId;
+        while (rs->next()) {
+            if (exchangeId.empty()) {
+                exchangeId = rs->getString(1);
+            }
+            ArchiveTick tick;
+            tick.ActionDay = toDate(rs->getString(2));
+            tick.TimeMs = toTimeMs(rs->getString(3), getInt(*rs, 4));
+            tick.Volume = getInt(*rs, 5);
+            tick.Turnover = getDouble(*rs, 6);
+            tick.OpenInterest = getDouble(*rs, 7);
+            tick.LastPrice = getDouble(*rs, 8);
+            for (int i = 0; i < 5; ++i) {
+                tick.BidPrice[i] = getDouble(*rs, 9 + i);
+                tick.AskPrice[i] = getDouble(*rs, 14 + i);
+                tick.BidVolume[i] = getInt(*rs, 19 + i);
+                tick.AskVolume[i] = getInt(*rs, 24 + i);
+            }
+            tick.OpenPrice = getDouble(*rs, 29);
+            tick.HighestPrice = getDouble(*rs, 30);
+            tick.LowestPrice = getDouble(*rs, 31);
+            tick.ClosePrice = getDouble(*rs, 32);
+            tick.SettlementPrice = getDouble(*rs, 33);
+            tick.UpperLimitPrice = getDouble(*rs, 34);
+            tick.LowerLimitPrice = getDouble(*rs, 35);
+            tick.PreSettlementPrice = getDouble(*rs, 36);
+            tick.PreClosePrice = getDouble(*rs, 37);
+            tick.PreOpenInterest = getDouble(*rs, 38);
+            tick.AveragePrice = getDouble(*rs, 39);
+            ticks.push_back(tick);
+        }
+        if (!writer.writeBlock(instrument, exchangeId, ticks, error)) {
+            logger.error(error);
+            writer.abort();
+            return false;
+        }
+        rowCount += ticks.size();
+    }
+
+    if (!writer.finish(error)) {
+        logger.error(error);
+        return false;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double ratio = writer.getStoredBytes() > 0 ? static_cast<double>(writer.getRawBytes()) / writer.getStoredBytes() : 0;
+    char summary[256];
+    snprintf(summary, sizeof(summary), "%s 导出完成: %zu个合约 %zu条, 编码后%llu字节, 压缩比%.2f, 耗时%.1fs -> ",
+             tradingDay.c_str(), writer.getBlockCount(), rowCount,
+             static_cast<unsigned long long>(writer.getStoredBytes()), ratio, seconds);
+    logger.info(summary + path);
+    return true;
+}
+
+static int catArchive(const std::string& path, const std::string& instrument) {
+    TickArchiveReader reader;
+    std::string error;
+    if (!reader.open(path, error)) {
+        std::cerr << error << std::endl;
+        return -1;
+    }
+    std::vector<ArchiveTick> ticks;
+    printf("InstrumentID,ExchangeID,ActionDay,TimeMs,LastPrice,Volume,Turnover,OpenInterest,"
+           "BidPrice1,BidVolume1,AskPrice1,AskVolume1\n");
+    for (size_t i = 0; i < reader.getBlocks().size(); ++i) {
+        const ArchiveBlockInfo& block = reader.getBlocks()[i];
+        if (!instrument.empty() && block.InstrumentID != instrument) {
+            continue;
+        }
+        if (!reader.readBlock(i, ticks, error)) {
+            std::cerr << block.InstrumentID << ": " << error << std::endl;
+            return -1;
+        }
+        for (const auto& t : ticks) {
+            printf("%s,%s,%d,%d,%.10g,%lld,%.2f,%.10g,%.10g,%d,%.10g,%d\n",
+                   block.InstrumentID.c_str(), block.ExchangeID.c_str(), t.ActionDay, t.TimeMs, t.LastPrice,
+                   static_cast<long long>(t.Volume), t.Turnover, t.OpenInterest,
+                   t.BidPrice[0], t.BidVolume[0], t.AskPrice[0], t.AskVolume[0]);
+        }
+    }
+    return 0;
+}
+
+// CSV行情文件每行一条原始消息(EL/CTP_TICKER/... || 44个字段，或旧版EL/CTP_XZ的13个字段)，
+// 与订阅端收到的MARKET_DATA相同；按订阅端的批量写入路径入库，补录的行与实时写入的一致
+static const size_t kImportBatchRows = 1000;
+
+static bool importCsvFile(DatabaseManager& db, Logger& logger, const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        logger.error("无法打开CSV行情文件: " + path);
+        return false;
+    }
+    auto start = std::chrono::steady_clock::now();
+    std::string line;
+    std::vector<std::string> rows;
+    rows.reserve(kImportBatchRows);
+    CTPMarketDataField marketData = {};
+    size_t lineCount = 0, imported = 0, skipped = 0;
+    bool ok = true;
+    auto flush = [&]() {
+        if (rows.empty()) {
+            return;
+        }
+        if (db.insertMarketDataBatch(rows)) {
+            imported += rows.size();
+        } else {
+            ok = false;
+        }
+        rows.clear();
+    };
+    while (std::getline(in, line)) {
+        ++lineCount;
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty()) {
+            continue;
+        }
+        if (!MarketDataConverter::parseCSV(line.data(), line.size(), marketData) || marketData.InstrumentID.empty()) {
+            // 只报第一处，格式不对的文件不会刷屏
+            if (skipped++ == 0) {
+                logger.warning(path + " 第" + std::to_string(lineCount) + "行不是CSV行情，跳过");
+            }
+            continue;
+        }
+        rows.push_back(MarketDataConverter::convertToDatabaseFormat(marketData));
+        if (rows.size() >= kImportBatchRows) {
+            flush();
+        }
+    }
+    flush();
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    char summary[256];
+    snprintf(summary, sizeof(summary), "补录完成: %zu行, 入库%zu条, 跳过%zu行, 耗时%.1fs <- ",
+             lineCount, imported, skipped, seconds);
+    logger.info(summary + path);
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    std::string configFile = "config.ini";
+    std::string outDir;
+    std::vector<std::string> args;    // 交易日，--import-csv时为文件
+    bool importCsv = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--cat" && i + 1 < argc) {
+            return catArchive(argv[i + 1], i + 2 < argc ? argv[i + 2] : "");
+        } else if (arg == "--import-csv") {
+            importCsv = true;
+        } else if (arg == "-c" && i + 1 < argc) {
+            configFile = argv[++i];
+        } else if (arg == "-o" && i + 1 < argc) {
+            outDir = argv[++i];
+        } else {
+            args.push_back(arg);
+        }
+    }
+    if (args.empty()) {
+        std::cerr << "用法: " << argv[0] << " [-c config.ini] [-o 目录] 交易日(YYYYMMDD)..." << std::endl
+                  << "      " << argv[0] << " --cat 文件.tck [合约]" << std::endl
+                  << "      " << argv[0] << " [-c config.ini] --import-csv 文件..." << std::endl;
+        return -1;
+    }
+
+    Logger logger("tick_export.log");
+    ConfigManager config(configFile);
+    if (!config.loadConfig()) {
+        logger.error("配置文件加载失败: " + configFile);
+        return -1;
+    }
+    DatabaseManager db(config.getDBHost(), config.getDBPort(), config.getDBUser(), config.getDBPassword(),
+                       config.getDBName());
+    if (!db.connect()) {
+        logger.error("数据库连接失败");
+        return -1;
+    }
+
+    int failed = 0;
+    if (importCsv) {
+        for (const auto& path : args) {
+            if (!importCsvFile(db, logger, path)) {
+                logger.error(path + " 补录失败");
+                ++failed;
+            }
+        }
+        return failed == 0 ? 0 : -1;
+    }
+
+    if (outDir.empty()) {
+        outDir = config.getValue("archive.dir", "archive");
+    }
+    mkdir(outDir.c_str(), 0755);
+    if (!TickArchiveWriter::compressionAvailable()) {
+        logger.warning("编译时未找到liblz4，归档数据块不压缩");
+    }
+
+    for (const auto& day : args) {
+        if (!exportDay(db, logger, day, outDir)) {
+            logger.error(day + " 导出失败");
+            ++failed;
+        }
+    }
+    return failed == 0 ? 0 : -1;
+}
@@ -2,6 +2,11 @@
 #include "../include/DatabaseManager.h"
 #include "../include/Logger.h"
 #include "../include/ConfigManager.h"
+#include "../include/MetricsRegistry.h"
+#include "../include/ThreadTuning.h"
+#include "../include/MarketTopic.h"
+#include "../include/MarketDataFilter.h"
+#include "../include/PartitionManager.h"
 #include <iostream>
 #include <csignal>
 #include <memory>
@@ -44,6 +49,15 @@ int main() {
         // ZMQ配置 - 连接到行情数据端口
         std::string zmqAddress = config.getValue("zmq.market_address", "tcp://localhost:9999");
         
+        // 线程角色配置，在启动订阅/写库线程之前登记
+        std::string threadError;
+        if (!ThreadTuning::global().load(config.getThreadSpecs(), threadError)) {
+            logger->warning("线程配置有误: " + threadError);
+        }
+        for (const auto& desc : ThreadTuning::global().describeAll()) {
+            logger->info("线程配置 " + desc);
+        }
+        
         logger->info("配置信息:");
         logger->info("  数据库: " + dbHost + ":" + std::to_string(dbPort) + "/" + dbName);
         logger->info("  ZMQ地址: " + zmqAddress);
@@ -56,10 +70,13 @@ int main() {
             return -1;
         }
         
+        // 按交易日分区时分区键必须在主键中，主键为(id, TradingDay)，不分区时仍为(id)
+        bool partitionEnable = config.getBoolValue("market.partition.enable", false);
+
         // 创建行情数据表
         std::string createTableSQL = R"(
             CREATE TABLE IF NOT EXISTS market_data (
-                id BIGINT AUTO_INCREMENT PRIMARY KEY,
+                id BIGINT AUTO_INCREMENT,
                 TradingDay CHAR(9) NOT NULL COMMENT '交易日',
                 InstrumentID CHAR(31) NOT NULL COMMENT '合约代码',
                 ExchangeID CHAR(9) NOT NULL COMMENT '交易所代码',
@@ -106,12 +123,16 @@ int main() {
                 ActionDay CHAR(9) COMMENT '业务日期',
                 RecordTime TIMESTAMP DEFAULT CURRENT_TIMESTAMP COMMENT '入库时间',
                 
+                )" + std::string(partitionEnable ? "PRIMARY KEY (id, TradingDay)," : "PRIMARY KEY (id),") + R"(
                 INDEX idx_instrument_time (InstrumentID, TradingDay, UpdateTime),
                 INDEX idx_trading_day (TradingDay),
                 INDEX idx_update_time (UpdateTime),
                 INDEX idx_record_time (RecordTime)
             ) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COMMENT='行情数据表'
         )";
+        if (partitionEnable) {
+            createTableSQL += PartitionManager::createClause();
+        }
         
         if (dbManager->execute(createTableSQL)) {
             logger->info("行情数据表检查/创建成功");
@@ -119,11 +140,110 @@ int main() {
             logger->warning("行情数据表创建失败，可能已存在");
         }
 
+        // 分区维护：提前建好之后几天的分区，过期分区删除或归档；DDL可能较慢，使用单独的连接
+        std::unique_ptr<PartitionManager> partitionManager;
+        if (partitionEnable) {
+            auto partitionDbManager = std::make_shared<DatabaseManager>(dbHost, dbPort, dbUser, dbPassword, dbName);
+            if (partitionDbManager->connect()) {
+                partitionManager.reset(new PartitionManager(partitionDbManager, logger));
+                partitionManager->setAheadDays(config.getIntValue("market.partition.ahead_days", 3));
+                partitionManager->setRetention(config.getIntValue("market.partition.retention_days", 0),
+                    PartitionManager::parseExpireAction(config.getValue("market.partition.expire", "keep")));
+                partitionManager->setConvertExisting(config.getBoolValue("market.partition.convert_existing", false));
+                std::vector<std::string> keepIndexes = config.getListValue("market.partition.indexes");
+                if (!keepIndexes.empty()) {
+                    partitionManager->setKeepIndexes(keepIndexes);
+                }
+                partitionManager->maintain(time(nullptr));
+            } else {
+                logger->warning("分区维护数据库连接失败，不维护market_data分区");
+            }
+        }
+
+        // 最新行情表，每个合约一行，供界面和接口查询当前价格，不必扫描逐笔的market_data
+        int latestMs = config.getIntValue("market.latest_ms", 500);
+        std::shared_ptr<DatabaseManager> latestDbManager;
+        if (latestMs > 0) {
+            std::string createLatestSQL = R"(
+                CREATE TABLE IF NOT EXISTS market_data_latest (
+                    InstrumentID CHAR(31) NOT NULL COMMENT '合约代码',
+                    TradingDay CHAR(9) NOT NULL COMMENT '交易日',
+                    ExchangeID CHAR(9) NOT NULL COMMENT '交易所代码',
+                    ExchangeInstID CHAR(31) COMMENT '交易所合约代码',
+                    LastPrice DOUBLE, PreSettlementPrice DOUBLE, PreClosePrice DOUBLE, PreOpenInterest DOUBLE,
+                    OpenPrice DOUBLE, HighestPrice DOUBLE, LowestPrice DOUBLE, Volume INT, Turnover DOUBLE,
+                    OpenInterest DOUBLE, ClosePrice DOUBLE, SettlementPrice DOUBLE,
+                    UpperLimitPrice DOUBLE, LowerLimitPrice DOUBLE, PreDelta DOUBLE, CurrDelta DOUBLE,
+                    UpdateTime CHAR(9) COMMENT '最后修改时间',
+                    UpdateMillisec INT COMMENT '最后修改毫秒',
+                    BidPrice1 DOUBLE, BidVolume1 INT, AskPrice1 DOUBLE, AskVolume1 INT,
+                    BidPrice2 DOUBLE, BidVolume2 INT, AskPrice2 DOUBLE, AskVolume2 INT,
+                    BidPrice3 DOUBLE, BidVolume3 INT, AskPrice3 DOUBLE, AskVolume3 INT,
+                    BidPrice4 DOUBLE, BidVolume4 INT, AskPrice4 DOUBLE, AskVolume4 INT,
+                    BidPrice5 DOUBLE, BidVolume5 INT, AskPrice5 DOUBLE, AskVolume5 INT,
+                    AveragePrice DOUBLE COMMENT '当日均价',
+                    ActionDay CHAR(9) COMMENT '业务日期',
+                    RecordTime TIMESTAMP(3) DEFAULT CURRENT_TIMESTAMP(3) ON UPDATE CURRENT_TIMESTAMP(3) COMMENT '更新时间',
+                    
+                    PRIMARY KEY (InstrumentID),
+                    INDEX idx_exchange (ExchangeID)
+                ) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COMMENT='最新行情表'
+            )";
+            
+            if (dbManager->execute(createLatestSQL)) {
+                logger->info("最新行情表检查/创建成功");
+            } else {
+                logger->warning("最新行情表创建失败，可能已存在");
+            }
+            
+            latestDbManager = std::make_shared<DatabaseManager>(dbHost, dbPort, dbUser, dbPassword, dbName);
+            if (!latestDbManager->connect()) {
+                logger->warning("最新行情表数据库连接失败，不更新market_data_latest");
+                latestDbManager.reset();
+            }
+        }
+
         // 创建ZMQ订阅器
         marketSubscriber = std::make_shared<ZMQSubscriber>(zmqAddress);
         marketSubscriber->setLogger(logger);
         marketSubscriber->setDatabaseManager(dbManager);
 
+        // 行情主题: single为MARKET_DATA_PROTOBUF，instrument为MD.<交易所>.<品种>.<合约>，需与ctpmarket的md_topic_mode对应
+        std::string topicMode = config.getValue("market.topic_mode", "single");
+        if (topicMode == "instrument") {
+            marketSubscriber->setInstrumentTopics(true);
+            logger->info("行情按合约主题订阅: " + std::string(MarketTopic::kPrefix));
+        } else if (topicMode != "single") {
+            logger->warning("未知的market.topic_mode: " + topicMode + "，使用single");
+        }
+
+        // 行情白名单，三类条目取并集，都为空时写入全部行情
+        MarketDataFilter filter;
+        filter.addExchanges(config.getListValue("market.filter.exchanges"));
+        filter.addProducts(config.getListValue("market.filter.products"));
+        filter.addInstruments(config.getListValue("market.filter.instruments"));
+        marketSubscriber->setFilter(filter);
+        logger->info("行情白名单: " + filter.describe());
+
+        // 合并模式：每个合约每个间隔只写最新一条，0为逐条写入
+        int conflateMs = config.getIntValue("market.conflate_ms", 0);
+        if (conflateMs > 0) {
+            marketSubscriber->setConflateInterval(conflateMs);
+        }
+        if (latestDbManager) {
+            marketSubscriber->setLatestTable(latestDbManager, latestMs);
+        }
+
+        // 与ctpmarket同机部署时可从共享内存环读取行情，其它消息仍走ZMQ
+        std::string transport = config.getValue("market.transport", "zmq");
+        if (transport == "shm") {
+            std::string shmName = config.getValue("market.shm_name", "ctp_md");
+            marketSubscriber->setShmRing(shmName);
+            logger->info("行情从共享内存环读取: /dev/shm/" + shmName);
+        } else if (transport != "zmq") {
+            logger->warning("未知的market.transport: " + transport + "，使用zmq");
+        }
+
         if (!marketSubscriber->initialize()) {
             logger->error("ZMQ订阅器初始化失败");
             return -1;
@@ -132,10 +252,29 @@ int main() {
         logger->info("开始订阅行情数据...");
         marketSubscriber->start();
 
+        // 指标导出服务，端口为0时不启动
+        MetricsHttpServer metricsServer(marketSubscriber->getMetrics());
+        std::string metricsBind = config.getValue("metrics.bind", "127.0.0.1");
+        int metricsPort = config.getIntValue("metrics.port", 9103);
+        if (metricsPort > 0) {
+            if (metricsServer.start(metricsBind, metricsPort)) {
+                logger->info("指标服务已启动: http://" + metricsBind + ":" + std::to_string(metricsPort) + "/metrics");
+            } else {
+                logger->warning("指标服务启动失败: " + metricsServer.lastError());
+            }
+        }
+
         // 主循环 - 添加缓冲区状态监控
         int monitorCount = 0;
+        int partitionCount = 0;
         while (marketSubscriber->isRunning()) {
             std::this_thread::sleep_for(std::chrono::seconds(1));
+
+            // 每小时检查一次分区，跨日后自动补建
+            if (partitionManager && ++partitionCount >= 3600) {
+                partitionManager->maintain(time(nullptr));
+                partitionCount = 0;
+            }
             
             // 每10秒输出一次缓冲区状态
             monitorCount++;
@@ -147,6 +286,7 @@ int main() {
             }
         }
 
+        metricsServer.stop();
         logger->info("行情数据订阅器正常退出");
 
     } catch (const std::exception& e) {